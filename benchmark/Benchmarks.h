@@ -0,0 +1,116 @@
+/**
+ * @file       Benchmarks.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Benchmarks declaration and the common measurement helpers
+ */
+
+#ifndef BOOKINGSERVICE_BENCHMARKS_H
+#define BOOKINGSERVICE_BENCHMARKS_H
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <string_view>
+
+//! Micro-benchmarks of the BookingService hot paths
+namespace Benchmarks
+{
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Runs the <b>worker</b> function simultaneously in the specified number of threads
+     * @param threadsCount number of threads to start
+     * @param worker callable <b>size_t(size_t threadIdx)</b> returning the number of operations performed
+     * @return throughput (operations per second)
+     */
+    inline double measureThroughput(size_t threadsCount,
+                                    const std::function<size_t(size_t)>& worker)
+    {
+        std::vector<size_t> operations(threadsCount, 0);
+        std::vector<std::jthread> threads;
+        threads.reserve(threadsCount);
+
+        const Clock::time_point start = Clock::now();
+        for (size_t idx = 0; idx < threadsCount; ++idx)
+            threads.emplace_back([&, idx] { operations[idx] = worker(idx); });
+        threads.clear();
+        const std::chrono::duration<double> elapsed = Clock::now() - start;
+
+        size_t total = 0;
+        for (size_t ops: operations)
+            total += ops;
+        return static_cast<double>(total) / elapsed.count();
+    }
+
+    /**
+     * Prints a single result row in the common format
+     */
+    inline void report(std::string_view name, size_t threadsCount, double opsPerSecond)
+    {
+        std::cout << std::left << std::setw(40) << name << " threads: " << std::setw(4) << threadsCount
+                  << std::right << std::fixed << std::setprecision(0) << std::setw(14) << opsPerSecond
+                  << " ops/sec" << std::endl;
+    }
+
+    /** Book the seats of a single hot premiere: std::mutex vs flat combining **/
+    void bookingContention();
+
+    /** Throughput of the shared-nothing ShardedBookingService depending on the number of shards **/
+    void shardedService();
+
+    /** Load generator: coroutine-based AsyncBookingService on a single thread vs thread-per-request **/
+    void asyncService();
+
+    /** Prefix and fuzzy search over the catalog of 1M titles **/
+    void search();
+
+    /** Unique IDs allocation: shared atomic counter vs per-thread blocks of IDs **/
+    void idAllocation();
+
+    /** Premieres scan and neighbouring premieres booking: vector of std::shared_ptr vs PremiereSchedule **/
+    void premiereLayout();
+
+    /** Bookings of the separate premieres: with and without the change-data-capture stream attached **/
+    void changeStream();
+
+    /** 100k watchers of the hot premiere seat map: the full seats list re-fetch vs SeatsSubscription deltas **/
+    void seatsSubscription();
+
+    /** Admission checks of 10k clients per thread: mutex-protected token buckets vs AdmissionController **/
+    void admission();
+
+    /** Replication of the catalog and the bookings to the follower process: applied records per second and the lag **/
+    void replication();
+
+    /** Round trips of the co-located client: text CLI commands over the socket vs the shared-memory channel **/
+    void ipc();
+
+    /** Premiere lookups and bookings with the tracing spans: disabled, sampling every 100th and every request **/
+    void tracing();
+
+    /** Seat maps of the small, medium and large halls vs the byte per seat array: bookings and scans **/
+    void seatMaps();
+
+    /** Nearest theaters with the seats together among 10k theaters: the grid index vs the scan of the premieres **/
+    void geoIndex();
+
+    /** Filtered listings of 1M movies (playing, genre, format, language): bitmap intersections vs the scans **/
+    void movieFilters();
+
+    /** Trending movies of 100k with the skewed popularity: mutex-protected exact counts vs the streaming sketches **/
+    void trending();
+
+    /** Catalog listing commands of 1k movies: the flush per line and the rendering per request vs pre-rendered **/
+    void listingCache();
+
+    /** Repricing of 100k premieres by the occupancy and the showtime: the seats polling vs the batched columns **/
+    void pricing();
+}
+
+#endif //BOOKINGSERVICE_BENCHMARKS_H
@@ -0,0 +1,96 @@
+/**
+ * @file       admission_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Admission checks: mutex-protected map of token buckets vs Admission::AdmissionController
+ */
+
+#include <mutex>
+#include <unordered_map>
+
+#include "Benchmarks.h"
+#include "Admission.h"
+
+namespace
+{
+    using namespace Admission;
+
+    constexpr size_t checksPerThread { 2'000'000 };
+    constexpr uint64_t clientsPerThread { 10'000 };
+
+    /** The straightforward limiter: the classic token buckets refilled on access, behind a single mutex **/
+    class NaiveLimiter
+    {
+        struct Bucket
+        {
+            double tokens { 0 };
+            Clock::time_point updated {};
+        };
+
+        std::mutex mtx;
+        std::unordered_map<uint64_t, Bucket> buckets;
+        size_t inFlight { 0 };
+        const RateLimit limit;
+
+    public:
+
+        explicit NaiveLimiter(const RateLimit& limit): limit { limit } {
+        }
+
+        bool admit(uint64_t clientId, Clock::time_point now)
+        {
+            std::lock_guard<std::mutex> lock { mtx };
+            auto [iter, inserted] = buckets.try_emplace(clientId, Bucket { static_cast<double>(limit.burst), now });
+            Bucket& bucket = iter->second;
+            const std::chrono::duration<double> elapsed = now - bucket.updated;
+            bucket.tokens = std::min<double>(limit.burst, bucket.tokens + elapsed.count() * limit.perSecond);
+            bucket.updated = now;
+            if (bucket.tokens < 1)
+                return false;
+            bucket.tokens -= 1;
+            ++inFlight;
+            return true;
+        }
+
+        void release()
+        {
+            std::lock_guard<std::mutex> lock { mtx };
+            --inFlight;
+        }
+    };
+}
+
+namespace Benchmarks
+{
+    void admission()
+    {
+        Config config;
+        config.regular = RateLimit { 1'000'000, 1'000 };
+        config.clientsCapacity = 1 << 17;
+
+        for (size_t threadsCount: {1u, 2u, 4u, 8u})
+        {
+            NaiveLimiter naive { config.regular };
+            report("admission: mutex + unordered_map", threadsCount, measureThroughput(threadsCount, [&](size_t idx) {
+                size_t admitted = 0;
+                for (size_t i = 0; i < checksPerThread; ++i)
+                    if (naive.admit(idx * clientsPerThread + i % clientsPerThread, Clock::now())) {
+                        naive.release();
+                        ++admitted;
+                    }
+                return admitted;
+            }));
+
+            AdmissionController controller { config };
+            report("admission: AdmissionController", threadsCount, measureThroughput(threadsCount, [&](size_t idx) {
+                size_t admitted = 0;
+                for (size_t i = 0; i < checksPerThread; ++i)
+                    admitted += static_cast<bool>(controller.admit(idx * clientsPerThread + i % clientsPerThread,
+                                                                   Lane::Regular));
+                return admitted;
+            }));
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/**
+ * @file       async_service_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Load generator: coroutines on a single thread vs thread-per-request
+ */
+
+#include <random>
+#include <format>
+
+#include "Benchmarks.h"
+#include "AsyncBookingService.h"
+
+namespace
+{
+    using namespace Booking;
+
+    constexpr size_t premieresCount { 8 };
+
+    /** Maximum number of the request threads alive at once in the thread-per-request mode **/
+    constexpr size_t threadsInFlightMax { 1024 };
+
+    struct Request
+    {
+        BookingService::PremierePtr premiere;
+        std::vector<uint16_t> seats;
+    };
+
+    std::vector<Request> generateRequests(const BookingService& service, size_t requestsCount)
+    {
+        std::mt19937 generator { 42 };
+        std::uniform_int_distribution<size_t> premiereDist { 0, premieresCount - 1 };
+        std::uniform_int_distribution<uint16_t> seatDist { 1, Theater::seatsCapacityMax };
+
+        std::vector<Request> requests;
+        requests.reserve(requestsCount);
+        for (size_t idx = 0; idx < requestsCount; ++idx)
+            requests.push_back({&service.bookingSchedule[premiereDist(generator)], {seatDist(generator)}});
+        return requests;
+    }
+
+    double runCoroutines(BookingService& service, const std::vector<Request>& requests)
+    {
+        Async::Executor executor;
+        AsyncBookingService asyncService { service, executor };
+        size_t completed = 0;
+
+        const Benchmarks::Clock::time_point start = Benchmarks::Clock::now();
+        for (const Request& request: requests)
+            executor.spawn(asyncService.bookSeats(request.premiere, request.seats), [&](const PricedBooking&) {
+                ++completed;
+            });
+        executor.run();
+        const std::chrono::duration<double> elapsed = Benchmarks::Clock::now() - start;
+
+        return static_cast<double>(completed) / elapsed.count();
+    }
+
+    double runThreadPerRequest(const std::vector<Request>& requests)
+    {
+        std::atomic<size_t> completed { 0 };
+        const Benchmarks::Clock::time_point start = Benchmarks::Clock::now();
+        for (size_t first = 0; first < requests.size(); first += threadsInFlightMax)
+        {
+            std::vector<std::jthread> threads;
+            for (size_t idx = first; idx < std::min(requests.size(), first + threadsInFlightMax); ++idx) {
+                threads.emplace_back([&request = requests[idx], &completed] {
+                    [[maybe_unused]] const bool booked = request.premiere->bookSeats(request.seats);
+                    completed.fetch_add(1, std::memory_order_relaxed);
+                });
+            }
+        }
+        const std::chrono::duration<double> elapsed = Benchmarks::Clock::now() - start;
+        return static_cast<double>(completed.load()) / elapsed.count();
+    }
+}
+
+namespace Benchmarks
+{
+    void asyncService()
+    {
+        for (size_t requestsCount: {1'000u, 10'000u, 50'000u})
+        {
+            BookingService service;
+            service.addTheater("Theater");
+            for (size_t idx = 0; idx < premieresCount; ++idx) {
+                service.addMovie(std::format("Movie {}", idx));
+                service.scheduleMovie(std::format("Movie {}", idx), "Theater");
+            }
+            const std::vector<Request> requests = generateRequests(service, requestsCount);
+
+            report(std::format("coroutines ({} in flight)", requestsCount), 1, runCoroutines(service, requests));
+            for (Premiere& premiere: service.bookingSchedule)
+                premiere.seats.reset();
+            report(std::format("thread-per-request ({} requests)", requestsCount),
+                   std::min(requestsCount, threadsInFlightMax), runThreadPerRequest(requests));
+        }
+    }
+}
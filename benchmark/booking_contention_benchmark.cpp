@@ -0,0 +1,62 @@
+/**
+ * @file       booking_contention_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Single hot premiere booking throughput: std::mutex vs flat combining
+ */
+
+#include "Benchmarks.h"
+#include "BookingService.h"
+
+namespace
+{
+    using namespace Booking;
+
+    constexpr size_t requestsPerThread { 200'000 };
+
+    /** Books the seats and releases them back, so that the premiere never sells out during the run **/
+    template<bool Combined>
+    size_t bookAndRelease(Premiere& premiere, size_t threadIdx)
+    {
+        const uint16_t seat = static_cast<uint16_t>(threadIdx % Theater::seatsCapacityMax + 1);
+        const std::vector<uint16_t> seatsToBook { seat };
+        for (size_t i = 0; i < requestsPerThread; ++i)
+        {
+            bool booked = false;
+            if constexpr (Combined)
+                booked = premiere.bookSeatsCombined(seatsToBook);
+            else
+                booked = premiere.bookSeats(seatsToBook);
+
+            if (booked) {
+                std::lock_guard<std::mutex> lock { premiere.mtxBooking };
+                premiere.seats.release(seat);
+            }
+        }
+        return requestsPerThread;
+    }
+}
+
+namespace Benchmarks
+{
+    void bookingContention()
+    {
+        const Movie movie { "Movie" };
+        const Theater theater { "Theater" };
+
+        for (size_t threadsCount: {1u, 2u, 4u, 8u, 16u, 32u})
+        {
+            Premiere mutexPremiere { theater, movie };
+            report("mutex", threadsCount, measureThroughput(threadsCount, [&](size_t idx) {
+                return bookAndRelease<false>(mutexPremiere, idx);
+            }));
+
+            Premiere combinedPremiere { theater, movie };
+            report("flat combining", threadsCount, measureThroughput(threadsCount, [&](size_t idx) {
+                return bookAndRelease<true>(combinedPremiere, idx);
+            }));
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * @file       change_stream_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Booking with and without the change-data-capture stream attached
+ */
+
+#include <array>
+#include <atomic>
+#include <deque>
+
+#include "Benchmarks.h"
+#include "BookingService.h"
+
+namespace
+{
+    using namespace Booking;
+
+    constexpr size_t bookingsPerThread { 1'000'000 };
+
+    /** Books the seat and releases it back via bookSeats(), so that the premiere never sells out during the run **/
+    size_t bookAndRelease(Premiere& premiere)
+    {
+        const std::array<uint16_t, 1> seat { 1 };
+        for (size_t i = 0; i < bookingsPerThread; ++i)
+        {
+            if (!premiere.bookSeats(seat)) {
+                std::lock_guard<std::mutex> lock { premiere.mtxBooking };
+                premiere.seats.release(1);
+                premiere.publishOccupancy();
+            }
+        }
+        return bookingsPerThread;
+    }
+}
+
+namespace Benchmarks
+{
+    void changeStream()
+    {
+        const Theater theater { "Theater" };
+        std::deque<Movie> movies;
+        PremiereSchedule schedule;
+        for (size_t idx = 0; idx < 8; ++idx)
+            schedule.add(theater, movies.emplace_back("Movie"));
+
+        ChangeStream stream;
+        for (size_t threadsCount: {1u, 2u, 4u, 8u})
+        {
+            for (Premiere& premiere: schedule)
+                premiere.changeStream = nullptr;
+            report("bookSeats: no change stream", threadsCount, measureThroughput(threadsCount, [&](size_t idx) {
+                return bookAndRelease(schedule[idx]);
+            }));
+
+            for (Premiere& premiere: schedule)
+                premiere.changeStream = &stream;
+            report("bookSeats: change stream", threadsCount, measureThroughput(threadsCount, [&](size_t idx) {
+                return bookAndRelease(schedule[idx]);
+            }));
+
+            // The consumer keeps up with the producers, like the downstream systems are expected to
+            std::atomic<bool> stopped { false };
+            uint64_t consumed = 0;
+            std::jthread consumerThread { [&] {
+                ChangeStream::Consumer consumer = stream.subscribe().value();
+                std::array<SeatChange, 256> events {};
+                while (!stopped.load(std::memory_order_relaxed))
+                    if (const size_t count = consumer.poll(events).count; 0 != count)
+                        consumed += count;
+                    else
+                        std::this_thread::yield();
+            }};
+            report("bookSeats: change stream + consumer", threadsCount, measureThroughput(threadsCount, [&](size_t idx) {
+                return bookAndRelease(schedule[idx]);
+            }));
+            stopped.store(true);
+        }
+    }
+}
@@ -0,0 +1,121 @@
+/**
+ * @file       geo_index_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Nearest theaters with N seats together among 10k theaters: the grid index vs the scans
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include "Benchmarks.h"
+#include "BookingService.h"
+
+namespace
+{
+    using namespace Booking;
+    using Benchmarks::report;
+
+    constexpr size_t theatersCount { 10'000 };
+    constexpr size_t seatsTogether { 4 };
+    constexpr size_t resultsLimit { 5 };
+
+    /** The theaters are spread over Europe: about one per 400 square kilometers **/
+    constexpr GeoPoint areaMin { 36.0, -10.0 }, areaMax { 60.0, 30.0 };
+
+    template<typename Query>
+    double measureQueries(const std::vector<GeoPoint>& points, size_t queriesCount, Query&& query)
+    {
+        size_t found = 0;
+        const Benchmarks::Clock::time_point start = Benchmarks::Clock::now();
+        for (size_t idx = 0; idx < queriesCount; ++idx)
+            found += query(points[idx % points.size()]);
+        const std::chrono::duration<double> elapsed = Benchmarks::Clock::now() - start;
+        if (0 == found)
+            std::cout << "No results found\n";
+        return static_cast<double>(queriesCount) / elapsed.count();
+    }
+
+    /** Keeps the resultsLimit nearest ones **/
+    size_t nearest(std::vector<std::pair<double, const Theater*>>& found)
+    {
+        const auto middle = found.begin() + static_cast<std::ptrdiff_t>(std::min(resultsLimit, found.size()));
+        std::partial_sort(found.begin(), middle, found.end(), [](const auto& left, const auto& right) {
+            return left.first < right.first;
+        });
+        return static_cast<size_t>(middle - found.begin());
+    }
+
+    bool hasSeatsTogether(const std::vector<uint16_t>& seats)
+    {
+        for (size_t first = 0; first + seatsTogether <= seats.size(); ++first)
+            if (seats[first + seatsTogether - 1] - seats[first] == seatsTogether - 1)
+                return true;
+        return false;
+    }
+}
+
+namespace Benchmarks
+{
+    void geoIndex()
+    {
+        std::mt19937 generator { 42 };
+        std::uniform_real_distribution<double> latitudeDist { areaMin.latitude, areaMax.latitude };
+        std::uniform_real_distribution<double> longitudeDist { areaMin.longitude, areaMax.longitude };
+        std::bernoulli_distribution bookedDist { 0.7 };
+
+        BookingService service;
+        service.addMovie("Movie");
+        for (size_t idx = 0; idx < theatersCount; ++idx)
+        {
+            const std::string name = "Theater " + std::to_string(idx);
+            service.addTheater(name, GeoPoint { latitudeDist(generator), longitudeDist(generator) });
+            service.scheduleMovie("Movie", name);
+        }
+
+        // Most of the halls are booked so much, that there are no seats together left
+        for (Premiere& premiere: service.bookingSchedule)
+        {
+            std::vector<uint16_t> seats;
+            for (uint16_t seat = 1; seat <= Theater::seatsCapacityMax; ++seat)
+                if (bookedDist(generator))
+                    seats.push_back(seat);
+            [[maybe_unused]] const bool booked = premiere.bookSeats(seats);
+        }
+
+        std::vector<GeoPoint> points(1'000);
+        for (GeoPoint& point: points)
+            point = GeoPoint { latitudeDist(generator), longitudeDist(generator) };
+        const Movie* movie = service.movies.findEntryName("Movie").value();
+
+        report("theaters by movie + available seats", 1, measureQueries(points, 10, [&](const GeoPoint& point) {
+            std::vector<std::pair<double, const Theater*>> found;
+            for (const Theater* theater: service.getTheatersByMovie("Movie"))
+                if (hasSeatsTogether(service.getSeatsAvailable(theater, movie)))
+                    found.emplace_back(distanceKm(point, theater->location.value()), theater);
+            return nearest(found);
+        }));
+
+        report("premieres scan", 1, measureQueries(points, 1'000, [&](const GeoPoint& point) {
+            std::vector<std::pair<double, const Theater*>> found;
+            const std::span<const size_t> movieIds = service.bookingSchedule.getMovieIds();
+            for (size_t slot = 0; slot < movieIds.size(); ++slot) {
+                if (movieIds[slot] != movie->id || !service.bookingSchedule[slot].findSeatsTogether(seatsTogether))
+                    continue;
+                const Theater* theater = service.theaters.findEntryByID(service.bookingSchedule[slot].theaterId).value();
+                found.emplace_back(distanceKm(point, theater->location.value()), theater);
+            }
+            return nearest(found);
+        }));
+
+        report("grid index", 1, measureQueries(points, 100'000, [&](const GeoPoint& point) {
+            return service.findNearestPremieres(movie, point, seatsTogether, resultsLimit).size();
+        }));
+        report("grid index (within 50 km)", 1, measureQueries(points, 100'000, [&](const GeoPoint& point) {
+            return service.findNearestPremieres(movie, point, seatsTogether, resultsLimit, 50.0).size();
+        }));
+    }
+}
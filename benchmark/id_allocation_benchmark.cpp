@@ -0,0 +1,46 @@
+/**
+ * @file       id_allocation_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Unique IDs allocation throughput: shared atomic counter vs per-thread blocks
+ */
+
+#include <atomic>
+
+#include "Benchmarks.h"
+#include "IdAllocator.h"
+
+namespace
+{
+    constexpr size_t idsPerThread { 5'000'000 };
+
+    struct BenchmarkTag {};
+}
+
+namespace Benchmarks
+{
+    void idAllocation()
+    {
+        for (size_t threadsCount: {1u, 2u, 4u, 8u, 16u})
+        {
+            std::atomic<size_t> counter { 0 };
+            report("shared atomic counter", threadsCount, measureThroughput(threadsCount, [&](size_t) {
+                size_t checksum = 0;
+                for (size_t i = 0; i < idsPerThread; ++i)
+                    checksum += counter.fetch_add(1, std::memory_order_relaxed) + 1;
+                return idsPerThread + (0 == checksum);
+            }));
+
+            using Ids = DB::IdAllocator<BenchmarkTag>;
+            Ids::reset();
+            report("IdAllocator (per-thread blocks)", threadsCount, measureThroughput(threadsCount, [&](size_t) {
+                size_t checksum = 0;
+                for (size_t i = 0; i < idsPerThread; ++i)
+                    checksum += Ids::allocate();
+                return idsPerThread + (0 == checksum);
+            }));
+        }
+    }
+}
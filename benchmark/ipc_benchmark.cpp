@@ -0,0 +1,142 @@
+/**
+ * @file       ipc_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Round trips of the co-located client: text commands over the socket vs shared-memory channel
+ */
+
+#include <sstream>
+
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "Benchmarks.h"
+#include "CLI.h"
+#include "SharedMemoryIpc.h"
+
+namespace
+{
+    constexpr size_t textRoundTrips { 20'000 };
+    constexpr size_t ipcRoundTrips { 200'000 };
+
+    bool sendAll(int socketFd, std::string_view data)
+    {
+        while (!data.empty()) {
+            const ssize_t sent = ::write(socketFd, data.data(), data.size());
+            if (sent <= 0)
+                return false;
+            data.remove_prefix(static_cast<size_t>(sent));
+        }
+        return true;
+    }
+
+    /** Reads the response of the text command: terminated by the zero byte **/
+    bool receiveResponse(int socketFd, std::string& response)
+    {
+        response.clear();
+        char buffer[4096];
+        for (;;) {
+            const ssize_t received = ::read(socketFd, buffer, sizeof(buffer));
+            if (received <= 0)
+                return false;
+            response.append(buffer, static_cast<size_t>(received));
+            if ('\0' == response.back())
+                return true;
+        }
+    }
+
+    /** The service process: serves the shared-memory channel and the text commands from the socket till EOF **/
+    [[noreturn]]
+    void runService(int socketFd, const std::string& channelName)
+    {
+        Booking::BookingService service;
+        service.initialize();
+        Ipc::Server server { service };
+        if (!server.addClient(channelName))
+            ::_exit(EXIT_FAILURE);
+
+        std::ostringstream output;
+        CLI::SimpleCLI cli { service, output };
+        if (!sendAll(socketFd, std::string_view { "", 1 }))
+            ::_exit(EXIT_FAILURE);
+
+        std::string input;
+        char buffer[4096];
+        for (ssize_t received; (received = ::read(socketFd, buffer, sizeof(buffer))) > 0; )
+        {
+            input.append(buffer, static_cast<size_t>(received));
+            for (size_t end; std::string::npos != (end = input.find('\n')); input.erase(0, end + 1)) {
+                output.str("");
+                [[maybe_unused]] const CLI::SimpleCLI::Status status =
+                        cli.processCommand(std::string_view { input }.substr(0, end));
+                output << '\0';
+                if (!sendAll(socketFd, output.view()))
+                    ::_exit(EXIT_FAILURE);
+            }
+        }
+        ::_exit(EXIT_SUCCESS);
+    }
+
+    void reportLatency(std::string_view name, double roundTripsPerSecond)
+    {
+        std::cout << std::left << std::setw(40) << name << " round trip: " << std::fixed << std::setprecision(2)
+                  << 1'000'000 / roundTripsPerSecond << " us" << std::endl;
+    }
+}
+
+namespace Benchmarks
+{
+    void ipc()
+    {
+        int sockets[2] { -1, -1 };
+        if (0 != ::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets))
+            return;
+
+        const std::string channelName = "booking-ipc-benchmark-" + std::to_string(::getpid());
+        const pid_t pid = ::fork();
+        if (0 == pid) {
+            ::close(sockets[1]);
+            runService(sockets[0], channelName);
+        }
+        ::close(sockets[0]);
+
+        const int socketFd = sockets[1];
+        std::string response;
+        if (receiveResponse(socketFd, response) &&
+            sendAll(socketFd, "select_theater 4DX\n") && receiveResponse(socketFd, response) &&
+            sendAll(socketFd, "select_movie Terminator\n") && receiveResponse(socketFd, response))
+        {
+            const double textThroughput = measureThroughput(1, [&](size_t) {
+                size_t roundTrips = 0;
+                for (; roundTrips < textRoundTrips; ++roundTrips)
+                    if (!sendAll(socketFd, "list_available_seats\n") || !receiveResponse(socketFd, response))
+                        break;
+                return roundTrips;
+            });
+            report("ipc: text commands over socket", 1, textThroughput);
+            reportLatency("ipc: text commands over socket", textThroughput);
+
+            Ipc::Client client { channelName };
+            const std::optional<uint32_t> theaterId = client.findTheater("4DX");
+            const std::optional<uint32_t> movieId = client.findMovie("Terminator");
+            if (theaterId && movieId)
+            {
+                const double ipcThroughput = measureThroughput(1, [&](size_t) {
+                    size_t roundTrips = 0;
+                    for (; roundTrips < ipcRoundTrips; ++roundTrips)
+                        if (!client.getSeatsAvailable(theaterId.value(), movieId.value()))
+                            break;
+                    return roundTrips;
+                });
+                report("ipc: shared-memory channel", 1, ipcThroughput);
+                reportLatency("ipc: shared-memory channel", ipcThroughput);
+            }
+        }
+
+        ::close(socketFd);
+        ::waitpid(pid, nullptr, 0);
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * @file       listing_cache_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Catalog listing commands: rendered with the flush per line, rendered per request and pre-rendered
+ */
+
+#include <fstream>
+#include <string>
+
+#include "Benchmarks.h"
+#include "CLI.h"
+
+namespace
+{
+    using namespace Booking;
+    using Benchmarks::report;
+
+    constexpr size_t moviesCount { 1'000 };
+    constexpr size_t theatersCount { 100 };
+
+    /** Every movie is scheduled in that many theaters **/
+    constexpr size_t theatersPerMovie { 10 };
+
+    constexpr size_t requestsCount { 2'000 };
+
+    template<typename Request>
+    double measureRequests(Request&& request)
+    {
+        const Benchmarks::Clock::time_point start = Benchmarks::Clock::now();
+        for (size_t idx = 0; idx < requestsCount; ++idx)
+            request();
+        const std::chrono::duration<double> elapsed = Benchmarks::Clock::now() - start;
+        return static_cast<double>(requestsCount) / elapsed.count();
+    }
+
+    /** The former list_movies: the catalog walk and the std::endl (flush) per line **/
+    void listMoviesFlushing(const BookingService& service, std::ostream& out)
+    {
+        for (const auto& movie: service.getMoviesView())
+            out << '\t' << movie->name << std::endl;
+    }
+
+    /** The former find_theaters **/
+    void findTheatersFlushing(const BookingService& service, std::ostream& out, const std::string& movieName)
+    {
+        const std::vector<Theater*> allTheaters = service.getTheatersByMovie(movieName);
+        out << "The movie '" << movieName << "' is being shown in:\n";
+        for (const auto& theater: allTheaters)
+            out << '\t' << theater->name << std::endl;
+    }
+}
+
+namespace Benchmarks
+{
+    void listingCache()
+    {
+        BookingService service;
+        for (size_t idx = 0; idx < theatersCount; ++idx)
+            service.addTheater("Theater " + std::to_string(idx));
+        for (size_t idx = 0; idx < moviesCount; ++idx)
+        {
+            const std::string name = "Movie " + std::to_string(idx);
+            service.addMovie(name, MovieInfo { static_cast<Genre>(idx % (static_cast<size_t>(Genre::Thriller) + 1)),
+                                               Rating::PG13, "en", Format::Standard, 120 });
+            for (size_t theater = 0; theater < theatersPerMovie; ++theater)
+                service.scheduleMovie(name, "Theater " + std::to_string((idx + theater * 7) % theatersCount));
+        }
+
+        // The responses are written to the file: each flush is the write system call, as with the socket
+        std::ofstream out { "/dev/null" };
+        CLI::ResponseCache noCache { 0 };
+        CLI::SimpleCLI renderingCli { service, out }, cachedCli { service, out };
+        renderingCli.setResponseCache(noCache);
+
+        report("list_movies: std::endl per line", 1, measureRequests([&] {
+            listMoviesFlushing(service, out);
+        }));
+        report("list_movies: rendered per request", 1, measureRequests([&] {
+            [[maybe_unused]] const auto status = renderingCli.processCommand("list_movies");
+        }));
+        report("list_movies: pre-rendered", 1, measureRequests([&] {
+            [[maybe_unused]] const auto status = cachedCli.processCommand("list_movies");
+        }));
+
+        report("list_movies genre=drama: rendered", 1, measureRequests([&] {
+            [[maybe_unused]] const auto status = renderingCli.processCommand("list_movies genre=drama");
+        }));
+        report("list_movies genre=drama: pre-rendered", 1, measureRequests([&] {
+            [[maybe_unused]] const auto status = cachedCli.processCommand("list_movies genre=drama");
+        }));
+
+        const std::string movieName { "Movie 7" };
+        report("find_theaters: std::endl per line", 1, measureRequests([&] {
+            findTheatersFlushing(service, out, movieName);
+        }));
+        report("find_theaters: rendered per request", 1, measureRequests([&] {
+            [[maybe_unused]] const auto status = renderingCli.processCommand("find_theaters Movie 7");
+        }));
+        report("find_theaters: pre-rendered", 1, measureRequests([&] {
+            [[maybe_unused]] const auto status = cachedCli.processCommand("find_theaters Movie 7");
+        }));
+    }
+}
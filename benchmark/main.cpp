@@ -0,0 +1,68 @@
+/**
+ * @file       main.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Benchmarks runner
+ */
+
+#include <iostream>
+#include <string_view>
+#include <unordered_map>
+
+#include "Benchmarks.h"
+
+namespace
+{
+    using namespace std::string_view_literals;
+
+    const std::unordered_map<std::string_view, void(*)()> benchmarks
+    {
+        {"booking_contention"sv, &Benchmarks::bookingContention},
+        {"sharded_service"sv, &Benchmarks::shardedService},
+        {"async_service"sv, &Benchmarks::asyncService},
+        {"search"sv, &Benchmarks::search},
+        {"id_allocation"sv, &Benchmarks::idAllocation},
+        {"premiere_layout"sv, &Benchmarks::premiereLayout},
+        {"change_stream"sv, &Benchmarks::changeStream},
+        {"seats_subscription"sv, &Benchmarks::seatsSubscription},
+        {"admission"sv, &Benchmarks::admission},
+        {"replication"sv, &Benchmarks::replication},
+        {"ipc"sv, &Benchmarks::ipc},
+        {"tracing"sv, &Benchmarks::tracing},
+        {"seat_maps"sv, &Benchmarks::seatMaps},
+        {"geo_index"sv, &Benchmarks::geoIndex},
+        {"movie_filters"sv, &Benchmarks::movieFilters},
+        {"trending"sv, &Benchmarks::trending},
+        {"listing_cache"sv, &Benchmarks::listingCache},
+        {"pricing"sv, &Benchmarks::pricing},
+    };
+}
+
+/**
+ * Usage: ./benchmark/benchmarks [benchmark_name ...] <br>
+ * Runs all the benchmarks if no names specified
+ */
+int main(int argc, char** argv)
+{
+    if (1 == argc) {
+        for (const auto& [name, benchmark]: benchmarks) {
+            std::cout << "[" << name << "]\n";
+            benchmark();
+        }
+        return EXIT_SUCCESS;
+    }
+
+    for (int idx = 1; idx < argc; ++idx)
+    {
+        if (const auto iter = benchmarks.find(argv[idx]); benchmarks.end() != iter) {
+            std::cout << "[" << iter->first << "]\n";
+            iter->second();
+        } else {
+            std::cerr << "Unknown benchmark '" << argv[idx] << "'\n";
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
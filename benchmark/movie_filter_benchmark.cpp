@@ -0,0 +1,103 @@
+/**
+ * @file       movie_filter_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Filtered listings of 1M movies: the attributes bitmaps intersections vs the scans of the catalog
+ */
+
+#include <array>
+#include <random>
+#include <string>
+#include <unordered_set>
+
+#include "Benchmarks.h"
+#include "BookingService.h"
+
+namespace
+{
+    using namespace Booking;
+    using Benchmarks::report;
+
+    constexpr size_t moviesCount { 1'000'000 };
+    constexpr size_t theatersCount { 100 };
+
+    /** Every playingEvery-th movie is scheduled **/
+    constexpr size_t playingEvery { 10 };
+
+    template<typename Query>
+    double measureQueries(size_t queriesCount, Query&& query)
+    {
+        size_t found = 0;
+        const Benchmarks::Clock::time_point start = Benchmarks::Clock::now();
+        for (size_t idx = 0; idx < queriesCount; ++idx)
+            found += query().size();
+        const std::chrono::duration<double> elapsed = Benchmarks::Clock::now() - start;
+        if (0 == found)
+            std::cout << "No results found\n";
+        return static_cast<double>(queriesCount) / elapsed.count();
+    }
+
+    MovieInfo makeInfo(std::mt19937& generator)
+    {
+        constexpr std::array languages { "en", "en", "en", "en", "fr", "de", "es", "hi", "ja", "ko" };
+        std::discrete_distribution<int> formatDist { 70, 20, 10 };
+        return MovieInfo { static_cast<Genre>(generator() % (static_cast<size_t>(Genre::Thriller) + 1)),
+                           static_cast<Rating>(generator() % (static_cast<size_t>(Rating::NC17) + 1)),
+                           languages[generator() % languages.size()],
+                           static_cast<Format>(formatDist(generator)),
+                           static_cast<uint16_t>(80 + generator() % 120) };
+    }
+
+    /** The former way: the set of the scheduled movies, then the scan of the whole catalog **/
+    std::vector<Movie*> scanMovies(const BookingService& service, const MovieFilter& filter)
+    {
+        const std::span<const size_t> scheduledMovieIds = service.bookingSchedule.getMovieIds();
+        const std::unordered_set<size_t> playing(scheduledMovieIds.begin(), scheduledMovieIds.end());
+
+        std::vector<Movie*> found;
+        for (Movie* const movie: service.getMoviesView())
+        {
+            const MovieInfo& info = movie->info;
+            if ((!filter.playingOnly || playing.contains(movie->id)) &&
+                (!filter.genre || filter.genre == info.genre) && (!filter.rating || filter.rating == info.rating) &&
+                (!filter.format || filter.format == info.format) && (!filter.language || filter.language == info.language))
+                found.push_back(movie);
+        }
+        return found;
+    }
+}
+
+namespace Benchmarks
+{
+    void movieFilters()
+    {
+        std::mt19937 generator { 42 };
+        BookingService service;
+        for (size_t idx = 0; idx < theatersCount; ++idx)
+            service.addTheater("Theater " + std::to_string(idx));
+        for (size_t idx = 0; idx < moviesCount; ++idx)
+        {
+            const std::string name = "Movie " + std::to_string(idx);
+            service.addMovie(name, makeInfo(generator));
+            if (0 == idx % playingEvery)
+                service.scheduleMovie(name, "Theater " + std::to_string(idx / playingEvery % theatersCount));
+        }
+
+        const MovieFilter playing { true, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt };
+        const MovieFilter comedyImaxEnglish { true, Genre::Comedy, std::nullopt, "en", Format::IMAX, std::nullopt };
+        const MovieFilter dramaRated { false, Genre::Drama, Rating::R, std::nullopt, std::nullopt, std::nullopt };
+        for (const auto& [name, filter]: {std::pair { "playing", playing },
+                                          std::pair { "playing, comedy, IMAX, English", comedyImaxEnglish },
+                                          std::pair { "drama, rated R", dramaRated }})
+        {
+            report(std::string { name } + ": scan", 1, measureQueries(10, [&] {
+                return scanMovies(service, filter);
+            }));
+            report(std::string { name } + ": bitmaps", 1, measureQueries(100, [&] {
+                return service.getMovies(filter);
+            }));
+        }
+    }
+}
@@ -0,0 +1,119 @@
+/**
+ * @file       premiere_layout_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Premieres storage: vector of std::shared_ptr vs contiguous cache-line aware PremiereSchedule
+ */
+
+#include <deque>
+#include <memory>
+#include <random>
+
+#include "Benchmarks.h"
+#include "BookingService.h"
+
+namespace
+{
+    using namespace Booking;
+
+    constexpr size_t premieresCount { 100'000 };
+    constexpr size_t lookupsCount { 2'000 };
+    constexpr size_t bookingsPerThread { 1'000'000 };
+
+    /** The former Premiere layout: the IDs, the seats and the lock packed together in a separate heap object **/
+    struct LegacyPremiere
+    {
+        size_t theaterId { 0 };
+        size_t movieId { 0 };
+        std::array<SeatStatus, Theater::seatsCapacityMax> seats {};
+        std::mutex mtxBooking;
+
+        LegacyPremiere(size_t theaterId, size_t movieId): theaterId { theaterId }, movieId { movieId } {
+        }
+    };
+
+    void toggleFirstSeat(LegacyPremiere& premiere) noexcept {
+        premiere.seats[0] = SeatStatus::Booked == premiere.seats[0] ? SeatStatus::Available : SeatStatus::Booked;
+    }
+
+    void toggleFirstSeat(Premiere& premiere) noexcept
+    {
+        constexpr uint16_t seat { 1 };
+        if (!premiere.seats.book(std::span<const uint16_t> { &seat, 1 }))
+            premiere.seats.release(seat);
+    }
+
+    /** Books the seat and releases it back, so that the premiere never sells out during the run **/
+    template<typename PremiereType>
+    size_t bookAndRelease(PremiereType& premiere)
+    {
+        for (size_t i = 0; i < bookingsPerThread; ++i)
+        {
+            std::lock_guard<std::mutex> lock { premiere.mtxBooking };
+            toggleFirstSeat(premiere);
+        }
+        return bookingsPerThread;
+    }
+}
+
+namespace Benchmarks
+{
+    void premiereLayout()
+    {
+        const Theater theater { "Theater" };
+        std::mt19937 generator { 42 };
+        std::uniform_int_distribution<size_t> sizeDist { 16, 256 };
+
+        // The legacy premieres are allocated interleaved with the other catalog data, like in the running service
+        std::vector<std::shared_ptr<LegacyPremiere>> legacy;
+        std::vector<std::string> catalogData;
+        std::deque<Movie> movies;
+        PremiereSchedule schedule;
+        for (size_t idx = 0; idx < premieresCount; ++idx) {
+            const Movie& movie = movies.emplace_back("Movie");
+            legacy.push_back(std::make_shared<LegacyPremiere>(theater.id, movie.id));
+            catalogData.emplace_back(sizeDist(generator), 'x');
+            schedule.add(theater, movie);
+        }
+
+        std::uniform_int_distribution<size_t> movieDist { 0, premieresCount - 1 };
+        std::vector<size_t> lookups(lookupsCount);
+        for (size_t& movieId: lookups)
+            movieId = movies[movieDist(generator)].id;
+
+        report("scan: vector<shared_ptr<Premiere>>", 1, measureThroughput(1, [&](size_t) {
+            size_t found = 0;
+            for (const size_t movieId: lookups)
+                for (const auto& premiere: legacy)
+                    if (premiere->movieId == movieId && premiere->theaterId == theater.id) {
+                        ++found;
+                        break;
+                    }
+            return found;
+        }));
+
+        report("scan: PremiereSchedule (SoA)", 1, measureThroughput(1, [&](size_t) {
+            size_t found = 0;
+            for (const size_t movieId: lookups)
+                found += nullptr != schedule.find(theater.id, movieId);
+            return found;
+        }));
+
+        for (size_t threadsCount: {1u, 2u, 4u, 8u})
+        {
+            // Each thread books its own premiere: the neighbouring legacy premieres share the cache lines
+            std::vector<std::shared_ptr<LegacyPremiere>> neighbours;
+            for (size_t idx = 0; idx < threadsCount; ++idx)
+                neighbours.push_back(std::make_shared<LegacyPremiere>(theater.id, idx));
+            report("neighbours: shared_ptr<Premiere>", threadsCount, measureThroughput(threadsCount, [&](size_t idx) {
+                return bookAndRelease(*neighbours[idx]);
+            }));
+
+            report("neighbours: PremiereSchedule", threadsCount, measureThroughput(threadsCount, [&](size_t idx) {
+                return bookAndRelease(schedule[idx]);
+            }));
+        }
+    }
+}
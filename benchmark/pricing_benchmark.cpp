@@ -0,0 +1,117 @@
+/**
+ * @file       pricing_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Repricing of 100k premieres: the external job polling the seats vs the batched PricingEngine
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include "Benchmarks.h"
+#include "BookingService.h"
+
+namespace
+{
+    using namespace Booking;
+    using Benchmarks::report;
+
+    constexpr size_t theatersCount { 1'000 };
+    constexpr size_t moviesCount { 100 };
+    constexpr size_t batchesCount { 20 };
+
+    /** The former way: the job polls the seats available of the each premiere and applies the rules to it **/
+    size_t repricePolling(const BookingService& service,
+                          const PricingRules& rules,
+                          PricingEngine::Clock::time_point now)
+    {
+        size_t repriced = 0;
+        for (Premiere& premiere: service.bookingSchedule)
+        {
+            const std::vector<uint16_t> seatsAvailable = premiere.getSeatsAvailable();
+            const float occupancy = 1.0f - static_cast<float>(seatsAvailable.size()) / Theater::seatsCapacityMax;
+            const std::chrono::duration<float, std::ratio<3'600>> hoursLeft =
+                    std::chrono::sys_seconds { std::chrono::seconds { premiere.showtime.load() } } - now;
+
+            float factor = 1.0f;
+            for (const OccupancyRule& rule: rules.occupancy)
+                if (occupancy >= rule.occupancyMin)
+                    factor *= rule.factor;
+            for (const LeadTimeRule& rule: rules.leadTime)
+                if (hoursLeft.count() <= rule.hoursMax)
+                    factor *= rule.factor;
+            factor = std::clamp(factor, rules.factorMin, rules.factorMax);
+            premiere.priceFactor.store(static_cast<uint32_t>(factor * PricingEngine::factorBase + 0.5f));
+            ++repriced;
+        }
+        return repriced;
+    }
+
+    template<typename Batch>
+    double measureBatches(const BookingService& service, Batch&& batch)
+    {
+        const Benchmarks::Clock::time_point start = Benchmarks::Clock::now();
+        for (size_t idx = 0; idx < batchesCount; ++idx)
+            batch();
+        const std::chrono::duration<double> elapsed = Benchmarks::Clock::now() - start;
+        return static_cast<double>(batchesCount * service.bookingSchedule.size()) / elapsed.count();
+    }
+}
+
+namespace Benchmarks
+{
+    void pricing()
+    {
+        BookingService service;
+        for (size_t idx = 0; idx < theatersCount; ++idx)
+            service.addTheater("Theater " + std::to_string(idx));
+        for (size_t idx = 0; idx < moviesCount; ++idx)
+            service.addMovie("Movie " + std::to_string(idx));
+        for (size_t theater = 0; theater < theatersCount; ++theater)
+            for (size_t movie = 0; movie < moviesCount; ++movie)
+                service.scheduleMovie("Movie " + std::to_string(movie), "Theater " + std::to_string(theater));
+
+        // The occupancy and the showtimes of the premieres vary
+        std::mt19937 generator { 42 };
+        const PricingEngine::Clock::time_point now = PricingEngine::Clock::now();
+        for (Premiere& premiere: service.bookingSchedule) {
+            const uint16_t seatsBooked = static_cast<uint16_t>(generator() % (Theater::seatsCapacityMax + 1));
+            for (uint16_t seat = 1; seat <= seatsBooked; ++seat)
+                [[maybe_unused]] const bool booked = premiere.bookSeats(std::vector<uint16_t> {seat});
+            premiere.setShowtime(now + std::chrono::minutes { generator() % (48 * 60) });
+        }
+
+        const PricingRules rules { { OccupancyRule { 0.5f, 1.1f }, OccupancyRule { 0.8f, 1.25f } },
+                                   { LeadTimeRule { 24.0f, 1.1f }, LeadTimeRule { 2.0f, 1.2f } } };
+        service.pricing.setRules(rules);
+
+        report("reprice: poll the seats, per premiere", 1, measureBatches(service, [&] {
+            return repricePolling(service, rules, now);
+        }));
+        report("reprice: PricingEngine batch", 1, measureBatches(service, [&] {
+            return service.pricing.reprice(service.bookingSchedule, now, true);
+        }));
+
+        // The price of the booking: the quote is taken under the booking lock
+        Premiere& premiere = service.bookingSchedule[0];
+        const std::vector<uint16_t> seats { 1, 2 };
+        constexpr size_t bookingsCount { 1'000'000 };
+        for (const auto& [name, priced]: {std::pair { "booking: bookSeats", false },
+                                          std::pair { "booking: bookSeatsPriced", true }})
+        {
+            const Benchmarks::Clock::time_point start = Benchmarks::Clock::now();
+            uint64_t price = 0;
+            for (size_t idx = 0; idx < bookingsCount; ++idx) {
+                premiere.seats.reset();
+                price += priced ? premiere.bookSeatsPriced(seats).quote.price : premiere.bookSeats(seats);
+            }
+            const std::chrono::duration<double> elapsed = Benchmarks::Clock::now() - start;
+            if (0 == price)
+                std::cout << "No bookings\n";
+            report(name, 1, static_cast<double>(bookingsCount) / elapsed.count());
+        }
+    }
+}
@@ -0,0 +1,90 @@
+/**
+ * @file       replication_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Primary/follower replication between two processes: throughput and replication lag
+ */
+
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "Benchmarks.h"
+#include "Replication.h"
+
+namespace
+{
+    using namespace Replication;
+
+    constexpr size_t theatersCount { 1'000 };
+
+    void populate(Booking::BookingService& service)
+    {
+        service.addMovie("Movie");
+        for (size_t idx = 0; idx < theatersCount; ++idx) {
+            service.addTheater("Theater " + std::to_string(idx));
+            service.scheduleMovie("Movie", "Theater " + std::to_string(idx));
+        }
+    }
+
+    /** The primary process: books every seat of every premiere, one seat per booking **/
+    [[noreturn]]
+    void runPrimary(int socketFd)
+    {
+        Booking::BookingService service;
+        populate(service);
+        Primary primary { service, 1ms };
+        primary.attach(socketFd);
+
+        for (uint16_t seat = 1; seat <= Booking::Theater::seatsCapacityMax; ++seat)
+            for (Booking::Premiere& premiere: service.bookingSchedule)
+                [[maybe_unused]] const bool booked = premiere.bookSeats(std::span<const uint16_t> { &seat, 1 });
+        while (primary.followersCount() > 0)
+            std::this_thread::sleep_for(1ms);
+        ::_exit(EXIT_SUCCESS);
+    }
+}
+
+namespace Benchmarks
+{
+    void replication()
+    {
+        int sockets[2] { -1, -1 };
+        if (0 != ::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets))
+            return;
+
+        const Clock::time_point start = Clock::now();
+        const pid_t pid = ::fork();
+        if (0 == pid) {
+            ::close(sockets[1]);
+            runPrimary(sockets[0]);
+        }
+        ::close(sockets[0]);
+
+        LagStatistics lag;
+        uint64_t recordsCount = 0;
+        {
+            Follower follower { sockets[1], 1s };
+            const std::string lastTheater = "Theater " + std::to_string(theatersCount - 1);
+            for (;;) {
+                const std::optional<std::vector<Booking::Theater*>> theaters = follower.getTheatersByMovie("Movie");
+                const std::optional<std::vector<uint16_t>> seats = follower.getSeatsAvailable(lastTheater, "Movie");
+                if (theaters && theatersCount == theaters->size() && seats && seats->empty())
+                    break;
+                std::this_thread::sleep_for(100us);
+            }
+            lag = follower.getLag();
+            recordsCount = follower.appliedLsn();
+        }
+        const std::chrono::duration<double> elapsed = Clock::now() - start;
+        ::waitpid(pid, nullptr, 0);
+
+        report("replication: records applied", 1, static_cast<double>(recordsCount) / elapsed.count());
+        std::cout << std::left << std::setw(40) << "replication: lag" << " records: " << recordsCount
+                  << ", mean: " << std::chrono::duration_cast<std::chrono::microseconds>(lag.mean()).count()
+                  << " us, max: " << std::chrono::duration_cast<std::chrono::microseconds>(lag.max).count()
+                  << " us" << std::endl;
+    }
+}
@@ -0,0 +1,95 @@
+/**
+ * @file       search_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Prefix and fuzzy search latency over a catalog of 1M titles
+ */
+
+#include <random>
+#include <format>
+
+#include "Benchmarks.h"
+#include "SearchIndex.h"
+
+namespace
+{
+    constexpr size_t titlesCount { 1'000'000 };
+    constexpr size_t queriesCount { 10'000 };
+    constexpr size_t resultsLimit { 10 };
+
+    constexpr size_t vocabularySize { 20'000 };
+
+    std::vector<std::string> makeVocabulary(std::mt19937& generator)
+    {
+        constexpr std::string_view consonants { "bcdfghjklmnprstvwz" }, vowels { "aeiouy" };
+        std::uniform_int_distribution<size_t> syllablesDist { 2, 4 };
+        std::vector<std::string> vocabulary(vocabularySize);
+        for (std::string& word: vocabulary)
+            for (size_t idx = 0, syllables = syllablesDist(generator); idx < syllables; ++idx)
+                word.append(1, consonants[generator() % consonants.size()]).append(1, vowels[generator() % vowels.size()]);
+        return vocabulary;
+    }
+
+    std::string makeTitle(const std::vector<std::string>& vocabulary, std::mt19937& generator)
+    {
+        std::uniform_int_distribution<size_t> wordDist { 0, vocabulary.size() - 1 };
+        std::uniform_int_distribution<size_t> lengthDist { 1, 5 };
+        std::string title;
+        for (size_t idx = 0, length = lengthDist(generator); idx < length; ++idx)
+            title.append(idx ? " " : "").append(vocabulary[wordDist(generator)]);
+        return title;
+    }
+
+    template<typename Search>
+    double measureQueries(const std::vector<std::string>& queries, Search&& search)
+    {
+        size_t found = 0;
+        const Benchmarks::Clock::time_point start = Benchmarks::Clock::now();
+        for (const std::string& query: queries)
+            found += search(query).size();
+        const std::chrono::duration<double> elapsed = Benchmarks::Clock::now() - start;
+        if (0 == found)
+            std::cout << "No results found\n";
+        return static_cast<double>(queries.size()) / elapsed.count();
+    }
+}
+
+namespace Benchmarks
+{
+    void search()
+    {
+        std::mt19937 generator { 42 };
+        const std::vector<std::string> vocabulary = makeVocabulary(generator);
+        DB::SearchIndex index;
+        std::vector<std::string> titles;
+        for (size_t id = 1; id <= titlesCount; ++id)
+            index.add(titles.emplace_back(makeTitle(vocabulary, generator)), id);
+
+        const Clock::time_point buildStart = Clock::now();
+        [[maybe_unused]] const auto warmUp = index.searchPrefix("lord", 1);
+        std::cout << "Index built in "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - buildStart).count()
+                  << " ms\n";
+
+        std::uniform_int_distribution<size_t> titleDist { 0, titles.size() - 1 };
+        std::vector<std::string> prefixes, misspelled;
+        for (size_t idx = 0; idx < queriesCount; ++idx)
+        {
+            const std::string& title = titles[titleDist(generator)];
+            prefixes.push_back(title.substr(0, 3));
+
+            std::string typo = title;
+            std::swap(typo[1], typo[2]);
+            misspelled.push_back(std::move(typo));
+        }
+
+        report("prefix search (top-10)", 1, measureQueries(prefixes, [&](const std::string& query) {
+            return index.searchPrefix(query, resultsLimit);
+        }));
+        report("fuzzy search (top-10)", 1, measureQueries(misspelled, [&](const std::string& query) {
+            return index.searchFuzzy(query, resultsLimit);
+        }));
+    }
+}
@@ -0,0 +1,148 @@
+/**
+ * @file       seat_map_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Seat maps of each capacity class vs the byte per seat array: bookings and available seats scans
+ */
+
+#include <mutex>
+#include <string>
+
+#include "Benchmarks.h"
+#include "SeatMap.h"
+#include "BookingService.h"
+
+namespace
+{
+    using namespace Booking;
+    using Benchmarks::measureThroughput;
+    using Benchmarks::report;
+
+    constexpr size_t bookingsPerThread { 1'000'000 };
+    constexpr size_t scansCount { 100'000 };
+
+    /** The former seats layout: a byte per seat, booked in place with the rollback on failure **/
+    class ByteSeatMap
+    {
+        std::vector<SeatStatus> seats;
+
+    public:
+
+        explicit ByteSeatMap(size_t capacity): seats(capacity, SeatStatus::Available) {
+        }
+
+        [[nodiscard]]
+        size_t capacity() const noexcept {
+            return seats.size();
+        }
+
+        bool bookExclusive(std::span<const uint16_t> seatsToBook) noexcept
+        {
+            for (size_t idx = 0; idx < seatsToBook.size(); ++idx)
+            {
+                const uint16_t seatNum = seatsToBook[idx];
+                if (0 == seatNum || seatNum > seats.size() || SeatStatus::Booked == seats[seatNum - 1]) {
+                    for (size_t rollbackIdx = 0; rollbackIdx < idx; ++rollbackIdx)
+                        seats[seatsToBook[rollbackIdx] - 1] = SeatStatus::Available;
+                    return false;
+                }
+                seats[seatNum - 1] = SeatStatus::Booked;
+            }
+            return true;
+        }
+
+        void reset() noexcept {
+            std::fill(seats.begin(), seats.end(), SeatStatus::Available);
+        }
+
+        template<typename Callback>
+        void forEachAvailable(Callback&& callback) const
+        {
+            for (uint16_t seatNum = 1; SeatStatus status: seats) {
+                if (SeatStatus::Available == status)
+                    callback(seatNum);
+                ++seatNum;
+            }
+        }
+    };
+
+    /** The pairs of the neighbouring seats are booked till the hall is sold out, then the hall is emptied **/
+    template<typename SeatMap, bool Locked = true>
+    size_t bookPairs(SeatMap& seatMap, std::mutex& mtx)
+    {
+        const uint16_t capacity = static_cast<uint16_t>(seatMap.capacity());
+        for (size_t idx = 0; idx < bookingsPerThread; ++idx)
+        {
+            const uint16_t first = static_cast<uint16_t>(idx * 2 % (capacity - 1) + 1);
+            const std::array<uint16_t, 2> seats { first, static_cast<uint16_t>(first + 1) };
+            if constexpr (Locked) {
+                std::lock_guard<std::mutex> lock { mtx };
+                if (!seatMap.bookExclusive(seats))
+                    seatMap.reset();
+            } else if (!seatMap.book(seats)) {
+                std::lock_guard<std::mutex> lock { mtx };
+                seatMap.reset();
+            }
+        }
+        return bookingsPerThread;
+    }
+
+    /** The scans of the hall with every other seat booked **/
+    template<typename SeatMap>
+    size_t scanAvailable(SeatMap& seatMap)
+    {
+        for (uint16_t seat = 1; seat <= seatMap.capacity(); seat += 2)
+            seatMap.bookExclusive(std::span<const uint16_t> { &seat, 1 });
+
+        std::vector<uint16_t> available;
+        available.reserve(seatMap.capacity());
+        size_t found = 0;
+        for (size_t idx = 0; idx < scansCount; ++idx) {
+            available.clear();
+            seatMap.forEachAvailable([&available](uint16_t seat) { available.push_back(seat); });
+            found += available.size();
+        }
+        return found > 0 ? scansCount : 0;
+    }
+
+    template<typename SeatMap>
+    void run(const std::string& name, size_t capacity, size_t threadsCount)
+    {
+        std::mutex mtx;
+        SeatMap seatMap { capacity };
+        report("seats " + std::to_string(capacity) + ": " + name, threadsCount,
+               measureThroughput(threadsCount, [&](size_t) { return bookPairs(seatMap, mtx); }));
+        if (1 == threadsCount) {
+            SeatMap scanned { capacity };
+            report("seats " + std::to_string(capacity) + ": " + name + " scan", 1,
+                   measureThroughput(1, [&](size_t) { return scanAvailable(scanned); }));
+        }
+    }
+}
+
+namespace Benchmarks
+{
+    void seatMaps()
+    {
+        for (const size_t threads: {1, 4})
+        {
+            run<ByteSeatMap>("byte array", Theater::seatsCapacityMax, threads);
+            run<SmallSeatMap<Theater::seatsCapacityMax>>("single word", Theater::seatsCapacityMax, threads);
+
+            std::mutex mtx;
+            SmallSeatMap<Theater::seatsCapacityMax> lockFree;
+            report("seats " + std::to_string(Theater::seatsCapacityMax) + ": single word CAS", threads,
+                   measureThroughput(threads, [&](size_t) {
+                       return bookPairs<decltype(lockFree), false>(lockFree, mtx);
+                   }));
+
+            run<ByteSeatMap>("byte array", 500, threads);
+            run<FixedSeatMap<500>>("fixed bitset", 500, threads);
+
+            run<ByteSeatMap>("byte array", 5000, threads);
+            run<DynamicSeatMap>("dynamic bitset", 5000, threads);
+        }
+    }
+}
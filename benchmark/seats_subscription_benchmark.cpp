@@ -0,0 +1,71 @@
+/**
+ * @file       seats_subscription_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Live seat map watchers: the full seats list re-fetch vs the delta subscriptions
+ */
+
+#include "Benchmarks.h"
+#include "BookingService.h"
+
+namespace
+{
+    using namespace Booking;
+
+    constexpr size_t watchersCount { 100'000 };
+    constexpr size_t roundsCount { 20 };
+
+    /** Toggles the seat, so that the hot premiere keeps changing and never sells out **/
+    void toggleSeat(Premiere& premiere, size_t round)
+    {
+        std::lock_guard<std::mutex> lock { premiere.mtxBooking };
+        const uint16_t seat = static_cast<uint16_t>(round % Theater::seatsCapacityMax + 1);
+        if (!premiere.seats.book(std::span<const uint16_t> { &seat, 1 }))
+            premiere.seats.release(seat);
+        premiere.publishOccupancy();
+    }
+
+    void reportBytes(std::string_view name, size_t bytes, size_t updates)
+    {
+        std::cout << std::left << std::setw(40) << name << " bytes per update: " << std::right
+                  << std::setprecision(1) << static_cast<double>(bytes) / static_cast<double>(updates) << std::endl;
+    }
+}
+
+namespace Benchmarks
+{
+    void seatsSubscription()
+    {
+        const Theater theater { "Theater" };
+        const Movie movie { "Movie" };
+        Premiere premiere { theater, movie };
+
+        // Every watcher refreshes its seat map after each change of the hot premiere
+        size_t bytes = 0;
+        report("watchers: getSeatsAvailable()", 1, measureThroughput(1, [&](size_t) {
+            for (size_t round = 0; round < roundsCount; ++round) {
+                toggleSeat(premiere, round);
+                for (size_t idx = 0; idx < watchersCount; ++idx)
+                    bytes += premiere.getSeatsAvailable().size() * sizeof(uint16_t);
+            }
+            return roundsCount * watchersCount;
+        }));
+        reportBytes("watchers: getSeatsAvailable()", bytes, roundsCount * watchersCount);
+
+        std::vector<SeatsSubscription> watchers(watchersCount, SeatsSubscription { premiere,
+                                                                                    premiere.seatsVersion.load() });
+        bytes = 0;
+        report("watchers: SeatsSubscription", 1, measureThroughput(1, [&](size_t) {
+            for (size_t round = 0; round < roundsCount; ++round) {
+                toggleSeat(premiere, round);
+                for (SeatsSubscription& watcher: watchers)
+                    if (const std::optional<SeatsUpdate> update = watcher.poll())
+                        bytes += sizeof(update->version) + sizeof(update->seatsDelta);
+            }
+            return roundsCount * watchersCount;
+        }));
+        reportBytes("watchers: SeatsSubscription", bytes, roundsCount * watchersCount);
+    }
+}
@@ -0,0 +1,84 @@
+/**
+ * @file       sharded_service_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Throughput of the ShardedBookingService depending on the number of shards
+ */
+
+#include <random>
+#include <format>
+
+#include "Benchmarks.h"
+#include "ShardedBookingService.h"
+
+namespace
+{
+    using namespace Booking;
+
+    constexpr size_t theatersCount { 64 };
+    constexpr size_t moviesCount { 16 };
+    constexpr size_t requestsPerClient { 100'000 };
+
+    /** Number of requests each client keeps in flight before waiting for the results **/
+    constexpr size_t pipelineDepth { 64 };
+
+    void populate(BookingService& service)
+    {
+        for (size_t idx = 0; idx < moviesCount; ++idx)
+            service.addMovie(std::format("Movie {}", idx));
+        for (size_t idx = 0; idx < theatersCount; ++idx) {
+            service.addTheater(std::format("Theater {}", idx));
+            for (size_t movieIdx = 0; movieIdx < moviesCount; ++movieIdx)
+                service.scheduleMovie(std::format("Movie {}", movieIdx), std::format("Theater {}", idx));
+        }
+    }
+
+    size_t runClient(ShardedBookingService& sharded,
+                     const std::vector<std::pair<size_t, size_t>>& premieres,
+                     size_t clientIdx)
+    {
+        std::mt19937 generator { static_cast<uint32_t>(clientIdx) };
+        std::uniform_int_distribution<size_t> premiereDist { 0, premieres.size() - 1 };
+        std::uniform_int_distribution<uint16_t> seatDist { 1, Theater::seatsCapacityMax };
+
+        std::vector<std::future<bool>> inFlight;
+        inFlight.reserve(pipelineDepth);
+        for (size_t done = 0; done < requestsPerClient; done += pipelineDepth)
+        {
+            for (size_t i = 0; i < pipelineDepth; ++i) {
+                const auto& [theaterId, movieId] = premieres[premiereDist(generator)];
+                inFlight.push_back(sharded.bookSeats(theaterId, movieId, {seatDist(generator)}));
+            }
+            for (std::future<bool>& result: inFlight)
+                result.wait();
+            inFlight.clear();
+        }
+        return requestsPerClient;
+    }
+}
+
+namespace Benchmarks
+{
+    void shardedService()
+    {
+        BookingService service;
+        populate(service);
+
+        std::vector<std::pair<size_t, size_t>> premieres;
+        for (const Premiere& premiere: service.bookingSchedule)
+            premieres.emplace_back(premiere.theaterId, premiere.movieId);
+
+        const size_t coresCount = std::max(1u, std::thread::hardware_concurrency());
+        for (size_t shardsCount = 1; shardsCount <= coresCount; shardsCount *= 2)
+        {
+            ShardedBookingService sharded { service, shardsCount };
+            const size_t clientsCount = shardsCount;
+            const double throughput = measureThroughput(clientsCount, [&](size_t clientIdx) {
+                return runClient(sharded, premieres, clientIdx);
+            });
+            report(std::format("sharded ({} shards)", shardsCount), clientsCount, throughput);
+        }
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * @file       tracing_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Cost of the tracing spans on the booking path: disabled, sampled and tracing every request
+ */
+
+#include <array>
+
+#include "Benchmarks.h"
+#include "BookingService.h"
+#include "Tracing.h"
+
+namespace
+{
+    constexpr size_t requestsPerThread { 1'000'000 };
+
+    /** The request: four spans (the root, the lookup, the booking and the lock wait) **/
+    size_t runRequests(Booking::BookingService& service, const Booking::Theater* theater, const Booking::Movie* movie)
+    {
+        constexpr std::array<uint16_t, 1> seats { 1 };
+        size_t requests = 0;
+        for (; requests < requestsPerThread; ++requests) {
+            const Tracing::Span span { "request" };
+            const std::optional<Booking::BookingService::PremierePtr> premiere = service.getPremiere(theater, movie);
+            if (!premiere)
+                break;
+            // The seat is booked already: the request still takes the lock
+            [[maybe_unused]] const bool booked = premiere.value()->bookSeats(seats);
+        }
+        return requests;
+    }
+}
+
+namespace Benchmarks
+{
+    void tracing()
+    {
+        Booking::BookingService service;
+        service.initialize();
+        const Booking::Theater* theater = service.theaters.findEntryName("4DX").value();
+        const Booking::Movie* movie = service.movies.findEntryName("Terminator").value();
+        const std::array<uint16_t, 1> seats { 1 };
+        [[maybe_unused]] const bool booked = service.getPremiere(theater, movie).value()->bookSeats(seats);
+
+        Tracing::Tracer& tracer = Tracing::Tracer::instance();
+        for (const size_t threads: {1, 4})
+        {
+            for (const auto& [name, sampling]: {std::pair { "tracing: disabled", 0u },
+                                                std::pair { "tracing: every 100th request", 100u },
+                                                std::pair { "tracing: every request", 1u }})
+            {
+                Tracing::Tracer::setSampling(sampling);
+                const double throughput = measureThroughput(threads, [&](size_t) {
+                    return runRequests(service, theater, movie);
+                });
+                report(name, threads, throughput);
+                tracer.clear();
+            }
+        }
+        Tracing::Tracer::setSampling(0);
+    }
+}
@@ -0,0 +1,112 @@
+/**
+ * @file       trending_benchmark.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Trending movies: the mutex-protected exact counters vs the TrendingTracker sketches
+ */
+
+#include <algorithm>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+
+#include "Benchmarks.h"
+#include "Trending.h"
+
+namespace
+{
+    using namespace Booking;
+    using Benchmarks::report;
+    using Benchmarks::measureThroughput;
+
+    constexpr size_t bookingsPerThread { 1'000'000 };
+    constexpr size_t moviesCount { 100'000 };
+    constexpr size_t theatersCount { 1'000 };
+
+    /** The straightforward way: the exact counts of the window behind a single mutex **/
+    class ExactCounters
+    {
+        std::mutex mtx;
+        std::unordered_map<size_t, uint64_t> movies;
+        std::unordered_map<size_t, uint64_t> theaters;
+
+    public:
+
+        void recordBooking(size_t movieId, size_t theaterId)
+        {
+            std::lock_guard<std::mutex> lock { mtx };
+            ++movies[movieId];
+            ++theaters[theaterId];
+        }
+
+        std::vector<std::pair<size_t, uint64_t>> top(size_t limit)
+        {
+            std::lock_guard<std::mutex> lock { mtx };
+            std::vector<std::pair<size_t, uint64_t>> entries { movies.begin(), movies.end() };
+            const size_t count = std::min(limit, entries.size());
+            std::partial_sort(entries.begin(), entries.begin() + static_cast<std::ptrdiff_t>(count), entries.end(),
+                              [](const auto& left, const auto& right) { return left.second > right.second; });
+            entries.resize(count);
+            return entries;
+        }
+    };
+
+    /** The skewed movies popularity: a few blockbusters and the long tail **/
+    std::vector<size_t> makeMovies(size_t count, uint32_t seed)
+    {
+        std::mt19937 generator { seed };
+        std::vector<size_t> movies(count);
+        for (size_t& movie: movies)
+            movie = 0 == generator() % 4 ? 1 + generator() % 10 : 1 + generator() % moviesCount;
+        return movies;
+    }
+
+    template<typename Query>
+    double measureQueries(size_t queriesCount, Query&& query)
+    {
+        size_t found = 0;
+        const Benchmarks::Clock::time_point start = Benchmarks::Clock::now();
+        for (size_t idx = 0; idx < queriesCount; ++idx)
+            found += query().size();
+        const std::chrono::duration<double> elapsed = Benchmarks::Clock::now() - start;
+        if (0 == found)
+            std::cout << "No results found\n";
+        return static_cast<double>(queriesCount) / elapsed.count();
+    }
+}
+
+namespace Benchmarks
+{
+    void trending()
+    {
+        for (size_t threadsCount: {1u, 2u, 4u, 8u})
+        {
+            std::vector<std::vector<size_t>> movies;
+            for (size_t idx = 0; idx < threadsCount; ++idx)
+                movies.push_back(makeMovies(bookingsPerThread, static_cast<uint32_t>(idx)));
+
+            ExactCounters exact;
+            report("trending record: mutex + map", threadsCount, measureThroughput(threadsCount, [&](size_t idx) {
+                for (size_t i = 0; i < bookingsPerThread; ++i)
+                    exact.recordBooking(movies[idx][i], i % theatersCount);
+                return bookingsPerThread;
+            }));
+
+            TrendingTracker tracker;
+            report("trending record: TrendingTracker", threadsCount, measureThroughput(threadsCount, [&](size_t idx) {
+                for (size_t i = 0; i < bookingsPerThread; ++i)
+                    tracker.recordBooking(movies[idx][i], i % theatersCount);
+                return bookingsPerThread;
+            }));
+
+            if (8 == threadsCount) {
+                report("trending top 10: exact counts", 1, measureQueries(10, [&] { return exact.top(10); }));
+                report("trending top 10: TrendingTracker", 1, measureQueries(1'000, [&] {
+                    return tracker.top(TrendingTracker::Kind::Movie, 10);
+                }));
+            }
+        }
+    }
+}
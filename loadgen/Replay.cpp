@@ -0,0 +1,123 @@
+/**
+ * @file       Replay.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Open-loop replay of the CLI command logs and the latency statistics
+ */
+
+#include "Replay.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <istream>
+#include <ostream>
+#include <thread>
+
+#include "CLI.h"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::string_view commandName(std::string_view command) {
+        return command.substr(0, command.find(' '));
+    }
+
+    void printRow(std::ostream& out, std::string_view name, LoadGen::LatencyStats& stats)
+    {
+        const auto micros = [&stats](double quantile) {
+            return static_cast<double>(stats.percentile(quantile)) / 1000.0;
+        };
+        out << std::left << std::setw(24) << name << std::right << std::setw(10) << stats.count()
+            << std::fixed << std::setprecision(1)
+            << std::setw(12) << micros(0.5) << std::setw(12) << micros(0.99)
+            << std::setw(12) << micros(0.999) << std::setw(12) << micros(1.0) << '\n';
+    }
+}
+
+namespace LoadGen
+{
+    uint64_t LatencyStats::percentile(double quantile)
+    {
+        if (samples.empty())
+            return 0;
+        if (!sorted) {
+            std::sort(samples.begin(), samples.end());
+            sorted = true;
+        }
+        const auto rank = static_cast<size_t>(std::ceil(quantile * static_cast<double>(samples.size())));
+        return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+    }
+
+    ReplayResult replay(Booking::BookingService& service, std::span<const std::string> commands, double targetRate)
+    {
+        std::ostream discard { nullptr };
+        CLI::SimpleCLI cli { service, discard };
+
+        ReplayResult result;
+        const std::chrono::duration<double> interval { targetRate > 0 ? 1.0 / targetRate : 0.0 };
+
+        const Clock::time_point start = Clock::now();
+        for (size_t idx = 0; idx < commands.size(); ++idx)
+        {
+            Clock::time_point intended = Clock::now();
+            if (targetRate > 0) {
+                intended = start + std::chrono::duration_cast<Clock::duration>(interval * static_cast<double>(idx));
+                std::this_thread::sleep_until(intended);
+            }
+
+            [[maybe_unused]] const auto status = cli.processCommand(commands[idx]);
+            const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - intended);
+
+            const auto nanoseconds = static_cast<uint64_t>(latency.count());
+            result.overall.add(nanoseconds);
+            const std::string_view name = commandName(commands[idx]);
+            if (auto iter = result.byCommand.find(name); result.byCommand.end() != iter)
+                iter->second.add(nanoseconds);
+            else
+                result.byCommand[std::string { name }].add(nanoseconds);
+        }
+
+        result.commandsCount = commands.size();
+        result.elapsedSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+        return result;
+    }
+
+    void report(ReplayResult& result, std::ostream& out)
+    {
+        out << "Commands: " << result.commandsCount << ", elapsed: " << std::fixed << std::setprecision(3)
+            << result.elapsedSeconds << " sec, throughput: " << std::setprecision(0) << result.throughput()
+            << " commands/sec\n\n";
+
+        out << std::left << std::setw(24) << "command" << std::right << std::setw(10) << "count"
+            << std::setw(12) << "p50 (us)" << std::setw(12) << "p99 (us)"
+            << std::setw(12) << "p999 (us)" << std::setw(12) << "max (us)" << '\n';
+        for (auto& [name, stats]: result.byCommand)
+            printRow(out, name, stats);
+        printRow(out, "all", result.overall);
+    }
+
+    std::vector<std::string> readCommands(std::istream& in)
+    {
+        std::vector<std::string> commands;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (!line.empty() && '\r' == line.back())
+                line.pop_back();
+            if (!line.empty() && '#' != line.front())
+                commands.push_back(std::move(line));
+        }
+        return commands;
+    }
+
+    void writeCommands(std::span<const std::string> commands, std::ostream& out)
+    {
+        for (const std::string& command: commands)
+            out << command << '\n';
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file       Replay.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Open-loop replay of the CLI command logs and the latency statistics
+ */
+
+#ifndef BOOKINGSERVICE_LOADGEN_REPLAY_H
+#define BOOKINGSERVICE_LOADGEN_REPLAY_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "BookingService.h"
+
+namespace LoadGen
+{
+    /**
+     * @brief Latency samples (in nanoseconds) and their percentiles
+     */
+    class LatencyStats
+    {
+        std::vector<uint64_t> samples;
+        bool sorted { true };
+
+    public:
+
+        void add(uint64_t nanoseconds)
+        {
+            samples.push_back(nanoseconds);
+            sorted = false;
+        }
+
+        [[nodiscard]]
+        size_t count() const noexcept {
+            return samples.size();
+        }
+
+        /**
+         * Returns the latency not exceeded by the <b>quantile</b> share of the samples (nearest-rank method)
+         * @param quantile value in the range (0, 1], e.g. 0.99 for p99
+         */
+        [[nodiscard]]
+        uint64_t percentile(double quantile);
+    };
+
+    /**
+     * @brief The replay results: overall and per command (by the command name)
+     */
+    struct ReplayResult
+    {
+        size_t commandsCount { 0 };
+        double elapsedSeconds { 0 };
+        LatencyStats overall;
+        std::map<std::string, LatencyStats, std::less<>> byCommand;
+
+        [[nodiscard]]
+        double throughput() const noexcept {
+            return elapsedSeconds > 0 ? static_cast<double>(commandsCount) / elapsedSeconds : 0;
+        }
+    };
+
+    /**
+     * Executes the commands one by one via the CLI::SimpleCLI (as a single user session)
+     * @param targetRate the commands per second to issue. The schedule is <i>open-loop</i>: each command has its
+     * intended start time regardless of how long the previous ones took, and its latency is measured from that time,
+     * so the service slowdowns show up as the queueing delay (no coordinated omission).
+     * Zero rate means closed-loop: the next command starts as soon as the previous one completes
+     */
+    [[nodiscard]]
+    ReplayResult replay(Booking::BookingService& service, std::span<const std::string> commands, double targetRate);
+
+    /**
+     * Prints the throughput and the latency percentiles (p50, p99, p999 and max)
+     */
+    void report(ReplayResult& result, std::ostream& out);
+
+    /**
+     * Reads the command log: one CLI command per line, the empty lines and the lines starting with '#' are skipped
+     */
+    [[nodiscard]]
+    std::vector<std::string> readCommands(std::istream& in);
+
+    /**
+     * Writes the commands in the log format accepted by readCommands()
+     */
+    void writeCommands(std::span<const std::string> commands, std::ostream& out);
+}
+
+#endif //BOOKINGSERVICE_LOADGEN_REPLAY_H
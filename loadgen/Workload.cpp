@@ -0,0 +1,226 @@
+/**
+ * @file       Workload.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Deterministic synthetic workloads: the catalog and the CLI commands stream
+ */
+
+#include "Workload.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <optional>
+#include <unordered_map>
+
+namespace
+{
+    using namespace LoadGen;
+
+    template<typename Entry>
+    std::vector<Entry*> sortedById(std::vector<Entry*> entries)
+    {
+        std::sort(entries.begin(), entries.end(), [](const Entry* left, const Entry* right) {
+            return left->id < right->id;
+        });
+        return entries;
+    }
+
+    /** Random permutation of [0, count): maps the popularity ranks to the catalog entries **/
+    std::vector<size_t> shuffled(size_t count, Random& random)
+    {
+        std::vector<size_t> indices(count);
+        std::iota(indices.begin(), indices.end(), 0);
+        for (size_t idx = count; idx > 1; --idx)
+            std::swap(indices[idx - 1], indices[random.below(idx)]);
+        return indices;
+    }
+
+    /**
+     * @brief Writes the commands of a single CLI session, tracking the selection state the same way SimpleCLI
+     * does: selecting a theater (movie) not showing the already selected movie (theater) fails and drops it
+     */
+    class SessionWriter
+    {
+        const Catalog& catalog;
+        std::vector<std::string>& commands;
+        std::optional<size_t> theaterSelected;
+        std::optional<size_t> movieSelected;
+
+        void selectTheater(size_t theaterIdx)
+        {
+            commands.push_back("select_theater " + catalog.theaters[theaterIdx]);
+            if (!movieSelected || catalog.isShown(theaterIdx, *movieSelected))
+                theaterSelected = theaterIdx;
+            else
+                theaterSelected.reset();
+        }
+
+        void selectMovie(size_t movieIdx)
+        {
+            commands.push_back("select_movie " + catalog.movies[movieIdx]);
+            if (!theaterSelected || catalog.isShown(*theaterSelected, movieIdx))
+                movieSelected = movieIdx;
+            else
+                movieSelected.reset();
+        }
+
+    public:
+
+        SessionWriter(const Catalog& catalog, std::vector<std::string>& commands):
+                catalog { catalog }, commands { commands } {
+        }
+
+        void selectPremiere(const std::pair<size_t, size_t>& premiere)
+        {
+            const auto [theaterIdx, movieIdx] = premiere;
+            if (theaterSelected == theaterIdx && movieSelected == movieIdx)
+                return;
+            if (movieSelected == movieIdx) {
+                selectTheater(theaterIdx);
+                return;
+            }
+            if (theaterSelected == theaterIdx) {
+                selectMovie(movieIdx);
+                return;
+            }
+
+            if (!movieSelected || catalog.isShown(theaterIdx, *movieSelected)) {
+                selectTheater(theaterIdx);
+                selectMovie(movieIdx);
+                return;
+            }
+
+            // The selected movie is not shown in the theater: switch the movie first
+            selectMovie(movieIdx);
+            selectTheater(theaterIdx);
+            if (!movieSelected)
+                selectMovie(movieIdx);
+        }
+
+        void add(std::string command) {
+            commands.push_back(std::move(command));
+        }
+    };
+}
+
+namespace LoadGen
+{
+    WeightedDistribution::WeightedDistribution(const std::vector<double>& weights)
+    {
+        cumulative.reserve(weights.size());
+        double total = 0;
+        for (const double weight: weights)
+            cumulative.push_back(total += weight);
+    }
+
+    size_t WeightedDistribution::operator()(Random& random) const noexcept
+    {
+        const double point = random.uniform() * cumulative.back();
+        const auto iter = std::upper_bound(cumulative.cbegin(), cumulative.cend(), point);
+        return std::min<size_t>(std::distance(cumulative.cbegin(), iter), cumulative.size() - 1);
+    }
+
+    ZipfDistribution::ZipfDistribution(size_t count, double exponent):
+            WeightedDistribution { [count, exponent] {
+                std::vector<double> weights(count);
+                for (size_t rank = 0; rank < count; ++rank)
+                    weights[rank] = 1.0 / std::pow(static_cast<double>(rank + 1), exponent);
+                return weights;
+            }() } {
+    }
+
+    Catalog Catalog::from(const Booking::BookingService& service)
+    {
+        Catalog catalog;
+        std::unordered_map<size_t, size_t> movieIdx, theaterIdx;
+        for (const Booking::Movie* movie: sortedById(service.getMovies())) {
+            movieIdx.emplace(movie->id, catalog.movies.size());
+            catalog.movies.push_back(movie->name);
+        }
+        for (const Booking::Theater* theater: sortedById(service.getTheaters())) {
+            theaterIdx.emplace(theater->id, catalog.theaters.size());
+            catalog.theaters.push_back(theater->name);
+        }
+
+        const std::span<const size_t> theaterIds = service.bookingSchedule.getTheaterIds();
+        const std::span<const size_t> movieIds = service.bookingSchedule.getMovieIds();
+        for (size_t idx = 0; idx < movieIds.size(); ++idx) {
+            if (service.bookingSchedule.isVacant(idx))
+                continue;
+            const size_t theater = theaterIdx.at(theaterIds[idx]), movie = movieIdx.at(movieIds[idx]);
+            catalog.premieres.emplace_back(theater, movie);
+            catalog.shows.insert(key(theater, movie));
+        }
+        return catalog;
+    }
+
+    void populateCatalog(Booking::BookingService& service, const WorkloadConfig& config)
+    {
+        Random random { config.seed };
+        for (size_t idx = 0; idx < config.moviesCount; ++idx)
+            service.addMovie("Movie " + std::to_string(idx));
+
+        const size_t showsCount = std::min(config.showsPerTheater, config.moviesCount);
+        for (size_t idx = 0; idx < config.theatersCount; ++idx)
+        {
+            const std::string theaterName = "Theater " + std::to_string(idx);
+            service.addTheater(theaterName);
+            const std::vector<size_t> movies = shuffled(config.moviesCount, random);
+            for (size_t show = 0; show < showsCount; ++show)
+                service.scheduleMovie("Movie " + std::to_string(movies[show]), theaterName);
+        }
+    }
+
+    std::vector<std::string> generateCommands(const Catalog& catalog, const WorkloadConfig& config)
+    {
+        std::vector<std::string> commands;
+        if (catalog.premieres.empty() || catalog.movies.empty())
+            return commands;
+
+        Random random { config.seed };
+        const std::vector<size_t> premieresByRank = shuffled(catalog.premieres.size(), random);
+        const std::vector<size_t> moviesByRank = shuffled(catalog.movies.size(), random);
+        const ZipfDistribution premiereRank { catalog.premieres.size(), config.zipfExponent };
+        const ZipfDistribution movieRank { catalog.movies.size(), config.zipfExponent };
+
+        std::vector<double> seatsWeights;
+        for (const SeatsWeight& entry: config.seatsPerOrder)
+            seatsWeights.push_back(entry.weight);
+        const WeightedDistribution seatsDist { seatsWeights };
+
+        SessionWriter session { catalog, commands };
+        for (size_t operation = 0; operation < config.operationsCount; ++operation)
+        {
+            const auto& premiere = catalog.premieres[premieresByRank[premiereRank(random)]];
+            if (random.uniform() >= config.browseRatio)
+            {
+                // Order: the contiguous block of seats starting at the random seat
+                const uint16_t seatsCount = std::clamp<uint16_t>(config.seatsPerOrder[seatsDist(random)].seats,
+                                                                 1, Booking::Theater::seatsCapacityMax);
+                const size_t firstSeat = 1 + random.below(Booking::Theater::seatsCapacityMax - seatsCount + 1);
+                std::string command = "book_seats ";
+                for (size_t seat = firstSeat; seat < firstSeat + seatsCount; ++seat)
+                    command.append(seat == firstSeat ? "" : ",").append(std::to_string(seat));
+
+                session.selectPremiere(premiere);
+                session.add(std::move(command));
+                continue;
+            }
+
+            // Browsing: the movies listing, the theaters showing the movie or the seats of the premiere
+            const size_t browseKind = random.below(10);
+            if (browseKind < 2) {
+                session.add("list_playing_movies");
+            } else if (browseKind < 6) {
+                session.add("find_theaters " + catalog.movies[moviesByRank[movieRank(random)]]);
+            } else {
+                session.selectPremiere(premiere);
+                session.add("list_available_seats");
+            }
+        }
+        return commands;
+    }
+}
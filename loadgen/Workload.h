@@ -0,0 +1,159 @@
+/**
+ * @file       Workload.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Deterministic synthetic workloads: the catalog and the CLI commands stream
+ */
+
+#ifndef BOOKINGSERVICE_LOADGEN_WORKLOAD_H
+#define BOOKINGSERVICE_LOADGEN_WORKLOAD_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "BookingService.h"
+
+//! Load generator: synthesizes the workloads and replays the recorded CLI command logs
+namespace LoadGen
+{
+    /**
+     * @brief Pseudo-random numbers generator (splitmix64).<br>
+     * Unlike the std:: distributions, the sequences it produces are the same on all the platforms and the
+     * standard library implementations, so the workload generated from a seed is fully reproducible
+     */
+    class Random
+    {
+        uint64_t state { 0 };
+
+    public:
+
+        explicit Random(uint64_t seed) noexcept: state { seed } {
+        }
+
+        uint64_t next() noexcept
+        {
+            uint64_t value = (state += 0x9E3779B97F4A7C15ull);
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+            return value ^ (value >> 31);
+        }
+
+        /** Uniformly distributed value in the range [0, bound) **/
+        size_t below(size_t bound) noexcept {
+            return static_cast<size_t>(next() % bound);
+        }
+
+        /** Uniformly distributed value in the range [0, 1) **/
+        double uniform() noexcept {
+            return static_cast<double>(next() >> 11) * 0x1.0p-53;
+        }
+    };
+
+    /**
+     * @brief Discrete distribution over the weighted values, sampled by the binary search in the cumulative weights
+     */
+    class WeightedDistribution
+    {
+        std::vector<double> cumulative;
+
+    public:
+
+        explicit WeightedDistribution(const std::vector<double>& weights);
+
+        /** Returns the index of the chosen weight **/
+        size_t operator()(Random& random) const noexcept;
+    };
+
+    /**
+     * @brief Zipfian distribution over the ranks [0, count): the probability of the rank K is proportional
+     * to 1 / (K + 1)^exponent, so a few top ranks get most of the traffic
+     */
+    class ZipfDistribution: public WeightedDistribution
+    {
+    public:
+        ZipfDistribution(size_t count, double exponent);
+    };
+
+    /** The share of orders booking the specified number of seats **/
+    struct SeatsWeight
+    {
+        uint16_t seats { 1 };
+        double weight { 1.0 };
+    };
+
+    /**
+     * @brief Workload parameters
+     */
+    struct WorkloadConfig
+    {
+        /** Synthetic catalog size: each theater shows the <b>showsPerTheater</b> movies **/
+        size_t moviesCount { 200 };
+        size_t theatersCount { 50 };
+        size_t showsPerTheater { 10 };
+
+        /** Number of the user operations to generate (each operation is one or several CLI commands) **/
+        size_t operationsCount { 100'000 };
+
+        /** Share of the browsing operations; the rest are the orders (seats booking) **/
+        double browseRatio { 0.8 };
+
+        /** Skew of the premieres (and movies) popularity **/
+        double zipfExponent { 1.0 };
+
+        std::vector<SeatsWeight> seatsPerOrder { {1, 30}, {2, 45}, {3, 10}, {4, 15} };
+
+        uint64_t seed { 42 };
+    };
+
+    /**
+     * @brief The catalog the workload is generated for: names ordered by their IDs and the premieres
+     */
+    struct Catalog
+    {
+        std::vector<std::string> movies;
+        std::vector<std::string> theaters;
+
+        /** Premieres as the (theater index, movie index) pairs **/
+        std::vector<std::pair<size_t, size_t>> premieres;
+
+        /**
+         * Collects the catalog of the service
+         */
+        [[nodiscard]]
+        static Catalog from(const Booking::BookingService& service);
+
+        [[nodiscard]]
+        bool isShown(size_t theaterIdx, size_t movieIdx) const noexcept {
+            return shows.contains(key(theaterIdx, movieIdx));
+        }
+
+    private:
+
+        [[nodiscard]]
+        static uint64_t key(size_t theaterIdx, size_t movieIdx) noexcept {
+            return (static_cast<uint64_t>(theaterIdx) << 32) | static_cast<uint32_t>(movieIdx);
+        }
+
+        std::unordered_set<uint64_t> shows;
+    };
+
+    /**
+     * Populates the service with the synthetic catalog (like BookingService::initialize() does with the demo one)
+     */
+    void populateCatalog(Booking::BookingService& service, const WorkloadConfig& config);
+
+    /**
+     * Generates the stream of the CLI commands: the same config (and the seed) always produces the same stream
+     * @return commands in the SimpleCLI syntax, one per element
+     */
+    [[nodiscard]]
+    std::vector<std::string> generateCommands(const Catalog& catalog, const WorkloadConfig& config);
+}
+
+#endif //BOOKINGSERVICE_LOADGEN_WORKLOAD_H
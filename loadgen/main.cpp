@@ -0,0 +1,139 @@
+/**
+ * @file       main.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Load generator and traffic replay tool
+ */
+
+#include <charconv>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+#include <unordered_map>
+
+#include "Workload.h"
+#include "Replay.h"
+
+namespace
+{
+    using namespace std::string_view_literals;
+
+    constexpr std::string_view usage {
+        "Usage: ./loadgen/loadgen [--option=value ...]\n"
+        "  --catalog=synthetic|demo  catalog to run against (demo: BookingService::initialize data)\n"
+        "  --movies=N --theaters=N --shows=N  synthetic catalog size (shows: movies per theater)\n"
+        "  --operations=N            number of the user operations to generate\n"
+        "  --browse-ratio=R          share of the browsing operations, the rest are orders\n"
+        "  --zipf=S                  premieres popularity skew (Zipf exponent)\n"
+        "  --seats=N:W,...           seats per order distribution (seats count : weight)\n"
+        "  --seed=N                  random seed: the same seed produces the same workload\n"
+        "  --rate=N                  target commands per second (0 - as fast as possible)\n"
+        "  --record=FILE             save the generated commands to the file (and exit)\n"
+        "  --replay=FILE             replay the recorded commands instead of generating\n"
+    };
+
+    struct Options
+    {
+        LoadGen::WorkloadConfig workload;
+        bool demoCatalog { false };
+        double rate { 0 };
+        std::string recordFile;
+        std::string replayFile;
+    };
+
+    template<typename T>
+    bool parseNumber(std::string_view text, T& value) {
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return std::errc {} == error && end == text.data() + text.size();
+    }
+
+    bool parseSeats(std::string_view text, std::vector<LoadGen::SeatsWeight>& seatsPerOrder)
+    {
+        seatsPerOrder.clear();
+        while (!text.empty())
+        {
+            const std::string_view entry = text.substr(0, text.find(','));
+            text.remove_prefix(std::min(text.size(), entry.size() + 1));
+
+            const size_t colon = entry.find(':');
+            LoadGen::SeatsWeight& weight = seatsPerOrder.emplace_back();
+            if (std::string_view::npos == colon || !parseNumber(entry.substr(0, colon), weight.seats) ||
+                !parseNumber(entry.substr(colon + 1), weight.weight))
+                return false;
+        }
+        return !seatsPerOrder.empty();
+    }
+
+    bool parseOption(std::string_view arg, Options& options)
+    {
+        const size_t equals = arg.find('=');
+        if (!arg.starts_with("--"sv) || std::string_view::npos == equals)
+            return false;
+        const std::string_view name = arg.substr(2, equals - 2), value = arg.substr(equals + 1);
+
+        LoadGen::WorkloadConfig& workload = options.workload;
+        if ("catalog"sv == name) {
+            options.demoCatalog = "demo"sv == value;
+            return options.demoCatalog || "synthetic"sv == value;
+        }
+        else if ("movies"sv == name)        return parseNumber(value, workload.moviesCount);
+        else if ("theaters"sv == name)      return parseNumber(value, workload.theatersCount);
+        else if ("shows"sv == name)         return parseNumber(value, workload.showsPerTheater);
+        else if ("operations"sv == name)    return parseNumber(value, workload.operationsCount);
+        else if ("browse-ratio"sv == name)  return parseNumber(value, workload.browseRatio);
+        else if ("zipf"sv == name)          return parseNumber(value, workload.zipfExponent);
+        else if ("seats"sv == name)         return parseSeats(value, workload.seatsPerOrder);
+        else if ("seed"sv == name)          return parseNumber(value, workload.seed);
+        else if ("rate"sv == name)          return parseNumber(value, options.rate);
+        else if ("record"sv == name)        options.recordFile = value;
+        else if ("replay"sv == name)        options.replayFile = value;
+        else                                return false;
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    for (int idx = 1; idx < argc; ++idx) {
+        if ("--help"sv == argv[idx]) {
+            std::cout << usage;
+            return EXIT_SUCCESS;
+        }
+        if (!parseOption(argv[idx], options)) {
+            std::cerr << "Invalid option '" << argv[idx] << "'\n" << usage;
+            return EXIT_FAILURE;
+        }
+    }
+
+    Booking::BookingService service;
+    if (options.demoCatalog)
+        service.initialize();
+    else
+        LoadGen::populateCatalog(service, options.workload);
+
+    std::vector<std::string> commands;
+    if (!options.replayFile.empty()) {
+        std::ifstream log { options.replayFile };
+        if (!log) {
+            std::cerr << "Failed to open '" << options.replayFile << "'\n";
+            return EXIT_FAILURE;
+        }
+        commands = LoadGen::readCommands(log);
+    } else {
+        commands = LoadGen::generateCommands(LoadGen::Catalog::from(service), options.workload);
+    }
+
+    if (!options.recordFile.empty()) {
+        std::ofstream log { options.recordFile };
+        LoadGen::writeCommands(commands, log);
+        std::cout << commands.size() << " commands recorded to '" << options.recordFile << "'\n";
+        return log ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    LoadGen::ReplayResult result = LoadGen::replay(service, commands, options.rate);
+    LoadGen::report(result, std::cout);
+    return EXIT_SUCCESS;
+}
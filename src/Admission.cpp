@@ -0,0 +1,177 @@
+/**
+ * @file       Admission.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Admission control: per-client rate limiting, concurrency limit and priority lanes
+ */
+
+#include "Admission.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <utility>
+
+namespace
+{
+    /** Spreads the sequential client IDs over the table (the splitmix64 finalizer) **/
+    constexpr uint64_t mix(uint64_t value) noexcept
+    {
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    }
+
+    int64_t nanoseconds(Admission::Clock::time_point time) noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+    }
+
+    std::atomic<size_t> threadsCount { 0 };
+}
+
+namespace Admission
+{
+    TokenBuckets::TokenBuckets(size_t capacity):
+            mask { std::bit_ceil(std::max(capacity, probesMax)) - 1 },
+            buckets { std::make_unique<Bucket[]>(mask + 1) } {
+    }
+
+    TokenBuckets::Bucket* TokenBuckets::findBucket(uint64_t key, int64_t now) noexcept
+    {
+        const size_t first = mix(key);
+
+        // The client may only be found before the first empty slot: the slots never become empty again
+        for (size_t probe = 0; probe < probesMax; ++probe)
+        {
+            Bucket& bucket = buckets[(first + probe) & mask];
+            uint64_t current = bucket.key.load(std::memory_order_acquire);
+            if (key == current)
+                return &bucket;
+            if (0 == current) {
+                if (bucket.key.compare_exchange_strong(current, key, std::memory_order_acq_rel) || key == current)
+                    return &bucket;
+            }
+        }
+
+        // Not found: reuse the slot of an idle client. Its full bucket is equal to the fresh one
+        for (size_t probe = 0; probe < probesMax; ++probe)
+        {
+            Bucket& bucket = buckets[(first + probe) & mask];
+            uint64_t current = bucket.key.load(std::memory_order_acquire);
+            if (bucket.arrivalTime.load(std::memory_order_relaxed) <= now &&
+                bucket.key.compare_exchange_strong(current, key, std::memory_order_acq_rel))
+                return &bucket;
+        }
+        return nullptr;
+    }
+
+    bool TokenBuckets::tryAcquire(uint64_t clientId, const RateLimit& limit, Clock::time_point time) noexcept
+    {
+        const int64_t now = nanoseconds(time);
+        Bucket* const bucket = findBucket(clientId + 1, now);
+        if (nullptr == bucket)
+            return true;
+
+        const auto interval = static_cast<int64_t>(1e9 / limit.perSecond);
+        const int64_t tolerance = interval * static_cast<int64_t>(limit.burst);
+        int64_t arrivalTime = bucket->arrivalTime.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            const int64_t next = std::max(arrivalTime, now) + interval;
+            if (next - now > tolerance)
+                return false;
+            if (bucket->arrivalTime.compare_exchange_weak(arrivalTime, next, std::memory_order_relaxed))
+                return true;
+        }
+    }
+
+    ConcurrencyLimiter::ConcurrencyLimiter(size_t limit, double regularShare) noexcept:
+            stripesUsed { limit < stripesCount ? 1 : stripesCount }
+    {
+        const size_t regularLimit = std::min(limit, static_cast<size_t>(
+                std::floor(static_cast<double>(limit) * std::clamp(regularShare, 0.0, 1.0))));
+        for (size_t idx = 0; idx < stripesUsed; ++idx) {
+            stripes[idx].limit = limit / stripesUsed + (idx < limit % stripesUsed ? 1 : 0);
+            stripes[idx].regularLimit = regularLimit / stripesUsed + (idx < regularLimit % stripesUsed ? 1 : 0);
+        }
+    }
+
+    ConcurrencyLimiter::Stripe& ConcurrencyLimiter::homeStripe() noexcept
+    {
+        thread_local const size_t threadIdx = threadsCount.fetch_add(1, std::memory_order_relaxed);
+        return stripes[threadIdx % stripesCount];
+    }
+
+    size_t ConcurrencyLimiter::tryAcquire(Lane lane) noexcept
+    {
+        const size_t home = static_cast<size_t>(&homeStripe() - stripes.data());
+        for (size_t idx = 0; idx < stripesUsed; ++idx)
+        {
+            const size_t stripeIdx = (home + idx) % stripesUsed;
+            Stripe& stripe = stripes[stripeIdx];
+            const size_t limit = Lane::Priority == lane ? stripe.limit : stripe.regularLimit;
+            if (stripe.inFlight.load(std::memory_order_relaxed) >= limit)
+                continue;
+            if (stripe.inFlight.fetch_add(1, std::memory_order_acquire) < limit)
+                return stripeIdx;
+            stripe.inFlight.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return stripesCount;
+    }
+
+    Permit::Permit(Permit&& other) noexcept:
+            limiter { std::exchange(other.limiter, nullptr) }, stripeIdx { other.stripeIdx }, verdict { other.verdict } {
+    }
+
+    Permit& Permit::operator=(Permit&& other) noexcept
+    {
+        // The previous permit (if any) is released by the destructor of the other
+        std::swap(limiter, other.limiter);
+        std::swap(stripeIdx, other.stripeIdx);
+        std::swap(verdict, other.verdict);
+        return *this;
+    }
+
+    Permit::~Permit()
+    {
+        if (nullptr != limiter)
+            limiter->release(stripeIdx);
+    }
+
+    AdmissionController::AdmissionController(const Config& config):
+            config { config },
+            buckets { config.clientsCapacity },
+            limiter { config.concurrencyLimit, config.regularShare } {
+    }
+
+    Permit AdmissionController::admit(uint64_t clientId, Lane lane, Clock::time_point now) noexcept
+    {
+        ConcurrencyLimiter::Stripe& stats = limiter.homeStripe();
+        if (!buckets.tryAcquire(clientId, Lane::Priority == lane ? config.priority : config.regular, now)) {
+            stats.rateLimited.fetch_add(1, std::memory_order_relaxed);
+            return Permit { Verdict::RateLimited };
+        }
+
+        const size_t stripeIdx = limiter.tryAcquire(lane);
+        if (ConcurrencyLimiter::stripesCount == stripeIdx) {
+            stats.shed.fetch_add(1, std::memory_order_relaxed);
+            return Permit { Verdict::Shed };
+        }
+        stats.admitted.fetch_add(1, std::memory_order_relaxed);
+        return Permit { &limiter, stripeIdx };
+    }
+
+    Statistics AdmissionController::getStatistics() const noexcept
+    {
+        Statistics statistics;
+        for (const ConcurrencyLimiter::Stripe& stripe: limiter.getStripes()) {
+            statistics.admitted += stripe.admitted.load(std::memory_order_relaxed);
+            statistics.rateLimited += stripe.rateLimited.load(std::memory_order_relaxed);
+            statistics.shed += stripe.shed.load(std::memory_order_relaxed);
+            statistics.inFlight += stripe.inFlight.load(std::memory_order_relaxed);
+        }
+        return statistics;
+    }
+}
@@ -0,0 +1,244 @@
+/**
+ * @file       Admission.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Admission control: per-client rate limiting, concurrency limit and priority lanes
+ */
+
+#ifndef BOOKINGSERVICE_ADMISSION_H
+#define BOOKINGSERVICE_ADMISSION_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "Concurrency.h"
+
+//! Admission control in front of the BookingService: who is served now and who is asked to retry later
+namespace Admission
+{
+    using Clock = std::chrono::steady_clock;
+
+    /** The request lane: the confirmed customers get the higher rate and the reserved capacity **/
+    enum class Lane : uint8_t
+    {
+        Regular,
+        Priority
+    };
+
+    /** The admission decision **/
+    enum class Verdict : uint8_t
+    {
+        Admitted,
+        /** The client exceeded its rate **/
+        RateLimited,
+        /** The service runs at its concurrency limit: the request is shed **/
+        Shed
+    };
+
+    /** The rate allowed for a single client **/
+    struct RateLimit
+    {
+        double perSecond { 10 };
+        /** Number of requests the client may issue at once after being idle **/
+        uint32_t burst { 20 };
+    };
+
+    struct Config
+    {
+        RateLimit regular { 10, 20 };
+        RateLimit priority { 50, 100 };
+
+        /** Maximum number of the requests being served simultaneously **/
+        size_t concurrencyLimit { 1024 };
+
+        /** The share of the concurrencyLimit available to the Lane::Regular: the rest is reserved for the priority **/
+        double regularShare { 0.8 };
+
+        /** Number of the clients tracked at once (rounded up to the power of two) **/
+        size_t clientsCapacity { 65'536 };
+    };
+
+    /**
+     * @brief Token buckets of the clients, keyed by the client ID.<br>
+     * Each bucket is a single atomic "theoretical arrival time" (GCRA: the token bucket equivalent that needs no
+     * refill timer), so the check is one load and one CAS. The buckets live in the open addressing table and each
+     * occupies its own cache line: the checks of the different clients never contend. The bucket of the idle client
+     * (whose bucket is full again) is equal to the fresh one, so its slot is reused for the new clients
+     */
+    class TokenBuckets
+    {
+        struct alignas(Concurrency::cacheLineSize) Bucket
+        {
+            /** The client ID + 1 (zero - the empty slot) **/
+            std::atomic<uint64_t> key { 0 };
+            /** Nanoseconds since the Clock epoch: the bucket is full when the time is not in the future **/
+            std::atomic<int64_t> arrivalTime { 0 };
+        };
+
+        /** Number of the slots probed for the client **/
+        static constexpr size_t probesMax { 16 };
+
+        const size_t mask;
+        std::unique_ptr<Bucket[]> buckets;
+
+        [[nodiscard]]
+        Bucket* findBucket(uint64_t key, int64_t now) noexcept;
+
+    public:
+
+        explicit TokenBuckets(size_t capacity);
+
+        /**
+         * Takes the token from the client bucket
+         * @return False if the client exceeded its rate. When there is no room for the client in the table
+         * (all probed slots belong to the active clients), the request is admitted: the concurrency limit still
+         * protects the service
+         */
+        [[nodiscard]]
+        bool tryAcquire(uint64_t clientId, const RateLimit& limit, Clock::time_point now) noexcept;
+    };
+
+    /**
+     * @brief Global limit of the requests in flight.<br>
+     * The limit is split between the stripes, each on its own cache line: a thread takes the permits from its home
+     * stripe and goes to the others only when it is exhausted, so the threads do not fight for a single counter.
+     * <br> The quotas of the stripes add up to the limit exactly (the remainder goes to the first stripes), as well
+     * as the quotas of the regular lane. The limit smaller than the number of the stripes is kept by a single
+     * counter: the stripes would have no room for the priority reservation
+     */
+    class ConcurrencyLimiter
+    {
+    public:
+
+        static constexpr size_t stripesCount { 16 };
+
+        struct alignas(Concurrency::cacheLineSize) Stripe
+        {
+            /** The permits of the stripe: for all the lanes and for the Lane::Regular **/
+            size_t limit { 0 };
+            size_t regularLimit { 0 };
+
+            std::atomic<size_t> inFlight { 0 };
+            std::atomic<uint64_t> admitted { 0 };
+            std::atomic<uint64_t> rateLimited { 0 };
+            std::atomic<uint64_t> shed { 0 };
+        };
+
+        /**
+         * Constructor
+         * @param limit the requests in flight of all the lanes
+         * @param regularShare the share of the limit available to the Lane::Regular (rounded down)
+         */
+        ConcurrencyLimiter(size_t limit, double regularShare) noexcept;
+
+        /**
+         * Takes the permit for the request of the lane
+         * @return the stripe the permit was taken from or stripesCount, if the limit is reached
+         */
+        [[nodiscard]]
+        size_t tryAcquire(Lane lane) noexcept;
+
+        void release(size_t stripeIdx) noexcept {
+            stripes[stripeIdx].inFlight.fetch_sub(1, std::memory_order_release);
+        }
+
+        /** The stripe of the calling thread: the statistics are counted there **/
+        [[nodiscard]]
+        Stripe& homeStripe() noexcept;
+
+        [[nodiscard]]
+        const std::array<Stripe, stripesCount>& getStripes() const noexcept {
+            return stripes;
+        }
+
+    private:
+
+        /** The stripes the permits are split between: the first ones **/
+        const size_t stripesUsed;
+        std::array<Stripe, stripesCount> stripes {};
+    };
+
+    /**
+     * @brief The admission of a single request: holds the concurrency permit until destroyed
+     */
+    class Permit
+    {
+        friend class AdmissionController;
+
+        ConcurrencyLimiter* limiter { nullptr };
+        size_t stripeIdx { 0 };
+        Verdict verdict { Verdict::Admitted };
+
+        explicit Permit(Verdict verdict) noexcept: verdict { verdict } {
+        }
+
+        Permit(ConcurrencyLimiter* limiter, size_t stripeIdx) noexcept: limiter { limiter }, stripeIdx { stripeIdx } {
+        }
+
+    public:
+
+        Permit(Permit&& other) noexcept;
+        Permit& operator=(Permit&& other) noexcept;
+        ~Permit();
+
+        [[nodiscard]]
+        Verdict getVerdict() const noexcept {
+            return verdict;
+        }
+
+        [[nodiscard]]
+        explicit operator bool() const noexcept {
+            return Verdict::Admitted == verdict;
+        }
+    };
+
+    /** The admission decisions counted so far **/
+    struct Statistics
+    {
+        uint64_t admitted { 0 };
+        uint64_t rateLimited { 0 };
+        uint64_t shed { 0 };
+        size_t inFlight { 0 };
+    };
+
+    /**
+     * @brief Admission controller: the client rate limit first, then the global concurrency limit.<br>
+     * Usage, for the CLI and the service API alike:
+     * @code
+     *   if (const Admission::Permit permit = admission.admit(clientId, Lane::Regular))
+     *       premiere->bookSeats(seats);     // served while the permit is alive
+     * @endcode
+     */
+    class AdmissionController
+    {
+        Config config;
+        TokenBuckets buckets;
+        ConcurrencyLimiter limiter;
+
+    public:
+
+        explicit AdmissionController(const Config& config = Config {});
+
+        /**
+         * Decides whether to serve the request of the client
+         * @param now the current time (a parameter to keep the decisions reproducible in tests)
+         */
+        [[nodiscard]]
+        Permit admit(uint64_t clientId, Lane lane, Clock::time_point now = Clock::now()) noexcept;
+
+        [[nodiscard]]
+        Statistics getStatistics() const noexcept;
+
+        [[nodiscard]]
+        const Config& getConfig() const noexcept {
+            return config;
+        }
+    };
+}
+
+#endif //BOOKINGSERVICE_ADMISSION_H
@@ -0,0 +1,109 @@
+/**
+ * @file       AsyncBookingService.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Coroutine-based asynchronous BookingService API definition
+*/
+
+#include "AsyncBookingService.h"
+
+namespace Booking
+{
+    // NOTE: Coroutine parameters are taken by value: references may dangle once the coroutine suspends
+
+    AsyncBookingService::AsyncBookingService(BookingService& service, Async::Executor& executor) noexcept:
+            service { service }, executor { executor } {
+    }
+
+    void AsyncBookingService::setAdmission(Admission::AdmissionController& controller,
+                                           uint64_t client,
+                                           Admission::Lane clientLane) noexcept
+    {
+        admission = &controller;
+        clientId = client;
+        lane = clientLane;
+    }
+
+    std::optional<Admission::Permit> AsyncBookingService::admit() const noexcept
+    {
+        return admission ? std::make_optional(admission->admit(clientId, lane)) : std::nullopt;
+    }
+
+    // The permit lives in the coroutine frame: held till the call completes, while suspended as well
+
+    Async::Task<std::vector<Movie*>> AsyncBookingService::getMovies() const
+    {
+        const std::optional<Admission::Permit> permit = admit();
+        if (permit && !permit.value())
+            co_return std::vector<Movie*> {};
+        co_return service.getMovies();
+    }
+
+    Async::Task<std::vector<Theater*>> AsyncBookingService::getTheaters() const
+    {
+        const std::optional<Admission::Permit> permit = admit();
+        if (permit && !permit.value())
+            co_return std::vector<Theater*> {};
+        co_return service.getTheaters();
+    }
+
+    Async::Task<std::vector<Movie*>> AsyncBookingService::getPlayingMovies() const
+    {
+        const std::optional<Admission::Permit> permit = admit();
+        if (permit && !permit.value())
+            co_return std::vector<Movie*> {};
+        co_return service.getPlayingMovies();
+    }
+
+    Async::Task<std::vector<Theater*>> AsyncBookingService::getTheatersByMovie(std::string movieName) const
+    {
+        const std::optional<Admission::Permit> permit = admit();
+        if (permit && !permit.value())
+            co_return std::vector<Theater*> {};
+        co_return service.getTheatersByMovie(movieName);
+    }
+
+    Async::Task<std::vector<uint16_t>> AsyncBookingService::getSeatsAvailable(std::string theaterName,
+                                                                             std::string movieName) const
+    {
+        const std::optional<Admission::Permit> permit = admit();
+        if (permit && !permit.value())
+            co_return std::vector<uint16_t> {};
+        co_return service.getSeatsAvailable(theaterName, movieName);
+    }
+
+    Async::Task<PricedBooking> AsyncBookingService::bookSeats(std::string theaterName,
+                                                              std::string movieName,
+                                                              std::vector<uint16_t> seatsToBook)
+    {
+        const std::optional<Admission::Permit> permit = admit();
+        if (permit && !permit.value())
+            co_return PricedBooking {};
+        std::optional<BookingService::PremierePtr> premiere = service.getPremiere(theaterName, movieName);
+        if (!premiere.has_value())
+            co_return PricedBooking {};
+        co_return co_await bookPremiere(std::move(premiere.value()), std::move(seatsToBook));
+    }
+
+    Async::Task<PricedBooking> AsyncBookingService::bookSeats(BookingService::PremierePtr premiere,
+                                                              std::vector<uint16_t> seatsToBook)
+    {
+        const std::optional<Admission::Permit> permit = admit();
+        if (permit && !permit.value())
+            co_return PricedBooking {};
+        co_return co_await bookPremiere(std::move(premiere), std::move(seatsToBook));
+    }
+
+    Async::Task<PricedBooking> AsyncBookingService::bookPremiere(BookingService::PremierePtr premiere,
+                                                                 std::vector<uint16_t> seatsToBook)
+    {
+        for (;;)
+        {
+            if (const std::optional<PricedBooking> booking = premiere->bookSeatsIfUncontended(seatsToBook); booking)
+                co_return booking.value();
+            co_await executor.yield();
+        }
+    }
+}
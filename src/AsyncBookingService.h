@@ -0,0 +1,122 @@
+/**
+ * @file       AsyncBookingService.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Coroutine-based asynchronous BookingService API declaration
+*/
+
+#ifndef BOOKINGSERVICE_ASYNCBOOKINGSERVICE_H
+#define BOOKINGSERVICE_ASYNCBOOKINGSERVICE_H
+
+#include "Admission.h"
+#include "BookingService.h"
+#include "Coroutines.h"
+
+namespace Booking
+{
+    /**
+     * @brief Asynchronous facade over the BookingService.<br>
+     * Every call returns an Async::Task to be co_await-ed. Contended bookings do not block on the
+     * Premiere::mtxBooking - the coroutine is suspended and rescheduled on the executor instead,
+     * so one thread can serve tens of thousands of in-flight requests
+     */
+    class AsyncBookingService
+    {
+    public:
+
+        /**
+         * Constructor
+         * @param service a reference to the existing BookingService instance
+         * @param executor the executor the suspended coroutines are rescheduled on
+         */
+        AsyncBookingService(BookingService& service, Async::Executor& executor) noexcept;
+
+        /**
+         * Puts the calls under the admission control: each call is executed only if admitted (the permit is held
+         * till the call completes, the suspensions included), otherwise it completes at once with the empty
+         * result (not booked). The rejections are counted by the controller (see AdmissionController::getStatistics())
+         * @param controller the admission controller shared with the other front ends: shall outlive the facade
+         * @param clientId the client the calls of the facade are made for
+         * @param lane Admission::Lane::Priority for the confirmed customers
+         */
+        void setAdmission(Admission::AdmissionController& controller,
+                          uint64_t clientId,
+                          Admission::Lane lane = Admission::Lane::Regular) noexcept;
+
+        /**
+         * Returns a collection of all available (existing) movies
+         */
+        [[nodiscard]]
+        Async::Task<std::vector<Movie*>> getMovies() const;
+
+        /**
+         * Returns a collection of all available (existing) theaters
+         */
+        [[nodiscard]]
+        Async::Task<std::vector<Theater*>> getTheaters() const;
+
+        /**
+         * Returns a list of movies currently playing in theaters
+         */
+        [[nodiscard]]
+        Async::Task<std::vector<Movie*>> getPlayingMovies() const;
+
+        /**
+         * Returns all theaters showing the movie
+         * @param movieName The name of the movie
+         */
+        [[nodiscard]]
+        Async::Task<std::vector<Theater*>> getTheatersByMovie(std::string movieName) const;
+
+        /**
+         * Returns a list of theater seats available for booking
+         * @param theaterName the Theater name
+         * @param movieName the Movie name
+         */
+        [[nodiscard]]
+        Async::Task<std::vector<uint16_t>> getSeatsAvailable(std::string theaterName,
+                                                             std::string movieName) const;
+
+        /**
+         * Books the seats for the premiere of the movie in the theater.<br>
+         * If the premiere is being booked by another thread at the moment, the coroutine yields
+         * to the executor and retries later
+         * @return the booking result (not booked - if the premiere not found or the seats are taken) and the price of
+         * the seats booked (see Premiere::bookSeatsPriced())
+         */
+        [[nodiscard]]
+        Async::Task<PricedBooking> bookSeats(std::string theaterName,
+                                             std::string movieName,
+                                             std::vector<uint16_t> seatsToBook);
+
+        /**
+         * Books the seats for the premiere (when the caller already holds the Premiere pointer)
+         */
+        [[nodiscard]]
+        Async::Task<PricedBooking> bookSeats(BookingService::PremierePtr premiere,
+                                             std::vector<uint16_t> seatsToBook);
+
+    private:
+
+        /** Admits the call: std::nullopt if there is no admission control **/
+        [[nodiscard]]
+        std::optional<Admission::Permit> admit() const noexcept;
+
+        /** Books the seats, retrying while the premiere is contended: the call is admitted already **/
+        [[nodiscard]]
+        Async::Task<PricedBooking> bookPremiere(BookingService::PremierePtr premiere,
+                                                std::vector<uint16_t> seatsToBook);
+
+        BookingService& service;
+        Async::Executor& executor;
+
+        /** No admission control, if not set **/
+        Admission::AdmissionController* admission { nullptr };
+        uint64_t clientId { 0 };
+        Admission::Lane lane { Admission::Lane::Regular };
+    };
+}
+
+#endif //BOOKINGSERVICE_ASYNCBOOKINGSERVICE_H
@@ -8,47 +8,438 @@
 */
 
 #include "BookingService.h"
+#include "Tracing.h"
 #include <algorithm>
 #include <iostream>
-#include <unordered_set>
+#include <thread>
+
+namespace
+{
+    using namespace std::chrono_literals;
+
+    /** The bounded waiting for the premiere: the busy loop first, then yielding the CPU and finally sleeping **/
+    constexpr size_t lockSpinsMax { 64 };
+    constexpr size_t lockYieldsMax { 256 };
+    constexpr std::chrono::steady_clock::duration lockSleepMax { 50us };
+
+    std::atomic<size_t> threadsCount { 0 };
+}
 
 namespace Booking
 {
+    double BookingStatistics::shedRate() const noexcept
+    {
+        const uint64_t total = booked + seatsTaken + timedOut;
+        return 0 == total ? 0.0 : static_cast<double>(timedOut) / static_cast<double>(total);
+    }
+
+    void BookingMetrics::record(BookingResult result) noexcept
+    {
+        thread_local const size_t threadIdx = threadsCount.fetch_add(1, std::memory_order_relaxed);
+        Stripe& stripe = stripes[threadIdx % stripesCount];
+        switch (result) {
+            case BookingResult::Booked:
+                stripe.booked.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case BookingResult::SeatsTaken:
+                stripe.seatsTaken.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case BookingResult::TimedOut:
+                stripe.timedOut.fetch_add(1, std::memory_order_relaxed);
+                break;
+        }
+    }
+
+    BookingStatistics BookingMetrics::getStatistics() const noexcept
+    {
+        BookingStatistics statistics;
+        for (const Stripe& stripe: stripes) {
+            statistics.booked += stripe.booked.load(std::memory_order_relaxed);
+            statistics.seatsTaken += stripe.seatsTaken.load(std::memory_order_relaxed);
+            statistics.timedOut += stripe.timedOut.load(std::memory_order_relaxed);
+        }
+        return statistics;
+    }
+
     Premiere::Premiere(const Theater& theater, const Movie& movie):
-            theaterId { theater.id }, movieId { movie.id} {
+            Premiere { theater.id, movie.id } {
+    }
+
+    Premiere::Premiere(size_t theaterId, size_t movieId) noexcept:
+            theaterId { theaterId }, movieId { movieId } {
+    }
+
+    template<typename Callback>
+    void Premiere::forEachAvailable(Callback&& callback) const
+    {
+        // The word shared with the other processes holds their bookings too: the seats mirror it by the bookings only
+        if (const std::atomic<uint32_t>* shared = sharedSeats.load(std::memory_order_acquire); nullptr != shared) {
+            const uint64_t booked = shared->load(std::memory_order_acquire);
+            SeatBits::forEachAvailable(std::span<const uint64_t> { &booked, 1 }, seats.capacity(),
+                                       std::forward<Callback>(callback));
+            return;
+        }
+        seats.forEachAvailable(std::forward<Callback>(callback));
     }
 
     std::vector<uint16_t> Premiere::getSeatsAvailable() const noexcept
     {
         std::vector<uint16_t> seatsAvailable;
-        seatsAvailable.reserve(seats.size());
-
-        for (int seatNum = 1; SeatStatus status: seats) {
-            if (SeatStatus::Available == status)
-                seatsAvailable.push_back(seatNum);
-            ++seatNum;
-        }
+        seatsAvailable.reserve(seats.capacity() - seats.bookedCount());
+        forEachAvailable([&seatsAvailable](uint16_t seatNum) {
+            seatsAvailable.push_back(seatNum);
+        });
+        return seatsAvailable;
+    }
 
-        seatsAvailable.shrink_to_fit();
+    std::pmr::vector<uint16_t> Premiere::getSeatsAvailable(std::pmr::memory_resource* resource) const
+    {
+        std::pmr::vector<uint16_t> seatsAvailable { resource };
+        seatsAvailable.reserve(seats.capacity());
+        forEachAvailable([&seatsAvailable](uint16_t seatNum) {
+            seatsAvailable.push_back(seatNum);
+        });
         return seatsAvailable;
     }
 
     // TODO: Describe CAS
     bool Premiere::bookSeats(const std::vector<uint16_t>& seatsToBook)
     {
-        std::lock_guard<std::mutex> lock {mtxBooking};
-        std::array<SeatStatus, Theater::seatsCapacityMax> seatsCopy {seats};
-        for (uint16_t seatNum: seatsToBook)
-        {
-            const uint16_t seatIdx = seatNum - 1;
-            if (0 >= seatNum || seatNum > Theater::seatsCapacityMax || SeatStatus::Booked == seatsCopy[seatIdx])
-                return false;
-            seatsCopy[seatIdx] = SeatStatus::Booked;
+        return bookSeats(std::span<const uint16_t> { seatsToBook });
+    }
+
+    bool Premiere::bookSeats(std::span<const uint16_t> seatsToBook)
+    {
+        return bookSeatsPriced(seatsToBook).booked;
+    }
+
+    PricedBooking Premiere::bookSeatsPriced(std::span<const uint16_t> seatsToBook)
+    {
+        const Tracing::Span span { "Premiere::bookSeats" };
+        const PricedBooking booking = [&] {
+            std::unique_lock<std::mutex> lock { mtxBooking, std::defer_lock };
+            {
+                const Tracing::Span waitSpan { "Premiere::mtxBooking wait" };
+                lock.lock();
+            }
+            return applyPricedBooking(seatsToBook);
+        }();
+        recordTrending(booking.booked);
+        return booking;
+    }
+
+    Quote Premiere::quoteSeats(std::span<const uint16_t> seatsToQuote) const noexcept
+    {
+        const uint32_t factor = priceFactor.load(std::memory_order_acquire);
+        return nullptr == pricing ? Quote { 0, factor } : pricing->quote(seatsToQuote, factor);
+    }
+
+    void Premiere::setShowtime(std::chrono::system_clock::time_point time) noexcept
+    {
+        showtime.store(std::chrono::duration_cast<std::chrono::seconds>(time.time_since_epoch()).count(),
+                       std::memory_order_relaxed);
+        if (nullptr != pricing)
+            pricing->markChanged();
+    }
+
+    bool Premiere::bookSeatsCombined(const std::vector<uint16_t>& seatsToBook)
+    {
+        return bookSeatsCombinedPriced(seatsToBook).booked;
+    }
+
+    PricedBooking Premiere::bookSeatsCombinedPriced(std::span<const uint16_t> seatsToBook)
+    {
+        const Tracing::Span span { "Premiere::bookSeatsCombined" };
+        // The combiner returns once the batch is applied and the lock is released
+        const PricedBooking booking = bookingCombiner.submit(seatsToBook, [this](std::span<const uint16_t> request) {
+            return applyPricedBooking(request);
+        });
+        recordTrending(booking.booked);
+        return booking;
+    }
+
+    std::optional<PricedBooking> Premiere::bookSeatsIfUncontended(std::span<const uint16_t> seatsToBook)
+    {
+        std::unique_lock<std::mutex> lock { mtxBooking, std::try_to_lock };
+        if (!lock.owns_lock())
+            return std::nullopt;
+        const PricedBooking booking = applyPricedBooking(seatsToBook);
+        lock.unlock();
+        recordTrending(booking.booked);
+        return booking;
+    }
+
+    BookingResult Premiere::tryBookSeats(const std::vector<uint16_t>& seatsToBook,
+                                         std::chrono::steady_clock::time_point deadline)
+    {
+        return tryBookSeats(std::span<const uint16_t> { seatsToBook }, deadline);
+    }
+
+    BookingResult Premiere::tryBookSeats(std::span<const uint16_t> seatsToBook,
+                                         std::chrono::steady_clock::time_point deadline)
+    {
+        return tryBookSeatsPriced(seatsToBook, deadline).result;
+    }
+
+    PricedBookingResult Premiere::tryBookSeatsPriced(std::span<const uint16_t> seatsToBook,
+                                                     std::chrono::steady_clock::time_point deadline)
+    {
+        const Tracing::Span span { "Premiere::tryBookSeats" };
+        const PricedBookingResult booking = [&] {
+            std::unique_lock<std::mutex> lock { mtxBooking, std::defer_lock };
+            // The deadline is checked before the first attempt too: the client has given up on the late request
+            for (size_t attempt = 0; ; ++attempt)
+            {
+                const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+                if (now >= deadline)
+                    return PricedBookingResult { BookingResult::TimedOut, Quote {} };
+                if (lock.try_lock())
+                    break;
+                if (attempt < lockSpinsMax)
+                    continue;
+                if (attempt < lockSpinsMax + lockYieldsMax)
+                    std::this_thread::yield();
+                else
+                    std::this_thread::sleep_for(std::min(lockSleepMax, deadline - now));
+            }
+            const PricedBooking priced = applyPricedBooking(seatsToBook);
+            return PricedBookingResult { priced.booked ? BookingResult::Booked : BookingResult::SeatsTaken,
+                                         priced.quote };
+        }();
+
+        recordTrending(BookingResult::Booked == booking.result);
+
+        if (nullptr != bookingMetrics)
+            bookingMetrics->record(booking.result);
+        return booking;
+    }
+
+    Premiere* PremiereSchedule::add(const Theater& theater, const Movie& movie)
+    {
+        reclaim();
+        while (!freeSlots.empty()) {
+            const size_t slot = freeSlots.back();
+            freeSlots.pop_back();
+            if (isVacant(slot))
+                return place(slot, theater, movie);
+        }
+        return place(premieres.size(), theater, movie);
+    }
+
+    Premiere* PremiereSchedule::add(size_t slot, const Theater& theater, const Movie& movie)
+    {
+        if (slot < premieres.size() && !isVacant(slot))
+            return nullptr;
+
+        // The slots skipped stay vacant: reusable once their premieres are unscheduled on the primary
+        while (premieres.size() < slot) {
+            freeSlots.push_back(premieres.size());
+            Premiere& vacant = premieres.emplace_back(vacantId, vacantId);
+            vacant.id = premieres.size() - 1;
+            theaterIds.push_back(vacantId);
+            movieIds.push_back(vacantId);
+        }
+        std::erase(freeSlots, slot);
+        return place(slot, theater, movie);
+    }
+
+    Premiere* PremiereSchedule::place(size_t slot, const Theater& theater, const Movie& movie)
+    {
+        if (slot == premieres.size()) {
+            Premiere& premiere = premieres.emplace_back(theater, movie);
+            premiere.id = slot;
+            theaterIds.push_back(theater.id);
+            movieIds.push_back(movie.id);
+            return &premiere;
+        }
+
+        Premiere& premiere = premieres[slot];
+        premiere.reschedule(theater, movie);
+        theaterIds[slot] = theater.id;
+        movieIds[slot] = movie.id;
+        return &premiere;
+    }
+
+    bool PremiereSchedule::remove(size_t theaterId, size_t movieId)
+    {
+        for (size_t idx = 0; idx < movieIds.size(); ++idx) {
+            if (movieIds[idx] == movieId && theaterIds[idx] == theaterId) {
+                theaterIds[idx] = movieIds[idx] = vacantId;
+                retiredSlots.retire(idx);
+                return true;
+            }
         }
+        return false;
+    }
 
-        seats.swap(seatsCopy);
+    size_t PremiereSchedule::removeByTheater(size_t theaterId)
+    {
+        size_t removed = 0;
+        for (size_t idx = 0; idx < theaterIds.size(); ++idx) {
+            if (theaterIds[idx] == theaterId && !isVacant(idx)) {
+                theaterIds[idx] = movieIds[idx] = vacantId;
+                retiredSlots.retire(idx);
+                ++removed;
+            }
+        }
+        return removed;
+    }
+
+    size_t PremiereSchedule::removeByMovie(size_t movieId)
+    {
+        size_t removed = 0;
+        for (size_t idx = 0; idx < movieIds.size(); ++idx) {
+            if (movieIds[idx] == movieId && !isVacant(idx)) {
+                theaterIds[idx] = movieIds[idx] = vacantId;
+                retiredSlots.retire(idx);
+                ++removed;
+            }
+        }
+        return removed;
+    }
+
+    size_t PremiereSchedule::reclaim()
+    {
+        return retiredSlots.reclaim([this](size_t slot) {
+            freeSlots.push_back(slot);
+        });
+    }
+
+    Premiere* PremiereSchedule::find(size_t theaterId, size_t movieId) const noexcept
+    {
+        // Scan the dense array of the Movie IDs: the premieres are touched only on the match
+        for (size_t idx = 0; idx < movieIds.size(); ++idx)
+            if (movieIds[idx] == movieId && theaterIds[idx] == theaterId)
+                return &premieres[idx];
+        return nullptr;
+    }
+
+    bool Premiere::applyBooking(std::span<const uint16_t> seatsToBook) noexcept
+    {
+        if (std::atomic<uint32_t>* shared = sharedSeats.load(std::memory_order_acquire); nullptr != shared)
+            return applySharedBooking(*shared, seatsToBook);
+
+        // All-or-nothing: the seat map books none of the seats, if any of them is not available
+        if (!seats.bookExclusive(seatsToBook))
+            return false;
+        publishOccupancy();
         return true;
     }
+
+    bool Premiere::applySharedBooking(std::atomic<uint32_t>& shared, std::span<const uint16_t> seatsToBook) noexcept
+    {
+        // The seats booked by the other processes are taken first: the seat map checks the request against them
+        uint32_t booked = shared.load(std::memory_order_acquire);
+        seats.setWord(0, booked);
+        if (!seats.bookExclusive(seatsToBook)) {
+            publishOccupancy();
+            return false;
+        }
+
+        // The single CAS books all the seats at once: retried while the other seats of the word change only
+        const uint32_t requested = static_cast<uint32_t>(seats.word(0)) & ~booked;
+        while (!shared.compare_exchange_weak(booked, booked | requested,
+                                             std::memory_order_acq_rel, std::memory_order_acquire)) {
+            if (0 != (booked & requested)) {
+                seats.setWord(0, booked);
+                publishOccupancy();
+                return false;
+            }
+        }
+        seats.setWord(0, booked | requested);
+        publishOccupancy();
+        return true;
+    }
+
+    void Premiere::shareSeats(std::atomic<uint32_t>* shared) noexcept
+    {
+        std::lock_guard<std::mutex> lock { mtxBooking };
+        if (nullptr != shared) {
+            const uint32_t local = static_cast<uint32_t>(seats.word(0));
+            seats.setWord(0, shared->fetch_or(local, std::memory_order_acq_rel) | local);
+            publishOccupancy();
+        }
+        sharedSeats.store(shared, std::memory_order_release);
+    }
+
+    PricedBooking Premiere::applyPricedBooking(std::span<const uint16_t> seatsToBook) noexcept
+    {
+        if (!applyBooking(seatsToBook))
+            return PricedBooking {};
+        // The factor is read before the lock is released: the price the seats were booked at
+        return PricedBooking { true, quoteSeats(seatsToBook) };
+    }
+
+    void Premiere::recordTrending(bool booked) const noexcept
+    {
+        // Not under the mtxBooking: the tracker may drain all its stripes, when the stripe of the thread is full
+        if (booked && nullptr != trending)
+            trending->recordBooking(movieId, theaterId);
+    }
+
+    void Premiere::publishOccupancy() noexcept
+    {
+        const uint32_t bitmap = static_cast<uint32_t>(seats.word(0));
+        // Single writer under the mtxBooking: no need for the read-modify-write
+        const uint32_t previous = seatsBooked.load(std::memory_order_relaxed);
+        if (previous == bitmap)
+            return;
+
+        seatsBooked.store(bitmap, std::memory_order_release);
+        // The slot of the new version still holds the version seatsHistorySize older than it: the fence orders the
+        // overwrite after the current version (the one before the new), so the readers seeing the overwritten
+        // slot see at least that version as well and drop the slot (see getSeatsChanges())
+        const uint64_t version = seatsVersion.load(std::memory_order_relaxed) + 1;
+        std::atomic_thread_fence(std::memory_order_release);
+        seatsHistory[version % seatsHistorySize].store(bitmap, std::memory_order_relaxed);
+        seatsVersion.store(version, std::memory_order_release);
+
+        if (nullptr != changeStream)
+            changeStream->publish(static_cast<uint32_t>(id), previous ^ bitmap);
+        if (nullptr != pricing)
+            pricing->markChanged();
+    }
+
+    void Premiere::reschedule(const Theater& theater, const Movie& movie) noexcept
+    {
+        std::lock_guard<std::mutex> lock { mtxBooking };
+        theaterId = theater.id;
+        movieId = movie.id;
+        sharedSeats.store(nullptr, std::memory_order_release);
+        seats.reset();
+        priceFactor.store(PricingEngine::factorBase, std::memory_order_relaxed);
+        showtime.store(0, std::memory_order_relaxed);
+        publishOccupancy();
+    }
+
+    SeatsUpdate Premiere::getSeatsChanges(uint64_t sinceVersion) const noexcept
+    {
+        for (;;)
+        {
+            const uint64_t version = seatsVersion.load(std::memory_order_acquire);
+            const bool known = sinceVersion <= version && version - sinceVersion < seatsHistorySize - 1;
+            const uint32_t current = seatsHistory[version % seatsHistorySize].load(std::memory_order_relaxed);
+            const uint32_t base = !known ? 0 :
+                    seatsHistory[sinceVersion % seatsHistorySize].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            // The history entries read are valid, unless the writers have overwritten them meanwhile. The slot of
+            // the version V is being overwritten as soon as the version V + seatsHistorySize - 1 is published
+            const uint64_t latest = seatsVersion.load(std::memory_order_relaxed);
+            if (latest - version >= seatsHistorySize - 1)
+                continue;
+            if (known && latest - sinceVersion >= seatsHistorySize - 1)
+                return SeatsUpdate { version, current, current, true };
+            return SeatsUpdate { version, current ^ base, current, !known };
+        }
+    }
+
+    std::optional<uint16_t> Premiere::findSeatsTogether(size_t seatsTogether) const noexcept
+    {
+        const std::atomic<uint32_t>* shared = sharedSeats.load(std::memory_order_acquire);
+        return SeatBits::firstRun((nullptr != shared ? *shared : seatsBooked).load(std::memory_order_acquire),
+                                  Theater::seatsCapacityMax, seatsTogether);
+    }
 }
 
 namespace Booking
@@ -63,6 +454,52 @@ namespace Booking
         return theaters.getAllEntries();
     }
 
+    std::vector<Movie*> BookingService::searchMovies(std::string_view query, size_t limit) const
+    {
+        // The index is changed by the catalog changes, under the catalog lock
+        std::shared_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+        std::vector<Movie*> found;
+        for (const SearchIndex::Match& match: moviesSearch.search(query, limit))
+            if (const std::optional<Movie*> movie = movies.findEntryByID(match.id); movie)
+                found.push_back(movie.value());
+        return found;
+    }
+
+    std::vector<Theater*> BookingService::searchTheaters(std::string_view query, size_t limit) const
+    {
+        // The index is changed by the catalog changes, under the catalog lock
+        std::shared_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+        std::vector<Theater*> found;
+        for (const SearchIndex::Match& match: theatersSearch.search(query, limit))
+            if (const std::optional<Theater*> theater = theaters.findEntryByID(match.id); theater)
+                found.push_back(theater.value());
+        return found;
+    }
+
+    SnapshotView<Movie> BookingService::getMoviesView() const
+    {
+        return moviesPublisher.view([this] {
+            std::shared_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+            return getMovies();
+        });
+    }
+
+    SnapshotView<Theater> BookingService::getTheatersView() const
+    {
+        return theatersPublisher.view([this] {
+            std::shared_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+            return getTheaters();
+        });
+    }
+
+    SnapshotView<Movie> BookingService::getPlayingMoviesView() const
+    {
+        return playingMoviesPublisher.view([this] {
+            std::shared_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+            return collectPlayingMovies();
+        });
+    }
+
     std::optional<Movie*>
     BookingService::findMovie(const std::string& name) const
     {
@@ -75,21 +512,40 @@ namespace Booking
         return theaters.findEntryName(name);
     }
 
-    [[nodiscard]]
     std::vector<Movie*> BookingService::getPlayingMovies() const
     {
-        std::unordered_set<size_t> idMovies;
-        for (const PremierePtr& premiere: bookingSchedule)
-            idMovies.insert(premiere->movieId);
+        std::shared_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+        return collectPlayingMovies();
+    }
 
+    std::vector<Movie*> BookingService::collectPlayingMovies() const
+    {
+        const DB::RoaringBitmap& playing = moviesAttributes.getPlaying();
         std::vector<Movie*> playingMovies;
-        playingMovies.reserve(idMovies.size());
-        for (size_t id: idMovies)
-            playingMovies.push_back(movies.findEntryByID(id).value());
-
+        playingMovies.reserve(playing.cardinality());
+        playing.forEach([&](uint32_t id) {
+            if (const std::optional<Movie*> movie = movies.findEntryByID(id); movie)
+                playingMovies.push_back(movie.value());
+        });
         return playingMovies;
     }
 
+    std::vector<Movie*> BookingService::getMovies(const MovieFilter& filter) const
+    {
+        std::shared_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+        const DB::RoaringBitmap selected = moviesAttributes.select(filter);
+        std::vector<Movie*> found;
+        found.reserve(selected.cardinality());
+        selected.forEach([&](uint32_t id) {
+            const std::optional<Movie*> movie = movies.findEntryByID(id);
+            if (!movie)
+                return;
+            if (!filter.durationMax || movie.value()->info.durationMinutes <= filter.durationMax.value())
+                found.push_back(movie.value());
+        });
+        return found;
+    }
+
     std::vector<Theater*> BookingService::getTheatersByMovie(const std::string& movieName) const
     {
         std::vector<Theater*> theatersByMovie;
@@ -97,9 +553,13 @@ namespace Booking
         if (!movie)
             return theatersByMovie;
 
-        for (const PremierePtr& premiere: bookingSchedule)
-            if (premiere->movieId == movie.value()->id)
-                theatersByMovie.push_back(theaters.findEntryByID(premiere->theaterId).value());
+        std::shared_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+        const std::span<const size_t> movieIds = bookingSchedule.getMovieIds();
+        const std::span<const size_t> theaterIds = bookingSchedule.getTheaterIds();
+        for (size_t idx = 0; idx < movieIds.size(); ++idx)
+            if (movieIds[idx] == movie.value()->id)
+                if (const std::optional<Theater*> theater = theaters.findEntryByID(theaterIds[idx]); theater)
+                    theatersByMovie.push_back(theater.value());
 
         return theatersByMovie;
     }
@@ -109,11 +569,19 @@ namespace Booking
     BookingService::getPremiere(const Theater* const theater,
                                 const Movie* const movie) const
     {
-        for (const PremierePtr& premiere: bookingSchedule) {
-            if (premiere->movieId == movie->id && premiere->theaterId == theater->id) {
-                return std::make_optional<PremierePtr>(premiere);
-            }
-        }
+        const Tracing::Span span { "BookingService::getPremiere" };
+        // The selection may be removed concurrently: the caller gets nullptr from the lookup then
+        if (nullptr == theater || nullptr == movie)
+            return std::nullopt;
+        return findPremiere(theater->id, movie->id);
+    }
+
+    std::optional<BookingService::PremierePtr>
+    BookingService::findPremiere(size_t theaterId, size_t movieId) const
+    {
+        std::shared_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+        if (const PremierePtr premiere = bookingSchedule.find(theaterId, movieId); premiere)
+            return std::make_optional<PremierePtr>(premiere);
         return std::nullopt;
     }
 
@@ -125,7 +593,7 @@ namespace Booking
         if (!movie)
             return std::nullopt;
         const std::optional<Theater*> theater = findTheater(theaterName);
-        if (!movie)
+        if (!theater)
             return std::nullopt;
 
         return getPremiere(theater.value(), movie.value());
@@ -141,6 +609,17 @@ namespace Booking
         return premiere.value()->getSeatsAvailable();
     }
 
+    std::pmr::vector<uint16_t> BookingService::getSeatsAvailable(const Theater* const theater,
+                                                                 const Movie* const movie,
+                                                                 std::pmr::memory_resource* resource) const
+    {
+        const std::optional<PremierePtr> premiere { getPremiere(theater, movie) };
+        if (!premiere.has_value())
+            return std::pmr::vector<uint16_t> { resource };
+
+        return premiere.value()->getSeatsAvailable(resource);
+    }
+
     std::vector<uint16_t> BookingService::getSeatsAvailable(const std::string& theaterName,
                                                             const std::string& movieName) const
     {
@@ -151,64 +630,266 @@ namespace Booking
         return premiere.value()->getSeatsAvailable();
     }
 
-    void BookingService::addMovie(const std::string& movieName)
+    std::vector<NearbyPremiere> BookingService::findNearestPremieres(const Movie* const movie,
+                                                                     const GeoPoint& location,
+                                                                     size_t seatsTogether,
+                                                                     size_t limit,
+                                                                     double radiusKm) const
+    {
+        const Tracing::Span span { "BookingService::findNearestPremieres" };
+        std::vector<NearbyPremiere> nearby;
+        std::shared_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+        const auto index = premieresByLocation.find(movie->id);
+        if (premieresByLocation.end() == index)
+            return nearby;
+
+        // The candidates come in the order of the distance: the availability is checked for the nearest ones only
+        const auto accept = [&](const GeoIndex::Match& match) {
+            Premiere& premiere = bookingSchedule[match.id];
+            const std::optional<uint16_t> firstSeat = premiere.findSeatsTogether(seatsTogether);
+            if (!firstSeat)
+                return false;
+
+            // The movie may be scheduled in the same theater more than once: the theater is listed once
+            if (std::any_of(nearby.begin(), nearby.end(), [&premiere](const NearbyPremiere& found) {
+                    return found.premiere->theaterId == premiere.theaterId; }))
+                return false;
+
+            const std::optional<Theater*> theater = theaters.findEntryByID(premiere.theaterId);
+            if (!theater)
+                return false;
+            nearby.push_back(NearbyPremiere { theater.value(), &premiere, match.distanceKm, firstSeat.value() });
+            return true;
+        };
+
+        nearby.reserve(std::min(limit, index->second.size()));
+        [[maybe_unused]] const std::vector<GeoIndex::Match> accepted =
+                index->second.nearest(location, limit, radiusKm, accept);
+        return nearby;
+    }
+
+    std::vector<NearbyPremiere> BookingService::findNearestPremieres(const std::string& movieName,
+                                                                     const GeoPoint& location,
+                                                                     size_t seatsTogether,
+                                                                     size_t limit,
+                                                                     double radiusKm) const
     {
-        movies.addEntry(movieName);
+        const std::optional<Movie*> movie = findMovie(movieName);
+        if (!movie)
+            return {};
+        return findNearestPremieres(movie.value(), location, seatsTogether, limit, radiusKm);
     }
 
-    void BookingService::addTheater(const std::string& theaterName)
+    void BookingService::addMovie(const std::string& movieName, MovieInfo info)
     {
-        theaters.addEntry(theaterName);
+        std::unique_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+        Movie* movie = movies.addEntry(movieName);
+        movie->info = std::move(info);
+        moviesSearch.add(movie->name, movie->id);
+        moviesAttributes.add(movie->id, movie->info);
+        moviesPublisher.invalidate();
+        catalogVersion.fetch_add(1, std::memory_order_release);
+    }
+
+    void BookingService::addTheater(const std::string& theaterName, std::optional<GeoPoint> location)
+    {
+        std::unique_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+        Theater* theater = theaters.addEntry(theaterName);
+        theater->location = location;
+        theatersSearch.add(theater->name, theater->id);
+        theatersPublisher.invalidate();
+        catalogVersion.fetch_add(1, std::memory_order_release);
     }
 
     bool BookingService::scheduleMovie(const std::string& movieName,
-                                       const std::string& theaterName)
+                                       const std::string& theaterName,
+                                       std::optional<size_t> premiereId)
+    {
+        // Looked up under the lock: the concurrent removal can not retire the entries in between
+        std::unique_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+        const std::optional<Movie*> movie { movies.findEntryName(movieName) };
+        if (!movie)
+            return false;
+        const std::optional<Theater*> theater { theaters.findEntryName(theaterName) };
+        if (!theater)
+            return false;
+
+        Premiere* premiere = premiereId ? bookingSchedule.add(premiereId.value(), *theater.value(), *movie.value())
+                                        : bookingSchedule.add(*theater.value(), *movie.value());
+        if (nullptr == premiere)
+            return false;
+        premiere->changeStream = &changeStream;
+        premiere->bookingMetrics = &bookingMetrics;
+        premiere->trending = &trending;
+        premiere->pricing = &pricing;
+        pricing.markChanged();
+        moviesAttributes.addPremiere(movie.value()->id);
+        if (const std::optional<GeoPoint>& location = theater.value()->location; location)
+            premieresByLocation[movie.value()->id].add(premiere->id, location.value());
+        playingMoviesPublisher.invalidate();
+        catalogVersion.fetch_add(1, std::memory_order_release);
+        return true;
+    }
+
+    bool BookingService::removeMovie(const std::string& movieName)
     {
+        std::unique_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
         const std::optional<Movie*> movie { movies.findEntryName(movieName) };
         if (!movie)
             return false;
+
+        // Unlinked from everywhere first: the new readers can not find it since then
+        const size_t movieId = movie.value()->id;
+        premieresByLocation.erase(movieId);
+        moviesAttributes.remove(movieId, movie.value()->info);
+        bookingSchedule.removeByMovie(movieId);
+        moviesSearch.remove(movieId);
+        retiredMovies.retire(movies.removeEntry(movieId));
+        moviesPublisher.invalidate();
+        playingMoviesPublisher.invalidate();
+        catalogVersion.fetch_add(1, std::memory_order_release);
+        reclaimIfPending();
+        return true;
+    }
+
+    bool BookingService::removeTheater(const std::string& theaterName)
+    {
+        std::unique_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
         const std::optional<Theater*> theater { theaters.findEntryName(theaterName) };
         if (!theater)
             return false;
 
-        bookingSchedule.emplace_back(std::make_shared<Premiere>(*theater.value(), *movie.value()));
+        const size_t theaterId = theater.value()->id;
+        const std::span<const size_t> theaterIds = bookingSchedule.getTheaterIds();
+        for (size_t slot = 0; slot < theaterIds.size(); ++slot)
+            if (theaterIds[slot] == theaterId && !bookingSchedule.isVacant(slot))
+                unindexPremiere(*theater.value(), bookingSchedule.getMovieIds()[slot], slot);
+        bookingSchedule.removeByTheater(theaterId);
+        theatersSearch.remove(theaterId);
+        retiredTheaters.retire(theaters.removeEntry(theaterId));
+        theatersPublisher.invalidate();
+        playingMoviesPublisher.invalidate();
+        catalogVersion.fetch_add(1, std::memory_order_release);
+        reclaimIfPending();
         return true;
     }
 
+    bool BookingService::unscheduleMovie(const std::string& movieName, const std::string& theaterName)
+    {
+        std::unique_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+        const std::optional<Movie*> movie { movies.findEntryName(movieName) };
+        const std::optional<Theater*> theater { theaters.findEntryName(theaterName) };
+        if (!movie || !theater)
+            return false;
+        const Premiere* premiere = bookingSchedule.find(theater.value()->id, movie.value()->id);
+        if (nullptr == premiere)
+            return false;
+
+        unindexPremiere(*theater.value(), movie.value()->id, premiere->id);
+        bookingSchedule.remove(theater.value()->id, movie.value()->id);
+
+        playingMoviesPublisher.invalidate();
+        catalogVersion.fetch_add(1, std::memory_order_release);
+        return true;
+    }
+
+    size_t BookingService::reclaim()
+    {
+        std::unique_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+        return retiredMovies.reclaim() + retiredTheaters.reclaim() + bookingSchedule.reclaim();
+    }
+
+    void BookingService::unindexPremiere(const Theater& theater, size_t movieId, size_t slot)
+    {
+        moviesAttributes.removePremiere(movieId);
+        if (!theater.location)
+            return;
+        const auto index = premieresByLocation.find(movieId);
+        if (premieresByLocation.end() == index)
+            return;
+        index->second.remove(slot, theater.location.value());
+        if (index->second.empty())
+            premieresByLocation.erase(index);
+    }
+
+    void BookingService::reclaimIfPending()
+    {
+        if (retiredMovies.size() + retiredTheaters.size() >= reclaimBatch) {
+            retiredMovies.reclaim();
+            retiredTheaters.reclaim();
+        }
+    }
+
+    size_t BookingService::reprice(bool force)
+    {
+        // The factors are atomic: the lookups and the bookings go on, the catalog changes wait
+        std::shared_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+        return pricing.reprice(bookingSchedule, PricingEngine::Clock::now(), force);
+    }
+
+    void BookingService::startRepricing(std::chrono::milliseconds batchInterval,
+                                        std::chrono::milliseconds forcedInterval)
+    {
+        repricer = std::jthread { [this, batchInterval, forcedInterval](std::stop_token stopToken) {
+            PricingEngine::Clock::time_point batchNext = PricingEngine::Clock::now();
+            PricingEngine::Clock::time_point forcedNext = batchNext;
+            while (!stopToken.stop_requested())
+            {
+                const bool changed = pricing.waitForChanges(stopToken, batchNext, forcedNext);
+                if (stopToken.stop_requested())
+                    break;
+
+                const PricingEngine::Clock::time_point now = PricingEngine::Clock::now();
+                const bool force = !changed || now >= forcedNext;
+                reprice(force);
+                batchNext = now + batchInterval;
+                if (force)
+                    forcedNext = now + forcedInterval;
+            }
+        }};
+    }
+
     // Create some default data
     // TODO : Create some data provider : for tests ??
     void BookingService::initialize()
     {
-        addMovie("Fight Club");
-        addMovie("The Lord of the Rings: The Fellowship of the Ring");
-        addMovie("The Lord of the Rings: The Two Towers");
-        addMovie("The Lord of the Rings: The Return of the King");
-        addMovie("The Green Mile");
-        addMovie("The Shawshank Redemption");
-        addMovie("Pulp Fiction");
-        addMovie("Terminator");
-        addMovie("Terminator 2: Judgment Day");
-        addMovie("Inception");
-        addMovie("Harry Potter and the Sorcerer's Stone");
-        addMovie("Harry Potter and the Chamber of Secrets");
-        addMovie("Harry Potter and the Goblet of Fire");
-        addMovie("Harry Potter and the Prisoner of Azkaban");
-
-        addTheater("Raj Mandir");
-        addTheater("Alamo Drafthouse");
-        addTheater("Cine Thisio");
-        addTheater("Kino International");
-        addTheater("4DX");
-        addTheater("Uplink X");
-        addTheater("Prasads");
-        addTheater("Cine de Chef");
-        addTheater("Castro Theatre");
-        addTheater("Rooftop Cinema");
-        addTheater("AMC Pacific Place Cinema");
-        addTheater("Odeon");
-        addTheater("Biograf Teater");
-        addTheater("Electric Cinema");
-        addTheater("Sun Pictures");
+        addMovie("Fight Club", MovieInfo { Genre::Drama, Rating::R, "en", Format::Standard, 139 });
+        addMovie("The Lord of the Rings: The Fellowship of the Ring",
+                 MovieInfo { Genre::Fantasy, Rating::PG13, "en", Format::IMAX, 178 });
+        addMovie("The Lord of the Rings: The Two Towers",
+                 MovieInfo { Genre::Fantasy, Rating::PG13, "en", Format::IMAX, 179 });
+        addMovie("The Lord of the Rings: The Return of the King",
+                 MovieInfo { Genre::Fantasy, Rating::PG13, "en", Format::IMAX, 201 });
+        addMovie("The Green Mile", MovieInfo { Genre::Drama, Rating::R, "en", Format::Standard, 189 });
+        addMovie("The Shawshank Redemption", MovieInfo { Genre::Drama, Rating::R, "en", Format::Standard, 142 });
+        addMovie("Pulp Fiction", MovieInfo { Genre::Crime, Rating::R, "en", Format::Standard, 154 });
+        addMovie("Terminator", MovieInfo { Genre::SciFi, Rating::R, "en", Format::Standard, 107 });
+        addMovie("Terminator 2: Judgment Day", MovieInfo { Genre::SciFi, Rating::R, "en", Format::ThreeD, 137 });
+        addMovie("Inception", MovieInfo { Genre::SciFi, Rating::PG13, "en", Format::IMAX, 148 });
+        addMovie("Harry Potter and the Sorcerer's Stone",
+                 MovieInfo { Genre::Fantasy, Rating::PG, "en", Format::Standard, 152 });
+        addMovie("Harry Potter and the Chamber of Secrets",
+                 MovieInfo { Genre::Fantasy, Rating::PG, "en", Format::Standard, 161 });
+        addMovie("Harry Potter and the Goblet of Fire",
+                 MovieInfo { Genre::Fantasy, Rating::PG13, "en", Format::IMAX, 157 });
+        addMovie("Harry Potter and the Prisoner of Azkaban",
+                 MovieInfo { Genre::Fantasy, Rating::PG, "en", Format::Standard, 142 });
+
+        addTheater("Raj Mandir", GeoPoint { 26.9157, 75.8097 });
+        addTheater("Alamo Drafthouse", GeoPoint { 30.26, -97.7516 });
+        addTheater("Cine Thisio", GeoPoint { 37.9715, 23.7192 });
+        addTheater("Kino International", GeoPoint { 52.5202, 13.4235 });
+        addTheater("4DX", GeoPoint { 52.5066, 13.3373 });
+        addTheater("Uplink X", GeoPoint { 35.6614, 139.6962 });
+        addTheater("Prasads", GeoPoint { 17.4135, 78.4656 });
+        addTheater("Cine de Chef", GeoPoint { 37.5243, 127.0224 });
+        addTheater("Castro Theatre", GeoPoint { 37.762, -122.4348 });
+        addTheater("Rooftop Cinema", GeoPoint { -37.8132, 144.9654 });
+        addTheater("AMC Pacific Place Cinema", GeoPoint { 47.6127, -122.3355 });
+        addTheater("Odeon", GeoPoint { 51.5103, -0.1301 });
+        addTheater("Biograf Teater", GeoPoint { 55.6751, 12.5707 });
+        addTheater("Electric Cinema", GeoPoint { 51.5155, -0.2053 });
+        addTheater("Sun Pictures", GeoPoint { -17.96, 122.2365 });
 
         scheduleMovie("Fight Club", "4DX") ;
         scheduleMovie("Fight Club", "Electric Cinema");
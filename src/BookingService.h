@@ -13,8 +13,29 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <span>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <chrono>
+#include <memory_resource>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <unordered_map>
 
 #include "Database.h"
+#include "ChunkedVector.h"
+#include "Snapshot.h"
+#include "ChangeStream.h"
+#include "SearchIndex.h"
+#include "GeoIndex.h"
+#include "MovieInfo.h"
+#include "Trending.h"
+#include "Pricing.h"
+#include "SeatMap.h"
+#include "Concurrency.h"
+#include "FlatCombiner.h"
 
 //! Contains base parts and features of the Booking Service implementation
 namespace Booking
@@ -34,6 +55,8 @@ namespace Booking
      */
     struct Movie: TableEntry<Movie>
     {
+        MovieInfo info;
+
         explicit Movie(std::string name): TableEntry (std::move(name)) {
         }
     };
@@ -46,15 +69,140 @@ namespace Booking
         /** Maximum number of seats the each Theater have **/
         static constexpr uint16_t seatsCapacityMax { 20 };
 
+        /** The Theater location: the theaters without one are not found by the nearby searches **/
+        std::optional<GeoPoint> location { std::nullopt };
+
         explicit Theater(std::string name): TableEntry {std::move(name)} {
         }
     };
 
+    /**
+     * @brief The changes of the premiere seat map since the version known to the client
+     */
+    struct SeatsUpdate
+    {
+        /** The current version of the seat map: to be passed to the next Premiere::getSeatsChanges() call **/
+        uint64_t version { 0 };
+
+        /** The seats changed since the requested version: booked or released (bit N - 1 for the seat N).
+         *  For the full update - all the booked seats (i.e. the changes since the empty seat map) **/
+        uint32_t seatsDelta { 0 };
+
+        /** The current booked seats bitmap **/
+        uint32_t seatsBooked { 0 };
+
+        /** The requested version is too old (or unknown): the client shall replace its seat map entirely **/
+        bool full { false };
+    };
+
+    /**
+     * @brief The outcome of the deadline-aware booking (see Premiere::tryBookSeats())
+     */
+    enum class BookingResult : uint8_t
+    {
+        Booked,
+
+        /** Any of the seats is booked already (or does not exist): the retry will not help **/
+        SeatsTaken,
+
+        /** The premiere stayed contended until the deadline (or the deadline had passed already): the seats were
+         *  not checked, the client may retry **/
+        TimedOut
+    };
+
+    /**
+     * @brief The outcomes of the deadline-aware bookings counted so far
+     */
+    struct BookingStatistics
+    {
+        uint64_t booked { 0 };
+        uint64_t seatsTaken { 0 };
+        uint64_t timedOut { 0 };
+
+        /** The share of the bookings given up on the deadline: the load shed by the service (zero - no bookings) **/
+        [[nodiscard]]
+        double shedRate() const noexcept;
+    };
+
+    /**
+     * @brief Counts the outcomes of the deadline-aware bookings of all the premieres of the service.<br>
+     * The counters are split between the stripes, each on its own cache line, and the thread counts to its home
+     * stripe (as the Admission::ConcurrencyLimiter does): the accounting adds no contention to the hot premieres
+     */
+    class BookingMetrics
+    {
+        struct alignas(Concurrency::cacheLineSize) Stripe
+        {
+            std::atomic<uint64_t> booked { 0 };
+            std::atomic<uint64_t> seatsTaken { 0 };
+            std::atomic<uint64_t> timedOut { 0 };
+        };
+
+        static constexpr size_t stripesCount { 16 };
+
+        std::array<Stripe, stripesCount> stripes {};
+
+    public:
+
+        void record(BookingResult result) noexcept;
+
+        [[nodiscard]]
+        BookingStatistics getStatistics() const noexcept;
+    };
+
+    /**
+     * @brief The outcome of the priced booking (see Premiere::bookSeatsPriced())
+     */
+    struct PricedBooking
+    {
+        bool booked { false };
+
+        /** The price of the seats booked at the moment of the booking (empty, if not booked) **/
+        Quote quote;
+    };
+
+    /**
+     * @brief The outcome of the deadline-aware priced booking (see Premiere::tryBookSeatsPriced())
+     */
+    struct PricedBookingResult
+    {
+        BookingResult result { BookingResult::TimedOut };
+
+        /** The price of the seats booked at the moment of the booking (empty, if not booked) **/
+        Quote quote;
+    };
+
     /**
      * @brief Premiere class: To combine the relationship of Theater, Movie and the status of seats for the audience
+     * <br> The layout is cache-line aware: the booking state (the lock and the seats) written on each booking
+     * occupies the first cache line of its own, and the premieres never share the cache lines with each other,
+     * so the bookings of the neighbouring premieres do not interfere (no false sharing)
      */
-    struct Premiere
+    struct alignas(Concurrency::cacheLineSize) Premiere
     {
+        mutable std::mutex mtxBooking;
+
+        /** The seats booked: the layout is selected by the capacity class of the Theater at compile time
+         *  (a single word for the Theater::seatsCapacityMax seats), see SeatMapFor **/
+        SeatMapFor<Theater::seatsCapacityMax> seats { Theater::seatsCapacityMax };
+
+        /** Bitmap mirror of the seats (bit N - 1 is set, if the seat N is booked): read without locking by the
+         *  analytics, so the reports never block the bookings **/
+        std::atomic<uint32_t> seatsBooked { 0 };
+
+        /** Number of the latest seat map versions kept: the deltas can be computed from all of them but the oldest,
+         *  whose slot is the one the next version is written to **/
+        static constexpr size_t seatsHistorySize { 16 };
+
+        /** The seat map version: incremented on each change of the seats **/
+        std::atomic<uint64_t> seatsVersion { 0 };
+
+        /** The seatsBooked bitmaps of the latest versions: the version V is at [V % seatsHistorySize] **/
+        std::array<std::atomic<uint32_t>, seatsHistorySize> seatsHistory {};
+
+        /** Collects the concurrent booking requests to be applied in batches under the mtxBooking lock **/
+        Concurrency::FlatCombiner<std::span<const uint16_t>, PricedBooking> bookingCombiner { mtxBooking };
+
         /** The unique identifier (from the database) of the Theater where the Movie with
          *  the appropriate movieId will be shown */
         size_t theaterId {0};
@@ -63,10 +211,30 @@ namespace Booking
          *  be shown in the Theater with the appropriate theaterId */
         size_t movieId {0};
 
-        /** Maximum number of seats the each Theater have **/
-        std::array<SeatStatus, Theater::seatsCapacityMax> seats {};
+        /** The premiere index in the schedule: identifies the premiere in the SeatChange events */
+        size_t id {0};
 
-        mutable std::mutex mtxBooking;
+        /** The stream the seats changes are published to (nullptr - the changes are not captured) */
+        ChangeStream* changeStream { nullptr };
+
+        /** The metrics the deadline-aware bookings are counted to (nullptr - not counted) */
+        BookingMetrics* bookingMetrics { nullptr };
+
+        /** The tracker the bookings are counted by (nullptr - not tracked) */
+        TrendingTracker* trending { nullptr };
+
+        /** The engine the seats are priced by (nullptr - the seats are free) */
+        PricingEngine* pricing { nullptr };
+
+        /** The price factor of the seats (permille of the zones base prices): set by PricingEngine::reprice() */
+        std::atomic<uint32_t> priceFactor { PricingEngine::factorBase };
+
+        /** The showtime, seconds since the system_clock epoch (zero - unknown): the lead time of the pricing */
+        std::atomic<int64_t> showtime { 0 };
+
+        /** The seats word shared with the other processes (see shareSeats()): nullptr - the seats are owned by this
+         *  process only */
+        std::atomic<std::atomic<uint32_t>*> sharedSeats { nullptr };
 
         /**
          * Create a new Premiere class object instance
@@ -77,6 +245,13 @@ namespace Booking
         */
         Premiere(const Theater& theater, const Movie& movie);
 
+        /**
+         * Create a new Premiere class object instance by the Theater and Movie IDs
+         * @param theaterId the ID of the Theater (may be already removed from the database)
+         * @param movieId the ID of the Movie (may be already removed from the database)
+        */
+        Premiere(size_t theaterId, size_t movieId) noexcept;
+
         /**
          * @brief Returns a list of theater seats available for booking
          * @return Object of the std::vector class with the numbers of seats.
@@ -84,6 +259,14 @@ namespace Booking
         [[nodiscard("Please check the result: Expensive to call")]]
         std::vector<uint16_t> getSeatsAvailable() const noexcept;
 
+        /**
+         * @brief Returns a list of theater seats available for booking
+         * @param resource the memory resource for the result (e.g. the Memory::RequestArena of the request)
+         * @return Object of the std::pmr::vector class with the numbers of seats.
+         */
+        [[nodiscard("Please check the result: Expensive to call")]]
+        std::pmr::vector<uint16_t> getSeatsAvailable(std::pmr::memory_resource* resource) const;
+
         /**
          * @brief Performs a booking/ reservations for the specified seats
          * @return True - in case of successful booking of the specified seats
@@ -91,6 +274,371 @@ namespace Booking
          */
         [[nodiscard("Please check the result: Expensive to call")]]
         bool bookSeats(const std::vector<uint16_t>& seatsToBook);
+
+        /**
+         * @brief Performs a booking/ reservations for the specified seats
+         * @param seatsToBook the seats numbers: may reside in any contiguous storage (array, arena, etc.)
+         * @return True - in case of successful booking of the specified seats
+         *         False - otherwise
+         * @note Never allocates memory
+         */
+        [[nodiscard("Please check the result: Expensive to call")]]
+        bool bookSeats(std::span<const uint16_t> seatsToBook);
+
+        /**
+         * @brief Performs a booking/ reservations for the specified seats and prices them: the price factor is read
+         * under the same lock the seats are booked with, so the quote is exactly the price of this booking, no
+         * matter how the prices are recomputed meanwhile
+         * @return the booking result and the price of the seats booked (zero, if the premiere is not priced)
+         * @note Never allocates memory
+         */
+        [[nodiscard("Please check the result: Expensive to call")]]
+        PricedBooking bookSeatsPriced(std::span<const uint16_t> seatsToBook);
+
+        /**
+         * @brief Returns the current price of the seats, whether they are available or not
+         * @note Lock-free: the booking may be priced differently, if the prices are recomputed in between
+         */
+        [[nodiscard]]
+        Quote quoteSeats(std::span<const uint16_t> seatsToQuote) const noexcept;
+
+        /**
+         * @brief Sets the showtime: the closer it is, the higher the price may be (see LeadTimeRule)
+         */
+        void setShowtime(std::chrono::system_clock::time_point time) noexcept;
+
+        /**
+         * @brief Performs a booking/ reservations for the specified seats using the flat combining.<br>
+         * Instead of the each thread taking the mtxBooking lock in turn, one thread applies the whole batch
+         * of the pending requests in a single pass. Each request is still applied as all-or-nothing
+         * @return True - in case of successful booking of the specified seats
+         *         False - otherwise
+         * @note Preferable for the hot premieres, when lots of threads book the seats simultaneously
+         */
+        [[nodiscard("Please check the result: Expensive to call")]]
+        bool bookSeatsCombined(const std::vector<uint16_t>& seatsToBook);
+
+        /**
+         * @brief Performs a booking/ reservations for the specified seats using the flat combining and prices them:
+         * the combiner reads the price factor under the lock the batch is applied with
+         * @return the booking result and the price of the seats booked (zero, if the premiere is not priced)
+         * @see bookSeatsCombined(), bookSeatsPriced()
+         */
+        [[nodiscard("Please check the result: Expensive to call")]]
+        PricedBooking bookSeatsCombinedPriced(std::span<const uint16_t> seatsToBook);
+
+        /**
+         * @brief Performs a booking/ reservations for the specified seats only if the premiere is not being
+         * booked by someone else at the moment (never blocks on the mtxBooking)
+         * @return std::nullopt - if the premiere is contended and the booking was not attempted, otherwise
+         *         the booking result and the price of the seats booked (see bookSeatsPriced())
+         */
+        [[nodiscard("Please check the result: Expensive to call")]]
+        std::optional<PricedBooking> bookSeatsIfUncontended(std::span<const uint16_t> seatsToBook);
+
+        /**
+         * @brief Performs a booking/ reservations for the specified seats, waiting for the premiere not longer than
+         * until the deadline: instead of blocking on the mtxBooking, spins, then yields the CPU, then sleeps in
+         * the short slices, checking the deadline in between
+         * @param deadline the time the client stops waiting for the result: the request past it is not served at all
+         * @return BookingResult::Booked - in case of successful booking of the specified seats,
+         *         BookingResult::SeatsTaken - if any of the seats is not available,
+         *         BookingResult::TimedOut - if the premiere stayed contended until the deadline
+         * @note The outcome is counted by the bookingMetrics, if set
+         */
+        [[nodiscard("Please check the result: Expensive to call")]]
+        BookingResult tryBookSeats(const std::vector<uint16_t>& seatsToBook,
+                                   std::chrono::steady_clock::time_point deadline);
+
+        /**
+         * @brief Performs a booking/ reservations for the specified seats, waiting for the premiere not longer than
+         * until the deadline
+         * @param seatsToBook the seats numbers: may reside in any contiguous storage (array, arena, etc.)
+         * @see tryBookSeats(const std::vector<uint16_t>&, std::chrono::steady_clock::time_point)
+         */
+        [[nodiscard("Please check the result: Expensive to call")]]
+        BookingResult tryBookSeats(std::span<const uint16_t> seatsToBook,
+                                   std::chrono::steady_clock::time_point deadline);
+
+        /**
+         * @brief Performs a booking/ reservations for the specified seats, waiting for the premiere not longer than
+         * until the deadline, and prices them under the booking lock
+         * @return the booking result and the price of the seats booked (zero, if not booked or not priced)
+         * @see tryBookSeats(), bookSeatsPriced()
+         */
+        [[nodiscard("Please check the result: Expensive to call")]]
+        PricedBookingResult tryBookSeatsPriced(std::span<const uint16_t> seatsToBook,
+                                               std::chrono::steady_clock::time_point deadline);
+
+        /**
+         * @brief Returns the seats changed since the specified version of the seat map as a single (coalesced)
+         * delta, no matter how many bookings happened in between. If the version is older than the
+         * seatsHistorySize - 1 latest ones, the full seat map is returned instead
+         * @param sinceVersion the version of the seat map known to the client (zero - the empty seat map)
+         * @note Lock-free: never blocks and never blocks the bookings, so any number of watchers may poll it
+         */
+        [[nodiscard]]
+        SeatsUpdate getSeatsChanges(uint64_t sinceVersion) const noexcept;
+
+        /**
+         * @brief Searches the seatsTogether available seats in a row
+         * @return the first seat of the leftmost such run or std::nullopt if there is none
+         * @note Lock-free (reads the seatsBooked mirror or the shared seats word): the seats found may be booked by
+         * the time the client books them, so the booking result shall still be checked
+         */
+        [[nodiscard]]
+        std::optional<uint16_t> findSeatsTogether(size_t seatsTogether) const noexcept;
+
+        /**
+         * @brief Updates the seatsBooked bitmap from the seats and publishes the changed seats to the changeStream
+         * @note Shall be called under the mtxBooking lock, if the seats were modified directly
+         */
+        void publishOccupancy() noexcept;
+
+        /**
+         * @brief Turns the premiere into the premiere of another Movie and/or Theater with all seats available:
+         * the slot of the unscheduled premiere is reused by the PremiereSchedule
+         * @note Shall not be called while any reader can reference the premiere
+         */
+        void reschedule(const Theater& theater, const Movie& movie) noexcept;
+
+        /**
+         * @brief Books the seats through the word shared with the other processes from now on (e.g. the seats of
+         * the Ipc::SharedInventory premiere): each booking is applied to the word by a single CAS, so the processes
+         * booking the same word never overbook. The seats booked already by the premiere and by the word are merged
+         * @param shared the seats word (bit N - 1 for the seat N): shall outlive the premiere, or be detached
+         * by nullptr. The premiere is detached by reschedule() as well
+         * @note The seatsBooked mirror and the changeStream see the seats booked by the other processes by the next
+         * booking of this premiere; getSeatsAvailable() and findSeatsTogether() read the shared word directly
+         */
+        void shareSeats(std::atomic<uint32_t>* shared) noexcept;
+
+    private:
+
+        /**
+         * @brief Books the seats in place, rolling back the partially booked seats in case of failure
+         * @note Shall be called under the mtxBooking lock
+         */
+        bool applyBooking(std::span<const uint16_t> seatsToBook) noexcept;
+
+        /**
+         * @brief Books the seats in the shared word (see shareSeats()) and mirrors it to the seats
+         * @note Shall be called under the mtxBooking lock
+         */
+        bool applySharedBooking(std::atomic<uint32_t>& shared, std::span<const uint16_t> seatsToBook) noexcept;
+
+        /**
+         * @brief Calls the callback for the each seat available: by the shared word, if set
+         */
+        template<typename Callback>
+        void forEachAvailable(Callback&& callback) const;
+
+        /**
+         * @brief Books the seats in place and prices them at the current price factor
+         * @note Shall be called under the mtxBooking lock
+         */
+        PricedBooking applyPricedBooking(std::span<const uint16_t> seatsToBook) noexcept;
+
+        /**
+         * @brief Counts the booking by the trending tracker (if any), if the seats were booked
+         * @note Shall be called after the mtxBooking lock is released
+         */
+        void recordTrending(bool booked) const noexcept;
+    };
+
+    static_assert(sizeof(Premiere::mtxBooking) + sizeof(Premiere::seats) + sizeof(Premiere::seatsBooked)
+                  <= Concurrency::cacheLineSize, "Premiere booking state shall fit into a single cache line");
+    static_assert(Theater::seatsCapacityMax <= 32, "Premiere::seatsBooked bitmap shall fit all the seats");
+
+    /**
+     * @brief Live seat map subscription of a client: remembers the version of the seat map the client has,
+     * so that each poll transfers only the seats changed since then
+     */
+    class SeatsSubscription
+    {
+        const Premiere& premiere;
+        uint64_t version { 0 };
+
+    public:
+
+        /**
+         * Constructor
+         * @param version the version of the seat map the client already has (zero - nothing)
+         */
+        explicit SeatsSubscription(const Premiere& premiere, uint64_t version = 0) noexcept:
+                premiere { premiere }, version { version } {
+        }
+
+        /**
+         * Returns the changes since the previous poll
+         * @return std::nullopt if the seat map has not changed
+         */
+        [[nodiscard]]
+        std::optional<SeatsUpdate> poll() noexcept
+        {
+            if (premiere.seatsVersion.load(std::memory_order_acquire) == version)
+                return std::nullopt;
+            const SeatsUpdate update = premiere.getSeatsChanges(version);
+            version = update.version;
+            return update;
+        }
+
+        [[nodiscard]]
+        uint64_t getVersion() const noexcept {
+            return version;
+        }
+    };
+
+    /**
+     * @brief The premieres schedule: premieres are stored contiguously in the stable chunks (the pointers to
+     * them are never invalidated), while their Theater and Movie IDs are duplicated into the separate plain
+     * arrays (struct-of-arrays), so the lookups scan the dense arrays of IDs and never touch the premieres
+     * themselves
+     * @note Like the DB::Table, additions and removals shall not run concurrently with the lookups: the
+     * BookingService serializes them by its catalog lock (see BookingService::findPremiere())
+     */
+    class PremiereSchedule
+    {
+        /** Number of premieres per storage chunk **/
+        static constexpr size_t premieresPerChunk { 64 };
+
+        /** The booking state of the premiere is synchronized by the premiere itself **/
+        mutable ChunkedVector<Premiere, premieresPerChunk> premieres;
+
+        std::vector<size_t> theaterIds;
+        std::vector<size_t> movieIds;
+
+        /** The slots of the unscheduled premieres: reused once no reader can reference them anymore **/
+        Concurrency::RetiredList<size_t> retiredSlots;
+        std::vector<size_t> freeSlots;
+
+        /** Places the premiere into the slot: either the new one or the vacant one **/
+        Premiere* place(size_t slot, const Theater& theater, const Movie& movie);
+
+    public:
+
+        /** The Theater and Movie ID of the vacant slot (the IDs of the entries start from 1) **/
+        static constexpr size_t vacantId { 0 };
+
+        /**
+         * Adds the premiere of the movie in the theater: into the reclaimed slot of the unscheduled premiere
+         * if any, so the schedule does not grow with the catalog churn
+         * @return pointer to the premiere: stays valid until the schedule destruction
+         */
+        Premiere* add(const Theater& theater, const Movie& movie);
+
+        /**
+         * Adds the premiere of the movie in the theater into the specified slot (see Premiere::id): the replicas
+         * mirror the slots of the primary
+         * @return pointer to the premiere or nullptr if the slot is occupied
+         * @note The slot is reused at once: no reader shall reference the premiere unscheduled from it. Shall not be
+         * mixed with add(const Theater&, const Movie&) for the same schedule
+         */
+        Premiere* add(size_t slot, const Theater& theater, const Movie& movie);
+
+        /**
+         * Unschedules the premiere: the slot becomes vacant (skipped by the lookups and the scans) and is reused
+         * once the readers which could have found the premiere are gone (see Concurrency::EpochDomain)
+         * @return False if there is no such premiere
+         */
+        bool remove(size_t theaterId, size_t movieId);
+
+        /**
+         * Unschedules all the premieres in the Theater
+         * @return the number of the premieres unscheduled
+         */
+        size_t removeByTheater(size_t theaterId);
+
+        /**
+         * Unschedules all the premieres of the Movie
+         * @return the number of the premieres unscheduled
+         */
+        size_t removeByMovie(size_t movieId);
+
+        /**
+         * Makes the slots no reader can reference anymore available for the additions
+         * @return the number of the slots reclaimed
+         */
+        size_t reclaim();
+
+        /**
+         * Returns True if the slot holds no premiere (the premiere was unscheduled)
+         */
+        [[nodiscard]]
+        bool isVacant(size_t slot) const noexcept {
+            return vacantId == movieIds[slot];
+        }
+
+        /**
+         * Returns the number of the vacant slots (the reclaimed ones and those waiting for the readers)
+         */
+        [[nodiscard]]
+        size_t vacantCount() const noexcept {
+            return retiredSlots.size() + freeSlots.size();
+        }
+
+        /**
+         * Searches the premiere of the specified movie in the specified theater
+         * @return the premiere pointer or nullptr, if there is no such premiere
+         */
+        [[nodiscard]]
+        Premiere* find(size_t theaterId, size_t movieId) const noexcept;
+
+        /**
+         * Returns the Theater ID of the each premiere (in the order premieres were added, vacantId - for the vacant slots)
+         */
+        [[nodiscard]]
+        std::span<const size_t> getTheaterIds() const noexcept {
+            return theaterIds;
+        }
+
+        /**
+         * Returns the Movie ID of the each premiere (in the order premieres were added, vacantId - for the vacant slots)
+         */
+        [[nodiscard]]
+        std::span<const size_t> getMovieIds() const noexcept {
+            return movieIds;
+        }
+
+        [[nodiscard]]
+        Premiere& operator[](size_t idx) const noexcept {
+            return premieres[idx];
+        }
+
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return premieres.size();
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return premieres.empty();
+        }
+
+        [[nodiscard]]
+        auto begin() const noexcept {
+            return premieres.begin();
+        }
+
+        [[nodiscard]]
+        auto end() const noexcept {
+            return premieres.end();
+        }
+    };
+
+    /**
+     * @brief The premiere found by the nearby search (see BookingService::findNearestPremieres())
+     */
+    struct NearbyPremiere
+    {
+        Theater* theater { nullptr };
+        Premiere* premiere { nullptr };
+
+        /** The distance from the requested location to the Theater **/
+        double distanceKm { 0 };
+
+        /** The first of the requested seats available in a row **/
+        uint16_t firstSeat { 0 };
     };
 
     /**
@@ -101,11 +649,27 @@ namespace Booking
      */
     struct BookingService
     {
-        using PremierePtr = std::shared_ptr<Premiere>;
+        /** Premieres are owned by the bookingSchedule: the pointer stays valid while the service lives **/
+        using PremierePtr = Premiere*;
+
+        /** The nearby searches radius not limiting the distance **/
+        static constexpr double anyDistanceKm { std::numeric_limits<double>::infinity() };
 
         Table<Movie> movies;
         Table<Theater> theaters;
-        std::vector<PremierePtr> bookingSchedule;
+        PremiereSchedule bookingSchedule;
+
+        /** Every change of the premieres seats: for the downstream systems (seat-map UIs, analytics, etc.) **/
+        ChangeStream changeStream;
+
+        /** The outcomes of the deadline-aware bookings of the premieres (see Premiere::tryBookSeats()) **/
+        BookingMetrics bookingMetrics;
+
+        /** The movies and theaters by the bookings of the last minutes (see TrendingTracker) **/
+        TrendingTracker trending;
+
+        /** The seats prices of the premieres: recomputed by reprice(), see startRepricing() **/
+        PricingEngine pricing;
 
         /**
          * Tries to find a Movie type object in the database by name
@@ -149,6 +713,14 @@ namespace Booking
         [[nodiscard]]
         std::vector<Movie*> getPlayingMovies() const;
 
+        /**
+         * Returns the movies matching the filter: the intersection of the attributes bitmaps (see MovieAttributesIndex)
+         * @param filter the attributes values required (e.g. playing, comedy, IMAX, English)
+         * @return a std::vector collection Movie* objects in the order of their IDs
+        */
+        [[nodiscard]]
+        std::vector<Movie*> getMovies(const MovieFilter& filter) const;
+
         /**
          * Returns all theaters showing the movie
          * @param movieName The name of the movie
@@ -157,6 +729,55 @@ namespace Booking
         [[nodiscard]]
         std::vector<Theater*> getTheatersByMovie(const std::string& movieName) const;
 
+        /**
+         * Searches the movies by the partial or misspelled name
+         * @param query the beginning of the name (or of any word in it) or the name with typos
+         * @param limit the maximum number of the results
+         * @return the best matching movies: prefix matches first, then the similar names
+        */
+        [[nodiscard]]
+        std::vector<Movie*> searchMovies(std::string_view query, size_t limit) const;
+
+        /**
+         * Searches the theaters by the partial or misspelled name
+         * @param query the beginning of the name (or of any word in it) or the name with typos
+         * @param limit the maximum number of the results
+         * @return the best matching theaters: prefix matches first, then the similar names
+        */
+        [[nodiscard]]
+        std::vector<Theater*> searchTheaters(std::string_view query, size_t limit) const;
+
+        /**
+         * Returns the immutable snapshot of all available (existing) movies
+         * @return a view of the snapshot: no allocations and no locking in the steady state
+         * @note Preferable over getMovies() for the frequent listings: the catalog changes rarely
+        */
+        [[nodiscard]]
+        SnapshotView<Movie> getMoviesView() const;
+
+        /**
+         * Returns the immutable snapshot of all available (existing) theaters
+         * @return a view of the snapshot: no allocations and no locking in the steady state
+        */
+        [[nodiscard]]
+        SnapshotView<Theater> getTheatersView() const;
+
+        /**
+         * Returns the immutable snapshot of the movies currently playing in theaters
+         * @return a view of the snapshot: no allocations and no locking in the steady state
+        */
+        [[nodiscard]]
+        SnapshotView<Movie> getPlayingMoviesView() const;
+
+        /**
+         * Returns the version of the catalog: incremented by each change of the movies, the theaters or the premieres
+         * scheduled, so anything derived from the catalog (e.g. the rendered listings) is valid while it is the same
+        */
+        [[nodiscard]]
+        uint64_t getCatalogVersion() const noexcept {
+            return catalogVersion.load(std::memory_order_acquire);
+        }
+
         /**
          * Returns the premiere (an object of the Premiere class) of the specified movie in the specified cinema, if any
          * @param theater Theater class instance pointer (the Theater where the film is being shown)
@@ -185,6 +806,25 @@ namespace Booking
         std::optional<PremierePtr> getPremiere(const std::string& theaterName,
                                                const std::string & movieName) const;
 
+        /**
+         * Returns the premiere of the Movie in the Theater by their IDs, if any
+         * @note The lookup takes the catalog lock shared: safe against the concurrent catalog changes
+        */
+        [[nodiscard]]
+        std::optional<PremierePtr> findPremiere(size_t theaterId, size_t movieId) const;
+
+        /**
+         * Runs the reader of the catalog indexes (e.g. the scan of the bookingSchedule) under the catalog lock
+         * taken shared: the catalog changes wait for it
+         * @note The reader shall not call the lookups of the service taking the catalog lock themselves
+        */
+        template<typename Reader>
+        decltype(auto) readCatalog(Reader&& reader) const
+        {
+            std::shared_lock<Concurrency::WriterPreferringMutex> lock { mtxCatalog };
+            return std::forward<Reader>(reader)();
+        }
+
         /**
          * Returns a list of theater seats available for booking
          * @param theater Theater class instance pointer
@@ -211,33 +851,175 @@ namespace Booking
         std::vector<uint16_t> getSeatsAvailable(const std::string& theaterName,
                                                 const std::string& movieName) const;
 
+        /**
+         * Returns a list of theater seats available for booking
+         * @param theater Theater class instance pointer
+         * @param movie Movie class instance pointer
+         * @param resource the memory resource for the result (e.g. the Memory::RequestArena of the request)
+         * @return Object of the std::pmr::vector class with the numbers of seats. In case if all seats already
+         * booked a empty collection shall be return
+        */
+        [[nodiscard]]
+        std::pmr::vector<uint16_t> getSeatsAvailable(const Theater* const theater,
+                                                     const Movie* const movie,
+                                                     std::pmr::memory_resource* resource) const;
+
         /**
          * Adds a Movie to the Database by its name
          * @param movieName the Movie name
+         * @param info the Movie metadata (see getMovies(const MovieFilter&))
          * @note A test function.
         */
-        void addMovie(const std::string& movieName);
+        void addMovie(const std::string& movieName, MovieInfo info = {});
+
+        /**
+         * Returns the premieres of the movie nearest to the location, having the requested seats available in a row.
+         * The premieres are pruned by the distance first (see GeoIndex), the availability is checked for the nearest
+         * candidates only
+         * @param movie Movie class instance pointer
+         * @param location the location to search around
+         * @param seatsTogether the number of the seats in a row required
+         * @param limit the maximum number of the results (top-k): a Theater is listed once
+         * @param radiusKm the theaters farther than the radius are not considered
+         * @return the premieres ordered by the distance to the theater
+        */
+        [[nodiscard]]
+        std::vector<NearbyPremiere> findNearestPremieres(const Movie* const movie,
+                                                         const GeoPoint& location,
+                                                         size_t seatsTogether,
+                                                         size_t limit,
+                                                         double radiusKm = anyDistanceKm) const;
+
+        /**
+         * Returns the premieres of the movie nearest to the location, having the requested seats available in a row
+         * @param movieName the Movie name
+         * @note The method is less performant than
+         * BookingService::findNearestPremieres(const Movie* const, const GeoPoint&, size_t, size_t, double) const
+        */
+        [[nodiscard]]
+        std::vector<NearbyPremiere> findNearestPremieres(const std::string& movieName,
+                                                         const GeoPoint& location,
+                                                         size_t seatsTogether,
+                                                         size_t limit,
+                                                         double radiusKm = anyDistanceKm) const;
 
         /**
          * Adds a Theater to the Database by its name
          * @param theaterName the Theater name
+         * @param location the Theater location, if known (see findNearestPremieres())
          * @note A test function.
         */
-        void addTheater(const std::string& theaterName);
+        void addTheater(const std::string& theaterName, std::optional<GeoPoint> location = std::nullopt);
 
         /**
          * Schedule a premiere (Premiere) for the specific Movie ad the specific Theater
          * @param movieName the Movie name
          * @param theaterName the Theater name
+         * @param premiereId the schedule slot for the premiere (see PremiereSchedule::add(size_t, ...)), if specified
          * @note A test function.
         */
-        bool scheduleMovie(const std::string& movieName, const std::string& theaterName);
+        bool scheduleMovie(const std::string& movieName, const std::string& theaterName,
+                           std::optional<size_t> premiereId = std::nullopt);
+
+        /**
+         * Removes the Movie together with all its premieres
+         * @param movieName the Movie name
+         * @return False if there is no such movie
+         * @note The readers which have found the Movie (or its premieres) inside of the EpochDomain::Guard may keep
+         * using it until the guard is released: the memory is reclaimed only after that (see reclaim())
+        */
+        bool removeMovie(const std::string& movieName);
+
+        /**
+         * Removes the Theater together with all its premieres
+         * @param theaterName the Theater name
+         * @return False if there is no such theater
+         * @note The readers which have found the Theater (or its premieres) inside of the EpochDomain::Guard may keep
+         * using it until the guard is released: the memory is reclaimed only after that (see reclaim())
+        */
+        bool removeTheater(const std::string& theaterName);
+
+        /**
+         * Removes the premiere of the specific Movie at the specific Theater
+         * @return False if there is no such premiere
+         * @note The seats of the premiere are released only when its slot is reused (see PremiereSchedule::remove())
+        */
+        bool unscheduleMovie(const std::string& movieName, const std::string& theaterName);
+
+        /**
+         * Reclaims the memory of the removed movies and theaters and the slots of the unscheduled premieres,
+         * which no reader can reference anymore. Called by the removals as well, once a batch is pending
+         * @return the number of the objects reclaimed
+        */
+        size_t reclaim();
+
+        /**
+         * Recomputes the price factors of the premieres (see PricingEngine::reprice())
+         * @param force recompute, even if the occupancy has not changed since the previous batch
+         * @return the number of the premieres whose price factor has changed
+         * @note Serialized with the catalog changes: may be called concurrently with the scheduling
+        */
+        size_t reprice(bool force = false);
+
+        /**
+         * Starts the repricing thread: the prices follow the occupancy without the caller driving reprice().
+         * The thread is woken by the first change of the seats after the batch, the changes made within the
+         * batchInterval are coalesced into a single batch. The forced batch runs every forcedInterval: the lead
+         * time to the showtimes changes with the time only
+         * @note Stopped by the destruction of the service
+        */
+        void startRepricing(std::chrono::milliseconds batchInterval = std::chrono::milliseconds { 50 },
+                            std::chrono::milliseconds forcedInterval = std::chrono::minutes { 1 });
 
         /**
          * It is used for the purpose of initializing the test dataset
          * @note A test function.
         */
         void initialize();
+
+    private:
+
+        /** Guards the catalog indexes (the schedule IDs, the search, the geo and the attributes indexes): exclusive
+         *  for the catalog changes, shared for the lookups and the snapshots rebuilds. Prefers the catalog changes:
+         *  the lookups made in a loop can not starve them **/
+        mutable Concurrency::WriterPreferringMutex mtxCatalog;
+
+        /** Incremented under the mtxCatalog lock, after the change is made **/
+        std::atomic<uint64_t> catalogVersion { 1 };
+
+        SearchIndex moviesSearch;
+        SearchIndex theatersSearch;
+
+        mutable SnapshotPublisher<Movie> moviesPublisher;
+        mutable SnapshotPublisher<Theater> theatersPublisher;
+        mutable SnapshotPublisher<Movie> playingMoviesPublisher;
+
+        /** The premieres (their schedule slots) in the theaters having the location, by the Movie ID **/
+        std::unordered_map<size_t, GeoIndex> premieresByLocation;
+
+        /** The movies by their attributes values and by the premieres scheduled (playing) **/
+        MovieAttributesIndex moviesAttributes;
+
+        /** Number of the pending removed entries which triggers the reclamation: off the booking path **/
+        static constexpr size_t reclaimBatch { 16 };
+
+        /** The removed entries: destroyed (into the pools of the tables) once no reader can reference them **/
+        Concurrency::RetiredList<std::shared_ptr<Movie>> retiredMovies;
+        Concurrency::RetiredList<std::shared_ptr<Theater>> retiredTheaters;
+
+        /** The movies having the premieres scheduled. Shall be called under the mtxCatalog lock **/
+        [[nodiscard]]
+        std::vector<Movie*> collectPlayingMovies() const;
+
+        /** Removes the premiere from the premieresByLocation and the moviesAttributes. Shall be called under
+         *  the mtxCatalog lock **/
+        void unindexPremiere(const Theater& theater, size_t movieId, size_t slot);
+
+        /** Reclaims the removed entries, if the batch is pending. Shall be called under the mtxCatalog lock **/
+        void reclaimIfPending();
+
+        /** Drives the pricing (see startRepricing()): declared last, so it is stopped before anything it uses **/
+        std::jthread repricer;
     };
 };
 
@@ -10,14 +10,45 @@
 #include "CLI.h"
 #include <iostream>
 #include <charconv>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
 
 namespace
 {
-    std::ostream& operator<<(std::ostream& stream, const std::vector<uint16_t>& values) {
+    std::ostream& operator<<(std::ostream& stream, std::span<const uint16_t> values) {
         for (uint16_t seatNum: values)
             stream << seatNum << " ";
         return stream;
     }
+
+    /** Prints the occupancy as "<booked>/<total> seats booked (<percent>%)" **/
+    std::ostream& operator<<(std::ostream& stream, const Booking::OccupancyRow& row) {
+        const auto permille = static_cast<size_t>(row.ratio() * 1000 + 0.5);
+        return stream << row.seatsBooked << "/" << row.seatsTotal << " seats booked ("
+                      << permille / 10 << "." << permille % 10 << "%)";
+    }
+
+    /** Prints the numbers of the seats set in the bitmap (see Booking::Premiere::seatsBooked) **/
+    void printSeats(std::ostream& stream, uint32_t bitmap) {
+        for (uint16_t seatNum = 1; 0 != bitmap; ++seatNum, bitmap >>= 1)
+            if (bitmap & 1u)
+                stream << seatNum << " ";
+    }
+
+    template<typename Container>
+    Container& splitInto(Container& output, std::string_view input, std::string_view delim)
+    {
+        for (size_t first = 0, size = input.size(), second = 0; first < size; ) {
+            second = input.find(delim, first);
+            if (first != second)
+                output.emplace_back(input.substr(first, second - first));
+            if (second == std::string_view::npos)
+                break;
+            first = second + 1;
+        }
+        return output;
+    }
 }
 
 namespace CLI
@@ -39,8 +70,10 @@ namespace CLI
             return true;
         }
 
-        std::vector<uint16_t> seatsToBook;
-        auto extractSeats = [&seatsToBook](const std::vector<std::string_view>& parts){
+        // The request data lives in the arena on the stack: no heap allocations in the booking path
+        Memory::RequestArena<requestArenaSize> arena;
+        std::pmr::vector<uint16_t> seatsToBook { arena.get() };
+        auto extractSeats = [&seatsToBook](std::span<const std::string_view> parts){
             for (const std::string_view& seatNum: parts) {
                 const auto [_, error] =
                         std::from_chars(seatNum.data(), seatNum.data() + seatNum.size(), seatsToBook.emplace_back());
@@ -51,21 +84,28 @@ namespace CLI
         };
 
         bool parsed = false;
-        if (std::string_view::npos != params.find(','))
-            parsed = extractSeats(split(params, ","));
-        else
-            parsed = extractSeats({params});
+        {
+            const Tracing::Span span { "SimpleCLI::parseSeats" };
+            if (std::string_view::npos != params.find(','))
+                parsed = extractSeats(split(params, ",", arena.get()));
+            else
+                parsed = extractSeats({&params, 1});
+        }
 
         if (!parsed) {
             outStream << "Incorrect syntax: '" << params << "'. Format expected: [1,2,3,4,5] or [1]";
             return true;
         }
 
-        const auto premiere = service.getPremiere(theaterSelected.value(), movieSelected.value());
-        if (!premiere.value()->bookSeats(seatsToBook)) {
+        // The selection may be removed after the revalidation: getPremiere() finds nothing for nullptr then
+        const auto premiere = service.getPremiere(getTheaterSelected(), getMovieSelected());
+        if (!premiere) {
+            outStream << "No such premiere\n";
+        } else if (const PricedBooking booking = premiere.value()->bookSeatsPriced(seatsToBook); !booking.booked) {
             outStream << "Sorry: Failed to book seats: " << params << std::endl;
         } else {
-            outStream << "Seats " << params  << " are booked\n";
+            outStream << "Seats " << params  << " are booked. Price: " << booking.quote.price / 100 << "."
+                      << booking.quote.price % 100 / 10 << booking.quote.price % 10 << "\n";
         }
 
         return true;
@@ -80,8 +120,17 @@ namespace CLI
             outStream << "Please select a Theater to see the available slots\n";
         }
         else {
-            const std::vector<uint16_t> seats = service.getSeatsAvailable(theaterSelected.value() ,movieSelected.value());
-            outStream << "Theater: " << theaterSelected.value()->name << ", Movie : " << movieSelected.value()->name
+            // Resolved once: the selection may be removed concurrently, after the revalidation
+            const Theater* const theater = getTheaterSelected();
+            const Movie* const movie = getMovieSelected();
+            if (nullptr == theater || nullptr == movie) {
+                outStream << "No such premiere\n";
+                return true;
+            }
+
+            Memory::RequestArena<requestArenaSize> arena;
+            const std::pmr::vector<uint16_t> seats = service.getSeatsAvailable(theater, movie, arena.get());
+            outStream << "Theater: " << theater->name << ", Movie : " << movie->name
                       << "\nSeats available: " << seats << std::endl;
         }
         return true;
@@ -94,11 +143,12 @@ namespace CLI
             return false;
         }
 
-        const std::vector<Theater*> allTheaters = service.getTheatersByMovie(name.data());
-        outStream << "The movie '" << name << "' is being shown in:\n";
-        for (const auto& theater: allTheaters)
-            outStream << '\t' << theater->name << std::endl;
-
+        respondCached(ResponseCache::Listing::TheatersByMovie, name, [&](std::ostream& out) {
+            const std::vector<Theater*> allTheaters = service.getTheatersByMovie(std::string { name });
+            out << "The movie '" << name << "' is being shown in:\n";
+            for (const auto& theater: allTheaters)
+                out << '\t' << theater->name << '\n';
+        });
         return true;
     }
 
@@ -113,13 +163,14 @@ namespace CLI
         if (const std::optional<Theater*> theater = service.findTheater(name.data()); !theater) {
             outStream << "Failed to find the '" << name << "' theater\n";
         }
-        else if (movieSelected && theater && !service.getPremiere(theater.value(), movieSelected.value()))
+        else if (const Movie* const movie = getMovieSelected();
+                 movieSelected && (nullptr == movie || !service.getPremiere(theater.value(), movie)))
         {
-            outStream << "Unfortunately, the " << movieSelected.value()->name << " movie is not being shown at the "
-                      << theater.value()->name << " cinema\n";
+            outStream << "Unfortunately, the " << (movie ? movie->name : "selected") << " movie is not being shown "
+                      << "at the " << theater.value()->name << " cinema\n";
         } else {
-            theaterSelected = theater.value();
-            outStream << "The " << theaterSelected.value()->name << " theater is chosen\n";
+            theaterSelected = theater.value()->id;
+            outStream << "The " << theater.value()->name << " theater is chosen\n";
         }
         return true;
     }
@@ -136,57 +187,363 @@ namespace CLI
         if (const std::optional<Movie*> optMovie = service.findMovie(name.data()); !optMovie) {
             outStream << "Failed to find the '" << name << "' movie\n";
         }
-        else if (theaterSelected && optMovie && !service.getPremiere(theaterSelected.value(), optMovie.value()))
+        else if (const Theater* const theater = getTheaterSelected();
+                 theaterSelected && (nullptr == theater || !service.getPremiere(theater, optMovie.value())))
         {
             outStream << "Unfortunately, the " << optMovie.value()->name << " movie is not being shown at the "
-                      << theaterSelected.value()->name << " cinema\n";
+                      << (theater ? theater->name : "selected") << " cinema\n";
         } else {
-            movieSelected = optMovie.value();
-            outStream << "The " << movieSelected.value()->name << " movie is chosen\n";
+            movieSelected = optMovie.value()->id;
+            outStream << "The " << optMovie.value()->name << " movie is chosen\n";
         }
         return true;
     }
 
     bool SimpleCLI::listAllTheaters(std::string_view)
     {
-        const std::vector<Booking::Theater*> allTheaters = service.getTheaters();
-        for (const auto& theater: allTheaters)
-            outStream << '\t' << theater->name << std::endl;
+        respondCached(ResponseCache::Listing::Theaters, ""sv, [this](std::ostream& out) {
+            for (const auto& theater: service.getTheatersView())
+                out << '\t' << theater->name << '\n';
+        });
+        return true;
+    }
 
+    bool SimpleCLI::listAllMovies(std::string_view filters)
+    {
+        respondCached(ResponseCache::Listing::Movies, filters, [&](std::ostream& out) {
+            if (filters.empty()) {
+                for (const auto& movie: service.getMoviesView())
+                    out << '\t' << movie->name << '\n';
+            } else if (const std::optional<MovieFilter> filter = parseMovieFilter(filters, out); filter) {
+                for (const Movie* movie: service.getMovies(filter.value()))
+                    out << '\t' << movie->name << '\n';
+            }
+        });
         return true;
     }
 
-    bool SimpleCLI::listAllMovies(std::string_view)
+    bool SimpleCLI::listPlayingMovies(std::string_view filters)
     {
-        const std::vector<Booking::Movie*> allMovies = service.getMovies();
-        for (const auto& movie: allMovies)
-            outStream << '\t' << movie->name << std::endl;
+        respondCached(ResponseCache::Listing::PlayingMovies, filters, [&](std::ostream& out) {
+            if (filters.empty()) {
+                for (const auto& movie: service.getPlayingMoviesView())
+                    out << '\t' << movie->name << '\n';
+                return;
+            }
 
+            std::optional<MovieFilter> filter = parseMovieFilter(filters, out);
+            if (!filter)
+                return;
+            filter->playingOnly = true;
+            for (const Movie* movie: service.getMovies(filter.value()))
+                out << '\t' << movie->name << '\n';
+        });
         return true;
     }
 
-    bool SimpleCLI::listPlayingMovies(std::string_view)
+    template<typename Renderer>
+    void SimpleCLI::respondCached(ResponseCache::Listing listing, std::string_view params, Renderer&& render)
     {
-        const std::vector<Booking::Movie*> allMovies = service.getPlayingMovies();
-        for (const auto& movie: allMovies)
+        // Read before the rendering: the catalog changes made meanwhile make the response outdated at once
+        const uint64_t version = service.getCatalogVersion();
+        ResponseCache::Response response = responses->find(listing, params, version);
+        if (!response) {
+            std::ostringstream rendered;
+            render(rendered);
+            response = responses->store(listing, params, version, std::move(rendered).str());
+        }
+        outStream.write(response->data(), static_cast<std::streamsize>(response->size()));
+    }
+
+    bool SimpleCLI::searchMovies(std::string_view query)
+    {
+        if (query.empty()) {
+            outStream << "Search query expected\n";
+            return true;
+        }
+
+        const std::vector<Movie*> found = service.searchMovies(query, searchResultsMax);
+        outStream << "Movies matching '" << query << "':\n";
+        for (const auto& movie: found)
             outStream << '\t' << movie->name << std::endl;
 
         return true;
     }
 
+    bool SimpleCLI::searchTheaters(std::string_view query)
+    {
+        if (query.empty()) {
+            outStream << "Search query expected\n";
+            return true;
+        }
+
+        const std::vector<Theater*> found = service.searchTheaters(query, searchResultsMax);
+        outStream << "Theaters matching '" << query << "':\n";
+        for (const auto& theater: found)
+            outStream << '\t' << theater->name << std::endl;
+
+        return true;
+    }
+
+    bool SimpleCLI::nearestTheaters(std::string_view input)
+    {
+        const auto parse = [](std::string_view text, auto& value) {
+            const auto [ptr, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+            return error == std::errc{} && ptr == text.data() + text.size();
+        };
+
+        const auto [location, rest] = extractCommand(input);
+        const auto [seats, movieName] = extractCommand(rest);
+        const size_t commaIdx = location.find(',');
+        GeoPoint point;
+        size_t seatsTogether = 0;
+        if (std::string_view::npos == commaIdx || !parse(location.substr(0, commaIdx), point.latitude) ||
+            !parse(location.substr(commaIdx + 1), point.longitude) || !parse(seats, seatsTogether) ||
+            0 == seatsTogether || movieName.empty())
+        {
+            outStream << "Expected: <latitude>,<longitude> <seats> <movie name>\n";
+            return true;
+        }
+
+        const std::optional<Movie*> movie = service.findMovie(std::string { movieName });
+        if (!movie) {
+            outStream << "No such movie\n";
+            return true;
+        }
+
+        const std::vector<NearbyPremiere> nearby =
+                service.findNearestPremieres(movie.value(), point, seatsTogether, searchResultsMax);
+        if (nearby.empty()) {
+            outStream << "No theaters with " << seatsTogether << " seats together found\n";
+            return true;
+        }
+        for (const NearbyPremiere& premiere: nearby) {
+            const auto tenths = static_cast<size_t>(premiere.distanceKm * 10 + 0.5);
+            outStream << '\t' << premiere.theater->name << ": " << tenths / 10 << "." << tenths % 10 << " km, seats "
+                      << premiere.firstSeat << "-" << premiere.firstSeat + seatsTogether - 1 << '\n';
+        }
+        return true;
+    }
+
+    bool SimpleCLI::occupancyReport(std::string_view groupBy)
+    {
+        const bool byMovie = "movie"sv == groupBy;
+        if (!byMovie && !groupBy.empty() && "theater"sv != groupBy) {
+            outStream << "Incorrect grouping: '" << groupBy << "'. Expected: theater or movie\n";
+            return true;
+        }
+
+        const OccupancySnapshot snapshot = analytics.capture();
+        std::vector<std::pair<std::string_view, OccupancyRow>> rows;
+        for (const OccupancyRow& row: OccupancyAnalytics::aggregate(snapshot, byMovie ?
+                OccupancyAnalytics::GroupBy::Movie : OccupancyAnalytics::GroupBy::Theater))
+        {
+            std::string_view name { "<unknown>" };
+            if (const std::optional<Movie*> movie = service.movies.findEntryByID(row.id); byMovie && movie)
+                name = movie.value()->name;
+            else if (const std::optional<Theater*> theater = service.theaters.findEntryByID(row.id); !byMovie && theater)
+                name = theater.value()->name;
+            rows.emplace_back(name, row);
+        }
+
+        // The most occupied first
+        std::sort(rows.begin(), rows.end(), [](const auto& left, const auto& right) {
+            return left.second.ratio() > right.second.ratio() ||
+                   (left.second.ratio() == right.second.ratio() && left.first < right.first);
+        });
+
+        outStream << "Occupancy by " << (byMovie ? "movie" : "theater") << ":\n";
+        for (const auto& [name, row]: rows)
+            outStream << '\t' << name << ": " << row << '\n';
+
+        const auto& timeline = analytics.timeline();
+        const OccupancyRow& total = timeline.back().total;
+        outStream << "Total: " << total;
+        if (timeline.size() > 1) {
+            const auto change = static_cast<std::ptrdiff_t>(total.seatsBooked) -
+                                static_cast<std::ptrdiff_t>(timeline[timeline.size() - 2].total.seatsBooked);
+            outStream << ", " << (change >= 0 ? "+" : "") << change << " seats since the previous report";
+        }
+        outStream << std::endl;
+        return true;
+    }
+
+    bool SimpleCLI::seatsChanges(std::string_view version)
+    {
+        uint64_t sinceVersion = 0;
+        if (!version.empty()) {
+            const auto [ptr, error] = std::from_chars(version.data(), version.data() + version.size(), sinceVersion);
+            if (error != std::errc{} || ptr != version.data() + version.size()) {
+                outStream << "Incorrect version: '" << version << "'\n";
+                return true;
+            }
+        }
+        if (!movieSelected || !theaterSelected) {
+            outStream << "No theater or Movie selected\n";
+            return true;
+        }
+
+        // The selection may be removed after the revalidation: getPremiere() finds nothing for nullptr then
+        const std::optional<BookingService::PremierePtr> premiere =
+                service.getPremiere(getTheaterSelected(), getMovieSelected());
+        if (!premiere) {
+            outStream << "No such premiere\n";
+            return true;
+        }
+
+        const SeatsUpdate update = premiere.value()->getSeatsChanges(sinceVersion);
+        outStream << "Seats map version: " << update.version << (update.full ? " (full)" : "") << "\n";
+        if (0 == update.seatsDelta) {
+            outStream << "No changes\n";
+            return true;
+        }
+        outStream << "Booked: ";
+        printSeats(outStream, update.seatsDelta & update.seatsBooked);
+        if (const uint32_t released = update.seatsDelta & ~update.seatsBooked; 0 != released) {
+            outStream << "\nReleased: ";
+            printSeats(outStream, released);
+        }
+        outStream << std::endl;
+        return true;
+    }
+
+    bool SimpleCLI::traceSampling(std::string_view every)
+    {
+        uint32_t sampling = 0;
+        if (every.empty()) {
+            sampling = Tracing::Tracer::getSampling();
+        } else {
+            const auto [ptr, error] = std::from_chars(every.data(), every.data() + every.size(), sampling);
+            if (error != std::errc{} || ptr != every.data() + every.size()) {
+                outStream << "Incorrect sampling: '" << every << "'\n";
+                return true;
+            }
+            Tracing::Tracer::setSampling(sampling);
+        }
+
+        if (0 == sampling)
+            outStream << "Tracing is disabled\n";
+        else
+            outStream << "Tracing every " << sampling << " request(s)\n";
+        return true;
+    }
+
+    bool SimpleCLI::traceDump(std::string_view fileName)
+    {
+        if (fileName.empty()) {
+            outStream << "File name expected\n";
+            return true;
+        }
+        // The plain file name only: the session input shall not reach outside the trace directory
+        if (std::string_view::npos != fileName.find_first_of("/\\") || "."sv == fileName || ".."sv == fileName) {
+            outStream << "Incorrect file name: '" << fileName << "'\n";
+            return true;
+        }
+
+        const std::filesystem::path path = traceDirectory / fileName;
+        std::ofstream file { path };
+        if (!file) {
+            outStream << "Failed to open '" << path.string() << "'\n";
+            return true;
+        }
+        const size_t written = Tracing::Tracer::instance().writeChromeTrace(file);
+        outStream << written << " trace events written to " << path.string() << '\n';
+        return true;
+    }
+
+    bool SimpleCLI::trending(std::string_view input)
+    {
+        const auto [kind, limit] = extractCommand(input);
+        const bool byTheater = "theaters"sv == kind;
+        if (!byTheater && !kind.empty() && "movies"sv != kind) {
+            outStream << "Incorrect kind: '" << kind << "'. Expected: movies or theaters\n";
+            return true;
+        }
+
+        size_t count = 10;
+        if (!limit.empty()) {
+            const auto [ptr, error] = std::from_chars(limit.data(), limit.data() + limit.size(), count);
+            if (error != std::errc{} || ptr != limit.data() + limit.size() || 0 == count) {
+                outStream << "Incorrect number: '" << limit << "'\n";
+                return true;
+            }
+        }
+
+        const auto minutes = std::chrono::duration_cast<std::chrono::minutes>(service.trending.getConfig().window);
+        const std::vector<TrendingEntry> entries = service.trending.top(
+                byTheater ? TrendingTracker::Kind::Theater : TrendingTracker::Kind::Movie, count);
+        if (entries.empty()) {
+            outStream << "No bookings in the last " << minutes.count() << " minutes\n";
+            return true;
+        }
+
+        outStream << "Trending " << (byTheater ? "theaters" : "movies")
+                  << " (last " << minutes.count() << " minutes):\n";
+        for (const TrendingEntry& entry: entries)
+        {
+            std::string_view name { "<removed>" };
+            if (const std::optional<Movie*> movie = service.movies.findEntryByID(entry.id); !byTheater && movie)
+                name = movie.value()->name;
+            else if (const std::optional<Theater*> theater = service.theaters.findEntryByID(entry.id);
+                     byTheater && theater)
+                name = theater.value()->name;
+            outStream << '\t' << name << ": " << entry.bookings << " booking(s)\n";
+        }
+        return true;
+    }
+
+    std::optional<MovieFilter> SimpleCLI::parseMovieFilter(std::string_view filters, std::ostream& out)
+    {
+        MovieFilter filter;
+        for (const std::string_view token: split(filters))
+        {
+            const size_t equalIdx = token.find('=');
+            const std::string_view key = token.substr(0, equalIdx);
+            const std::string_view value = std::string_view::npos == equalIdx ? ""sv : token.substr(equalIdx + 1);
+
+            bool valid = !value.empty();
+            if ("genre"sv == key) {
+                filter.genre = parseGenre(value);
+                valid = valid && filter.genre;
+            } else if ("rating"sv == key) {
+                filter.rating = parseRating(value);
+                valid = valid && filter.rating;
+            } else if ("format"sv == key) {
+                filter.format = parseFormat(value);
+                valid = valid && filter.format;
+            } else if ("language"sv == key) {
+                filter.language = std::string { value };
+            } else if ("duration"sv == key) {
+                uint16_t minutes = 0;
+                const auto [ptr, error] = std::from_chars(value.data(), value.data() + value.size(), minutes);
+                valid = valid && error == std::errc{} && ptr == value.data() + value.size();
+                filter.durationMax = minutes;
+            } else {
+                valid = false;
+            }
+
+            if (!valid) {
+                out << "Incorrect filter: '" << token << "'. Expected: genre=, rating=, language=, format= "
+                    << "or duration=<minutes max>\n";
+                return std::nullopt;
+            }
+        }
+        return filter;
+    }
+
     std::vector<std::string_view> SimpleCLI::split(std::string_view input,
                                                    std::string_view delim)
     {
         std::vector<std::string_view> output;
-        for (size_t first = 0, size = input.size(), second = 0; first < size; ) {
-            second = input.find(delim, first);
-            if (first != second)
-                output.emplace_back(input.substr(first, second - first));
-            if (second == std::string_view::npos)
-                break;
-            first = second + 1;
-        }
-        return output;
+        return splitInto(output, input, delim);
+    }
+
+    std::pmr::vector<std::string_view> SimpleCLI::split(std::string_view input,
+                                                        std::string_view delim,
+                                                        std::pmr::memory_resource* resource)
+    {
+        std::pmr::vector<std::string_view> output { resource };
+        return splitInto(output, input, delim);
     }
 
     std::pair<std::string_view, std::string_view> SimpleCLI::extractCommand(std::string_view input)
@@ -220,12 +577,28 @@ namespace CLI
 
     SimpleCLI::Status SimpleCLI::processCommand(std::string_view userInput)
     {
+        const Tracing::Span span { "SimpleCLI::processCommand" };
         const auto& [cmd, params] = extractCommand(userInput);
         const Status status = validateCommand(cmd);
         if (Status::Continue == status || Status::Stop == status)
             return status;
 
-        if (const auto funcIter = funcMapping.find(cmd); funcMapping.end() != funcIter) {
+        if (const auto funcIter = funcMapping.find(cmd); funcMapping.end() != funcIter)
+        {
+            // The permit is held until the command completes
+            const std::optional<Admission::Permit> permit = admission ?
+                    std::make_optional(admission->admit(clientId, lane)) : std::nullopt;
+            if (permit && Admission::Verdict::RateLimited == permit->getVerdict()) {
+                outStream << "Too many requests: please retry later\n";
+                return Status::Continue;
+            } else if (permit && Admission::Verdict::Shed == permit->getVerdict()) {
+                outStream << "The service is busy: please retry later\n";
+                return Status::Continue;
+            }
+
+            // The entries found by the command stay valid till its end, even if removed meanwhile
+            const Concurrency::EpochDomain::Guard guard;
+            revalidateSelection();
             if (calFunction(funcIter->second, params))
                 return Status::Continue;
         }
@@ -234,6 +607,49 @@ namespace CLI
         return Status::Continue;
     }
 
+    void SimpleCLI::revalidateSelection()
+    {
+        if (theaterSelected && !service.theaters.findEntryByID(theaterSelected.value())) {
+            theaterSelected.reset();
+            outStream << "The selected theater is no longer available\n";
+        }
+        if (movieSelected && !service.movies.findEntryByID(movieSelected.value())) {
+            movieSelected.reset();
+            outStream << "The selected movie is no longer available\n";
+        }
+    }
+
+    Theater* SimpleCLI::getTheaterSelected() const noexcept
+    {
+        if (!theaterSelected)
+            return nullptr;
+        return service.theaters.findEntryByID(theaterSelected.value()).value_or(nullptr);
+    }
+
+    Movie* SimpleCLI::getMovieSelected() const noexcept
+    {
+        if (!movieSelected)
+            return nullptr;
+        return service.movies.findEntryByID(movieSelected.value()).value_or(nullptr);
+    }
+
+    void SimpleCLI::setAdmission(Admission::AdmissionController& controller,
+                                 uint64_t client,
+                                 Admission::Lane clientLane) noexcept
+    {
+        admission = &controller;
+        clientId = client;
+        lane = clientLane;
+    }
+
+    void SimpleCLI::setResponseCache(ResponseCache& cache) noexcept {
+        responses = &cache;
+    }
+
+    void SimpleCLI::setTraceDirectory(std::filesystem::path directory) {
+        traceDirectory = std::move(directory);
+    }
+
     void SimpleCLI::start()
     {
         Status status = Status::Ok;
@@ -11,7 +11,13 @@
 #define BOOKINGSERVICE_CLI_H
 
 #include "BookingService.h"
+#include "Memory.h"
+#include "OccupancyAnalytics.h"
+#include "Admission.h"
+#include "ResponseCache.h"
+#include "Tracing.h"
 #include <iostream>
+#include <filesystem>
 #include <functional>
 #include <unordered_map>
 
@@ -57,6 +63,28 @@ namespace CLI
         */
         void start();
 
+        /**
+         * Puts the session commands under the admission control: each command is executed only if admitted
+         * @param controller the admission controller shared by all the sessions
+         * @param clientId the identifier of the client of this session
+         * @param lane Admission::Lane::Priority for the confirmed customers
+        */
+        void setAdmission(Admission::AdmissionController& controller,
+                          uint64_t clientId,
+                          Admission::Lane lane = Admission::Lane::Regular) noexcept;
+
+        /**
+         * Serves the catalog listings of the session from the cache shared with other sessions
+         * @param cache the cache of the rendered listings (by default, the session has its own one)
+        */
+        void setResponseCache(ResponseCache& cache) noexcept;
+
+        /**
+         * Sets the directory the <b>trace_dump</b> command writes the trace files to
+         * @param directory the trace directory (by default, the current working directory)
+        */
+        void setTraceDirectory(std::filesystem::path directory);
+
     private:
 
         using CmdHandlerType = SimpleCLI;
@@ -84,10 +112,11 @@ namespace CLI
 
         /**
           * Method to process the <b>list_playing_movies</b> command.
-          * @param None no input parameters required
+          * @param filters user input - optional <i>key=value</i> filters (genre, rating, language, format and
+          * duration - the maximum minutes), e.g. <i>genre=scifi format=imax language=en</i>
          */
         [[nodiscard]]
-        bool listPlayingMovies(std::string_view);
+        bool listPlayingMovies(std::string_view filters);
 
         /**
           * Method to process the <b>select_theater</b> command.
@@ -133,23 +162,133 @@ namespace CLI
 
         /**
           * Method to process the <b>list_movies</b> command.
-          * @param None no input parameters required
+          * @param filters user input - optional <i>key=value</i> filters, the same as of the <b>list_playing_movies</b>
          */
         [[nodiscard]]
-        bool listAllMovies(std::string_view);
+        bool listAllMovies(std::string_view filters);
+
+        /**
+          * Method to process the <b>search_movies</b> command.
+          * @param query user input - the beginning of the Movie name or the name with typos
+         */
+        [[nodiscard]]
+        bool searchMovies(std::string_view query);
+
+        /**
+          * Method to process the <b>search_theaters</b> command.
+          * @param query user input - the beginning of the Theater name or the name with typos
+         */
+        [[nodiscard]]
+        bool searchTheaters(std::string_view query);
+
+        /**
+          * Method to process the <b>nearest_theaters</b> command.
+          * @param input user input - the location, the number of the seats in a row and the Movie name,
+          * e.g. <i>52.5,13.4 4 Terminator</i>
+          * @note Prints the nearest theaters showing the Movie with the seats available in a row
+         */
+        [[nodiscard]]
+        bool nearestTheaters(std::string_view input);
+
+        /**
+          * Method to process the <b>occupancy_report</b> command.
+          * @param groupBy user input - <i>theater</i> (default) or <i>movie</i>
+          * @note Prints the occupancy of the each theater (or movie), the total occupancy and its change since
+          * the previous report
+         */
+        [[nodiscard]]
+        bool occupancyReport(std::string_view groupBy);
+
+        /**
+          * Method to process the <b>seats_changes</b> command.
+          * @param version user input - the seat map version the client has (zero or none - the full seat map)
+          * @note Prints only the seats of the selected premiere booked or released since that version, and
+          * the current version to be passed next time
+         */
+        [[nodiscard]]
+        bool seatsChanges(std::string_view version);
+
+        /**
+          * Method to process the <b>trace_sampling</b> command.
+          * @param every user input - trace every N-th request of each thread (0 - disable the tracing)
+          * @note Prints the current sampling, if no input given
+         */
+        [[nodiscard]]
+        bool traceSampling(std::string_view every);
+
+        /**
+          * Method to process the <b>trace_dump</b> command.
+          * @param fileName user input - the file of the trace directory to write the spans recorded to
+          *        (Chrome trace event JSON). The paths are rejected: the session can not write outside the directory
+         */
+        [[nodiscard]]
+        bool traceDump(std::string_view fileName);
+
+        /**
+          * Method to process the <b>trending</b> command.
+          * @param input user input - <i>movies</i> (default) or <i>theaters</i> and the list size (10 by default),
+          * e.g. <i>theaters 5</i>
+          * @note Prints the top movies or theaters by the bookings of the last minutes (see Booking::TrendingTracker)
+         */
+        [[nodiscard]]
+        bool trending(std::string_view input);
 
         [[nodiscard]]
         static std::vector<std::string_view> split(std::string_view input,
                                                    std::string_view delim = " "sv);
 
+        [[nodiscard]]
+        static std::pmr::vector<std::string_view> split(std::string_view input,
+                                                        std::string_view delim,
+                                                        std::pmr::memory_resource* resource);
+
         [[nodiscard]]
         static std::pair<std::string_view, std::string_view> extractCommand(std::string_view input);
 
         [[nodiscard]]
         Status validateCommand(std::string_view command) const;
 
+        /**
+         * Parses the movies listing filters: <i>key=value</i> separated by spaces
+         * @param out the stream the error is printed to
+         * @return std::nullopt (the error is printed) if any filter is incorrect
+         */
+        [[nodiscard]]
+        static std::optional<Booking::MovieFilter> parseMovieFilter(std::string_view filters, std::ostream& out);
+
+        /**
+         * Writes the response of the catalog listing: rendered only if the catalog has changed since the last time
+         * @param render callable <b>void(std::ostream&)</b> printing the listing
+         */
+        template<typename Renderer>
+        void respondCached(ResponseCache::Listing listing, std::string_view params, Renderer&& render);
+
+        /**
+         * Drops the selected Theater and Movie, if they have been removed since the selection
+         * @note Shall be called inside of the EpochDomain::Guard: the selected entries stay valid till its end
+         */
+        void revalidateSelection();
+
+        /**
+         * Returns the selected Theater (nullptr if none)
+         */
+        [[nodiscard]]
+        Booking::Theater* getTheaterSelected() const noexcept;
+
+        /**
+         * Returns the selected Movie (nullptr if none)
+         */
+        [[nodiscard]]
+        Booking::Movie* getMovieSelected() const noexcept;
+
     private:
 
+        /** Maximum number of the results the search commands display **/
+        static constexpr size_t searchResultsMax { 10 };
+
+        /** Size of the per-command arena (on the stack) for the parsed input and the query results **/
+        static constexpr size_t requestArenaSize { 1024 };
+
         static inline const std::unordered_map<std::string_view, methodPtr_t> funcMapping
         {
             {"book_seats"sv, &CmdHandlerType::book_seats},
@@ -160,13 +299,36 @@ namespace CLI
             {"list_available_seats"sv, &CmdHandlerType::listAvailableSeats},
             {"list_theaters"sv, &CmdHandlerType::listAllTheaters},
             {"list_movies"sv, &CmdHandlerType::listAllMovies},
+            {"search_movies"sv, &CmdHandlerType::searchMovies},
+            {"search_theaters"sv, &CmdHandlerType::searchTheaters},
+            {"nearest_theaters"sv, &CmdHandlerType::nearestTheaters},
+            {"occupancy_report"sv, &CmdHandlerType::occupancyReport},
+            {"seats_changes"sv, &CmdHandlerType::seatsChanges},
+            {"trace_sampling"sv, &CmdHandlerType::traceSampling},
+            {"trace_dump"sv, &CmdHandlerType::traceDump},
+            {"trending"sv, &CmdHandlerType::trending},
        };
 
         Booking::BookingService& service;
         std::basic_ostream<char>& outStream;
 
-        std::optional<Booking::Theater*> theaterSelected { std::nullopt };
-        std::optional<Booking::Movie*> movieSelected { std::nullopt };
+        Booking::OccupancyAnalytics analytics { service };
+
+        /** The listings rendered by this session: used unless the shared cache is set **/
+        ResponseCache ownResponses;
+        ResponseCache* responses { &ownResponses };
+
+        /** The selection is kept by the IDs (never reused): the entries may be removed between the commands **/
+        std::optional<size_t> theaterSelected { std::nullopt };
+        std::optional<size_t> movieSelected { std::nullopt };
+
+        /** No admission control, if not set **/
+        Admission::AdmissionController* admission { nullptr };
+        uint64_t clientId { 0 };
+        Admission::Lane lane { Admission::Lane::Regular };
+
+        /** The only directory the session input may write to (see traceDump()) **/
+        std::filesystem::path traceDirectory { "." };
     };
 };
 
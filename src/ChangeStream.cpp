@@ -0,0 +1,144 @@
+/**
+ * @file       ChangeStream.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Change-data-capture stream of the seats state changes
+ */
+
+#include "ChangeStream.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <thread>
+#include <utility>
+
+namespace
+{
+    constexpr uint64_t writingStamp(uint64_t sequence) noexcept {
+        return 2 * sequence + 1;
+    }
+
+    constexpr uint64_t publishedStamp(uint64_t sequence) noexcept {
+        return 2 * sequence + 2;
+    }
+}
+
+namespace Booking
+{
+    ChangeStream::ChangeStream(size_t capacity, BackPressure backPressure):
+            mask { std::bit_ceil(std::max<size_t>(capacity, 2)) - 1 },
+            backPressure { backPressure },
+            cells { std::make_unique<Cell[]>(mask + 1) } {
+    }
+
+    void ChangeStream::publish(uint32_t premiereId, uint32_t seatsDelta) noexcept
+    {
+        const uint64_t seq = tail.fetch_add(1, std::memory_order_relaxed);
+        if (BackPressure::Block == backPressure)
+            waitForConsumers(seq);
+
+        // The cell is free once the event of the previous lap is completely written
+        Cell& cell = cells[seq & mask];
+        const uint64_t previous = seq > mask ? publishedStamp(seq - mask - 1) : 0;
+        while (cell.stamp.load(std::memory_order_acquire) != previous)
+            std::this_thread::yield();
+
+        cell.stamp.store(writingStamp(seq), std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        cell.payload.store(static_cast<uint64_t>(premiereId) << 32 | seatsDelta, std::memory_order_relaxed);
+        cell.stamp.store(publishedStamp(seq), std::memory_order_release);
+    }
+
+    void ChangeStream::waitForConsumers(uint64_t sequence) noexcept
+    {
+        if (sequence <= gatingCursor.load(std::memory_order_acquire) + mask)
+            return;
+        for (;;)
+        {
+            const uint64_t slowest = slowestConsumer(sequence);
+            gatingCursor.store(slowest, std::memory_order_release);
+            if (sequence <= slowest + mask)
+                return;
+            std::this_thread::yield();
+        }
+    }
+
+    uint64_t ChangeStream::slowestConsumer(uint64_t sequence) const noexcept
+    {
+        uint64_t slowest = std::numeric_limits<uint64_t>::max();
+        for (const ConsumerSlot& slot: consumers)
+            if (slot.active.load(std::memory_order_acquire))
+                slowest = std::min(slowest, slot.cursor.load(std::memory_order_acquire));
+        return std::numeric_limits<uint64_t>::max() == slowest ? sequence : slowest;
+    }
+
+    std::optional<ChangeStream::Consumer> ChangeStream::subscribe()
+    {
+        std::lock_guard<std::mutex> lock { mtxConsumers };
+        for (ConsumerSlot& slot: consumers)
+        {
+            if (slot.active.load(std::memory_order_relaxed))
+                continue;
+            slot.cursor.store(tail.load(std::memory_order_acquire), std::memory_order_relaxed);
+            slot.active.store(true, std::memory_order_release);
+            return Consumer { this, &slot };
+        }
+        return std::nullopt;
+    }
+
+    ChangeStream::Consumer::Consumer(Consumer&& other) noexcept:
+            stream { std::exchange(other.stream, nullptr) }, slot { std::exchange(other.slot, nullptr) } {
+    }
+
+    ChangeStream::Consumer& ChangeStream::Consumer::operator=(Consumer&& other) noexcept
+    {
+        // The previous slot (if any) is released by the destructor of the other
+        std::swap(stream, other.stream);
+        std::swap(slot, other.slot);
+        return *this;
+    }
+
+    ChangeStream::Consumer::~Consumer()
+    {
+        if (nullptr != slot) {
+            std::lock_guard<std::mutex> lock { stream->mtxConsumers };
+            slot->active.store(false, std::memory_order_release);
+        }
+    }
+
+    ChangeStream::PollResult ChangeStream::Consumer::poll(std::span<SeatChange> events) noexcept
+    {
+        PollResult result;
+        uint64_t next = slot->cursor.load(std::memory_order_relaxed);
+        while (result.count < events.size())
+        {
+            const Cell& cell = stream->cells[next & stream->mask];
+            const uint64_t stamp = cell.stamp.load(std::memory_order_acquire);
+            if (stamp < publishedStamp(next))
+                break;  // Not published yet
+
+            if (stamp == publishedStamp(next))
+            {
+                const uint64_t payload = cell.payload.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (cell.stamp.load(std::memory_order_relaxed) == stamp) {
+                    events[result.count++] = SeatChange { next, static_cast<uint32_t>(payload >> 32),
+                                                          static_cast<uint32_t>(payload) };
+                    ++next;
+                    continue;
+                }
+            }
+
+            // Overwritten by the producers of the later lap: skip to the stream tail
+            const uint64_t resume = stream->tail.load(std::memory_order_acquire);
+            result.lost = resume - next;
+            next = resume;
+            break;
+        }
+        slot->cursor.store(next, std::memory_order_release);
+        return result;
+    }
+}
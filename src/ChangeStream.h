@@ -0,0 +1,187 @@
+/**
+ * @file       ChangeStream.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Change-data-capture stream of the seats state changes
+ */
+
+#ifndef BOOKINGSERVICE_CHANGESTREAM_H
+#define BOOKINGSERVICE_CHANGESTREAM_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+
+#include "Concurrency.h"
+
+namespace Booking
+{
+    /**
+     * @brief A single seats state change of the premiere
+     */
+    struct SeatChange
+    {
+        /** Position of the change in the stream: consecutive for the consecutive changes **/
+        uint64_t sequence { 0 };
+
+        /** The premiere index in the BookingService::bookingSchedule (see Premiere::id) **/
+        uint32_t premiereId { 0 };
+
+        /** The seats changed their state (bit N - 1 is set, if the seat N was booked or released) **/
+        uint32_t seatsDelta { 0 };
+    };
+
+    /**
+     * @brief Change-data-capture stream: the lock-free multi-producer ring of the SeatChange events, read by
+     * any number of the independent consumers (each consumer sees all the events in the sequence order).<br>
+     * Publishing is a single fetch_add on the ring tail plus two stores into the claimed cell: the producers never
+     * wait for each other, unless the whole ring wraps around during a single publish(). Each cell is stamped with
+     * the sequence of the event it holds, so the consumers detect both the unpublished cells and the overwritten ones
+     * (seqlock-style) without any locking
+     */
+    class ChangeStream
+    {
+    public:
+
+        /** What publish() does when the slowest consumer is the whole ring behind **/
+        enum class BackPressure
+        {
+            /** Never wait: overwrite the oldest events, the lagging consumers are told how many they have lost **/
+            Overwrite,
+            /** Wait for the slowest consumer: no events are lost, but the producers are slowed down to its pace **/
+            Block
+        };
+
+        /** Maximum number of the consumers subscribed simultaneously **/
+        static constexpr size_t consumersMax { 16 };
+
+        /** The result of the Consumer::poll() **/
+        struct PollResult
+        {
+            /** Number of the events written to the output **/
+            size_t count { 0 };
+
+            /** Number of the events overwritten before the consumer have read them (BackPressure::Overwrite only).
+             *  The consumer shall resynchronize its state (e.g. from the Premiere::seatsBooked bitmaps) **/
+            uint64_t lost { 0 };
+        };
+
+    private:
+
+        struct Cell
+        {
+            /** 2 * S + 1 while the event S is being written, 2 * S + 2 once it is published **/
+            std::atomic<uint64_t> stamp { 0 };
+            /** premiereId in the high half, seatsDelta in the low half **/
+            std::atomic<uint64_t> payload { 0 };
+        };
+
+        struct alignas(Concurrency::cacheLineSize) ConsumerSlot
+        {
+            /** Sequence of the next event to be read **/
+            std::atomic<uint64_t> cursor { 0 };
+            std::atomic<bool> active { false };
+        };
+
+    public:
+
+        /**
+         * @brief The independent reader of the stream: receives all the events published after its subscription
+         * @note A single consumer shall be polled by one thread at a time
+         */
+        class Consumer
+        {
+            friend class ChangeStream;
+
+            ChangeStream* stream { nullptr };
+            ConsumerSlot* slot { nullptr };
+
+            Consumer(ChangeStream* stream, ConsumerSlot* slot) noexcept: stream { stream }, slot { slot } {
+            }
+
+        public:
+
+            Consumer(Consumer&& other) noexcept;
+            Consumer& operator=(Consumer&& other) noexcept;
+            ~Consumer();
+
+            /**
+             * Reads the events available in the stream, without waiting
+             * @param events the output buffer: up to its size events are read
+             */
+            PollResult poll(std::span<SeatChange> events) noexcept;
+
+            /**
+             * Returns the sequence of the next event to be read
+             */
+            [[nodiscard]]
+            uint64_t position() const noexcept {
+                return slot->cursor.load(std::memory_order_relaxed);
+            }
+        };
+
+        /**
+         * Constructor
+         * @param capacity the number of the events kept in the ring (rounded up to the power of two)
+         * @param backPressure the policy applied when the slowest consumer falls the whole ring behind
+         */
+        explicit ChangeStream(size_t capacity = 65'536, BackPressure backPressure = BackPressure::Overwrite);
+
+        ChangeStream(const ChangeStream&) = delete;
+        ChangeStream& operator=(const ChangeStream&) = delete;
+
+        /**
+         * Appends the event to the stream. May be called from any number of threads simultaneously
+         * @note Never allocates memory
+         */
+        void publish(uint32_t premiereId, uint32_t seatsDelta) noexcept;
+
+        /**
+         * Subscribes the new consumer: it receives the events published from now on
+         * @return std::nullopt if there are consumersMax consumers already
+         */
+        [[nodiscard]]
+        std::optional<Consumer> subscribe();
+
+        /**
+         * Returns the number of events published (claimed by the producers) so far
+         */
+        [[nodiscard]]
+        uint64_t sequence() const noexcept {
+            return tail.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]]
+        size_t capacity() const noexcept {
+            return mask + 1;
+        }
+
+    private:
+
+        /** Waits until the event <b>sequence</b> fits into the ring ahead of all the consumers **/
+        void waitForConsumers(uint64_t sequence) noexcept;
+
+        /** Returns the minimal cursor of the active consumers or <b>sequence</b>, if there are none **/
+        [[nodiscard]]
+        uint64_t slowestConsumer(uint64_t sequence) const noexcept;
+
+        const uint64_t mask;
+        const BackPressure backPressure;
+        std::unique_ptr<Cell[]> cells;
+
+        alignas(Concurrency::cacheLineSize) std::atomic<uint64_t> tail { 0 };
+        /** The slowest consumer cursor seen by the producers last time (BackPressure::Block only) **/
+        alignas(Concurrency::cacheLineSize) std::atomic<uint64_t> gatingCursor { 0 };
+
+        std::mutex mtxConsumers;
+        std::array<ConsumerSlot, consumersMax> consumers {};
+    };
+}
+
+#endif //BOOKINGSERVICE_CHANGESTREAM_H
@@ -0,0 +1,161 @@
+/**
+ * @file       ChunkedVector.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Contiguous storage of the non-movable objects with the stable addresses
+ */
+
+#ifndef BOOKINGSERVICE_CHUNKEDVECTOR_H
+#define BOOKINGSERVICE_CHUNKEDVECTOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace DB
+{
+    /**
+     * @brief Sequence container storing the elements in the fixed-size chunks.<br>
+     * Elements are constructed in place and never relocated (so they may hold mutexes and atomics, and the
+     * references to them stay valid while the container lives). Unlike the vector of the std::shared_ptr's, the
+     * neighbouring elements are adjacent in memory: the scan does not chase pointers and there is no per-element
+     * allocation. The alignment of the element type is respected
+     * @tparam T the element type
+     * @tparam ChunkSize number of the elements per chunk (power of two)
+     * @note Like the DB::Table, additions shall not run concurrently with the access to the container
+     */
+    template<typename T, size_t ChunkSize = 64>
+    class ChunkedVector
+    {
+        static_assert(0 != ChunkSize && 0 == (ChunkSize & (ChunkSize - 1)), "ChunkSize shall be a power of two");
+
+        struct Chunk
+        {
+            alignas(T) std::byte storage[sizeof(T) * ChunkSize];
+
+            [[nodiscard]]
+            T* at(size_t idx) noexcept {
+                return std::launder(reinterpret_cast<T*>(storage) + idx);
+            }
+        };
+
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        size_t count { 0 };
+
+        template<bool Const>
+        class Iterator
+        {
+            using Container = std::conditional_t<Const, const ChunkedVector, ChunkedVector>;
+
+            Container* container { nullptr };
+            size_t idx { 0 };
+
+        public:
+
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<Const, const T*, T*>;
+            using reference = std::conditional_t<Const, const T&, T&>;
+
+            Iterator() = default;
+            Iterator(Container* container, size_t idx) noexcept: container { container }, idx { idx } {
+            }
+
+            reference operator*() const noexcept {
+                return (*container)[idx];
+            }
+
+            pointer operator->() const noexcept {
+                return &(*container)[idx];
+            }
+
+            Iterator& operator++() noexcept {
+                ++idx;
+                return *this;
+            }
+
+            Iterator operator++(int) noexcept {
+                return Iterator { container, idx++ };
+            }
+
+            bool operator==(const Iterator& other) const noexcept {
+                return idx == other.idx && container == other.container;
+            }
+        };
+
+    public:
+
+        using value_type = T;
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        ChunkedVector() = default;
+        ChunkedVector(const ChunkedVector&) = delete;
+        ChunkedVector& operator=(const ChunkedVector&) = delete;
+
+        ~ChunkedVector()
+        {
+            for (size_t idx = 0; idx < count; ++idx)
+                std::destroy_at(&(*this)[idx]);
+        }
+
+        /**
+         * Constructs the new element at the end of the container
+         * @return reference to the element: stays valid until the container destruction
+         */
+        template<typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (count == chunks.size() * ChunkSize)
+                chunks.push_back(std::make_unique_for_overwrite<Chunk>());
+            T* element = std::construct_at(chunks.back()->at(count % ChunkSize), std::forward<Args>(args)...);
+            ++count;
+            return *element;
+        }
+
+        [[nodiscard]]
+        T& operator[](size_t idx) noexcept {
+            return *chunks[idx / ChunkSize]->at(idx % ChunkSize);
+        }
+
+        [[nodiscard]]
+        const T& operator[](size_t idx) const noexcept {
+            return *chunks[idx / ChunkSize]->at(idx % ChunkSize);
+        }
+
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return count;
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return 0 == count;
+        }
+
+        iterator begin() noexcept {
+            return iterator { this, 0 };
+        }
+
+        iterator end() noexcept {
+            return iterator { this, count };
+        }
+
+        const_iterator begin() const noexcept {
+            return const_iterator { this, 0 };
+        }
+
+        const_iterator end() const noexcept {
+            return const_iterator { this, count };
+        }
+    };
+}
+
+#endif //BOOKINGSERVICE_CHUNKEDVECTOR_H
@@ -0,0 +1,79 @@
+/**
+ * @file       Concurrency.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Common definitions of the concurrency building blocks
+ */
+
+#ifndef BOOKINGSERVICE_CONCURRENCY_H
+#define BOOKINGSERVICE_CONCURRENCY_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+
+//! Lock-free and low-contention building blocks shared by the service modules
+namespace Concurrency
+{
+    /** Size of the cache line: used to keep the independently updated fields on separate lines **/
+    inline constexpr size_t cacheLineSize { 64 };
+
+    /**
+     * The shared mutex preferring the writers: the new readers wait while a writer is waiting for the lock.
+     * The glibc std::shared_mutex prefers the readers, so the readers looking up in a loop starve the writer
+     * @note Not recursive for the readers: the reader holding the lock shall not take it again
+     **/
+    class WriterPreferringMutex
+    {
+        std::shared_mutex mutex;
+
+        /** The writers waiting for the lock or holding it: the readers wait for it to drop to zero **/
+        std::atomic<uint32_t> writers { 0 };
+
+    public:
+
+        void lock()
+        {
+            writers.fetch_add(1, std::memory_order_acq_rel);
+            mutex.lock();
+        }
+
+        bool try_lock()
+        {
+            if (!mutex.try_lock())
+                return false;
+            writers.fetch_add(1, std::memory_order_acq_rel);
+            return true;
+        }
+
+        void unlock()
+        {
+            mutex.unlock();
+            if (1 == writers.fetch_sub(1, std::memory_order_acq_rel))
+                writers.notify_all();
+        }
+
+        void lock_shared()
+        {
+            for (uint32_t waiting = writers.load(std::memory_order_acquire); 0 != waiting;
+                 waiting = writers.load(std::memory_order_acquire))
+                writers.wait(waiting, std::memory_order_acquire);
+            mutex.lock_shared();
+        }
+
+        bool try_lock_shared()
+        {
+            return 0 == writers.load(std::memory_order_acquire) && mutex.try_lock_shared();
+        }
+
+        void unlock_shared()
+        {
+            mutex.unlock_shared();
+        }
+    };
+}
+
+#endif //BOOKINGSERVICE_CONCURRENCY_H
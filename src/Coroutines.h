@@ -0,0 +1,255 @@
+/**
+ * @file       Coroutines.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      C++20 coroutines support: Task type and the lightweight Executor
+ */
+
+#ifndef BOOKINGSERVICE_COROUTINES_H
+#define BOOKINGSERVICE_COROUTINES_H
+
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+//! C++20 coroutines building blocks for the asynchronous service API
+namespace Async
+{
+    /**
+     * @brief Lazily started coroutine producing a value of type T.<br>
+     * The coroutine starts when it is awaited (co_await task) and resumes the awaiting coroutine
+     * when completed (symmetric transfer, so long chains of the tasks do not grow the stack)
+     * @tparam T type of the result
+     */
+    template<typename T>
+    class [[nodiscard]] Task
+    {
+    public:
+
+        struct promise_type
+        {
+            std::optional<T> value {};
+            std::exception_ptr error {};
+            std::coroutine_handle<> continuation {};
+
+            Task get_return_object() noexcept {
+                return Task { std::coroutine_handle<promise_type>::from_promise(*this) };
+            }
+
+            std::suspend_always initial_suspend() const noexcept {
+                return {};
+            }
+
+            struct FinalAwaiter
+            {
+                [[nodiscard]]
+                bool await_ready() const noexcept {
+                    return false;
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> self) noexcept {
+                    if (const std::coroutine_handle<> next = self.promise().continuation; next)
+                        return next;
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept {
+                }
+            };
+
+            FinalAwaiter final_suspend() const noexcept {
+                return {};
+            }
+
+            template<typename Value>
+            void return_value(Value&& result) {
+                value.emplace(std::forward<Value>(result));
+            }
+
+            void unhandled_exception() noexcept {
+                error = std::current_exception();
+            }
+        };
+
+        Task(Task&& other) noexcept: handle { std::exchange(other.handle, nullptr) } {
+        }
+
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                destroy();
+                handle = std::exchange(other.handle, nullptr);
+            }
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task() {
+            destroy();
+        }
+
+        [[nodiscard]]
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+
+        T await_resume() {
+            if (handle.promise().error)
+                std::rethrow_exception(handle.promise().error);
+            return std::move(handle.promise().value.value());
+        }
+
+    private:
+
+        explicit Task(std::coroutine_handle<promise_type> handle) noexcept: handle { handle } {
+        }
+
+        void destroy() noexcept {
+            if (handle)
+                std::exchange(handle, nullptr).destroy();
+        }
+
+        std::coroutine_handle<promise_type> handle {};
+    };
+
+    /**
+     * @brief Single-threaded executor: the queue of the coroutines ready to be resumed.<br>
+     * The coroutines suspended on contention are put back to the end of the queue, so a single thread
+     * can keep any number of in-flight requests without blocking on any of them
+     * @note Not thread-safe: all the calls shall be made from the thread running the executor
+     */
+    class Executor
+    {
+        /**
+         * @brief Fire-and-forget coroutine: the root of the spawned task chain, destroys itself on completion
+         */
+        struct Detached
+        {
+            struct promise_type
+            {
+                Detached get_return_object() noexcept {
+                    return Detached { std::coroutine_handle<promise_type>::from_promise(*this) };
+                }
+
+                std::suspend_always initial_suspend() const noexcept {
+                    return {};
+                }
+
+                std::suspend_never final_suspend() const noexcept {
+                    return {};
+                }
+
+                void return_void() const noexcept {
+                }
+
+                void unhandled_exception() const noexcept {
+                    std::terminate();
+                }
+            };
+
+            std::coroutine_handle<promise_type> handle;
+        };
+
+        struct YieldAwaiter
+        {
+            Executor& executor;
+
+            [[nodiscard]]
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) const {
+                executor.schedule(handle);
+            }
+
+            void await_resume() const noexcept {
+            }
+        };
+
+        template<typename T, typename Fn>
+        static Detached makeDetached(Task<T> task, Fn onComplete) {
+            onComplete(co_await task);
+        }
+
+        std::deque<std::coroutine_handle<>> ready;
+
+    public:
+
+        /**
+         * Puts the coroutine into the queue of the coroutines ready to be resumed
+         */
+        void schedule(std::coroutine_handle<> handle) {
+            ready.push_back(handle);
+        }
+
+        /**
+         * Returns an awaitable which suspends the current coroutine and lets the others to run
+         * @note co_await executor.yield()
+         */
+        [[nodiscard]]
+        YieldAwaiter yield() noexcept {
+            return YieldAwaiter { *this };
+        }
+
+        /**
+         * Starts the task (on the next run() call) without waiting for its result
+         * @param task the task to be executed
+         * @param onComplete callable <b>void(T)</b> invoked with the task result
+         */
+        template<typename T, typename Fn>
+        void spawn(Task<T> task, Fn&& onComplete) {
+            schedule(makeDetached<T, std::decay_t<Fn>>(std::move(task), std::forward<Fn>(onComplete)).handle);
+        }
+
+        /**
+         * Resumes the ready coroutines until there is nothing left to do
+         * @return the number of the resumptions performed
+         */
+        size_t run()
+        {
+            size_t resumed = 0;
+            while (!ready.empty()) {
+                const std::coroutine_handle<> handle = ready.front();
+                ready.pop_front();
+                handle.resume();
+                ++resumed;
+            }
+            return resumed;
+        }
+
+        /**
+         * Resumes only the coroutines which are ready at the moment of the call (a single round).<br>
+         * The coroutines rescheduled during the round are left for the next one
+         * @return the number of the resumptions performed
+         */
+        size_t poll()
+        {
+            const size_t roundSize = ready.size();
+            for (size_t resumed = 0; resumed < roundSize; ++resumed) {
+                const std::coroutine_handle<> handle = ready.front();
+                ready.pop_front();
+                handle.resume();
+            }
+            return roundSize;
+        }
+
+        [[nodiscard]]
+        size_t pending() const noexcept {
+            return ready.size();
+        }
+    };
+}
+
+#endif //BOOKINGSERVICE_COROUTINES_H
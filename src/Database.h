@@ -13,9 +13,15 @@
 #include <iostream>
 #include <memory>
 #include <vector>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <optional>
 #include <concepts>
+#include <memory_resource>
+
+#include "IdAllocator.h"
+#include "Memory.h"
 
 //! Contains the definition and implementation of the basic building blocks of database behavior emulation
 namespace DB
@@ -45,20 +51,19 @@ namespace DB
     template<typename T>
     struct TableEntry: NonCopyable
     {
+        /** The IDs sequence of the entries of this type: see IdAllocator::resumeFrom() and IdAllocator::reset() **/
+        using Ids = IdAllocator<T>;
+
         std::string name;
         size_t id { 0 };
 
         explicit TableEntry(std::string name) : name{std::move(name)} {
-            // First entry shall have ID = 1 not zero
-            id = ++uniqueEntryId;
+            // First entry shall have ID = 1 not zero. Entries may be created concurrently
+            id = Ids::allocate();
         }
 
         template<typename Type>
         friend bool operator==(const TableEntry<Type> &, const TableEntry<Type> &);
-
-    private:
-
-        static inline size_t uniqueEntryId {0};
     };
 
     template<typename T>
@@ -72,7 +77,12 @@ namespace DB
 
     /**
      * @brief The DataBase Table emulation class<br>
-     * Under the hood, it is implemented in the form of two Hash Tables for searching by ID and name of the corresponding entity
+     * Under the hood, it is implemented in the form of two Hash Tables for searching by ID and name of the corresponding entity<br>
+     * The entries are long-lived and of the same size, so they (together with their control blocks) are allocated
+     * from the memory pool of the table instead of the global heap<br>
+     * The hash tables are guarded by the shared lock: the lookups run concurrently with each other and with the
+     * entries additions and removals. The lock protects the tables only, the entries removed are kept alive for the
+     * readers by the caller (see removeEntry())
      * @tparam T type of the Entry stored in Table
      */
     template<TableEntryType T>
@@ -84,6 +94,12 @@ namespace DB
 
         // static_assert(!std::is_same_v<EntryType, void>, "ERROR: EntryType type can not be void");
 
+        /** Shall outlive the entries: declared before the tables **/
+        std::pmr::unsynchronized_pool_resource entriesPool { &Memory::heapResource() };
+
+        /** Exclusive for the additions and the removals, shared for the lookups **/
+        mutable std::shared_mutex mtxEntries;
+
         std::unordered_map<size_t, SharedEntry> entryTable{};
         std::unordered_map<std::string, SharedEntry> tableByName{};
 
@@ -96,12 +112,35 @@ namespace DB
          */
         EntryPointer addEntry(const std::string &name)
         {
-            SharedEntry objPtr = std::make_shared<EntryType>(name);
+            std::lock_guard<std::shared_mutex> lock { mtxEntries };
+            SharedEntry objPtr = std::allocate_shared<EntryType>(
+                    std::pmr::polymorphic_allocator<EntryType> { &entriesPool }, name);
             entryTable.emplace(objPtr->id, objPtr);
             const auto& [iter, ok] = tableByName.emplace(objPtr->name, std::move(objPtr));
             return iter->second.get();
         }
 
+        /**
+          * Removes the entry from both tables
+          *
+          * @param id the entry ID
+          * @return the removed entry (nullptr in case if no entry was found in table)
+          * @note The entry is destroyed together with the last reference: the caller shall keep it until no
+          * reader can use the pointers to it handed out before (see Concurrency::RetiredList)
+         */
+        std::shared_ptr<EntryType> removeEntry(size_t id)
+        {
+            std::lock_guard<std::shared_mutex> lock { mtxEntries };
+            const auto iter = entryTable.find(id);
+            if (entryTable.end() == iter)
+                return nullptr;
+
+            SharedEntry entry = std::move(iter->second);
+            entryTable.erase(iter);
+            tableByName.erase(entry->name);
+            return entry;
+        }
+
         /**
           * Searches for an entry in the table by its name
           *
@@ -111,6 +150,7 @@ namespace DB
           * the stored object - therefore returning <b>*T</b> instead of <b>std::shared_ptr<T></b>
          */
         std::optional<EntryPointer> findEntryName(const std::string &name) const noexcept {
+            std::shared_lock<std::shared_mutex> lock { mtxEntries };
             if (const auto it = tableByName.find(name); tableByName.end() != it)
                 return std::make_optional<EntryPointer>(it->second.get());
             return std::nullopt;
@@ -125,6 +165,7 @@ namespace DB
           * the stored object - therefore returning <b>*T</b> instead of <b>std::shared_ptr<T></b>
          */
         std::optional<EntryPointer> findEntryByID(size_t id) const noexcept {
+            std::shared_lock<std::shared_mutex> lock { mtxEntries };
             if (const auto it = entryTable.find(id); entryTable.end() != it)
                 return std::make_optional<EntryPointer>(it->second.get());
             return std::nullopt;
@@ -141,6 +182,23 @@ namespace DB
         [[nodiscard]]
         std::vector<EntryPointer> getAllEntries() const {
             std::vector<EntryPointer> allRecords;
+            std::shared_lock<std::shared_mutex> lock { mtxEntries };
+            allRecords.reserve(entryTable.size());
+            for (const auto &[id, obj]: entryTable)
+                allRecords.push_back(obj.get());
+            return allRecords;
+        }
+
+        /**
+          * Return the list of records in table, allocated from the specified memory resource
+          *
+          * @param resource the memory resource for the result (e.g. the Memory::RequestArena of the request)
+          * @return the list (vector) of all data in table [std::pmr::vector<T*>]
+         */
+        [[nodiscard]]
+        std::pmr::vector<EntryPointer> getAllEntries(std::pmr::memory_resource* resource) const {
+            std::pmr::vector<EntryPointer> allRecords { resource };
+            std::shared_lock<std::shared_mutex> lock { mtxEntries };
             allRecords.reserve(entryTable.size());
             for (const auto &[id, obj]: entryTable)
                 allRecords.push_back(obj.get());
@@ -0,0 +1,282 @@
+/**
+ * @file       EpochDomain.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Epoch-based memory reclamation (RCU-like read side)
+ */
+
+#ifndef BOOKINGSERVICE_EPOCHDOMAIN_H
+#define BOOKINGSERVICE_EPOCHDOMAIN_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Concurrency.h"
+
+namespace Concurrency
+{
+    /**
+     * @brief Epoch-based reclamation domain.<br>
+     * Readers announce the global epoch in their own (cache line padded) slot when entering a critical section,
+     * so the read side never writes to a shared cache line and never takes a lock. <br>
+     * Writers unlink the object first and then <i>retire</i> it: the object is deleted only when no reader
+     * which could have observed it is left in the critical section
+     * @note A single process-wide domain: each thread owns one slot, registered on the first use
+     */
+    class EpochDomain
+    {
+        /** Slot value for the threads which are not in the critical section **/
+        static constexpr uint64_t idle { std::numeric_limits<uint64_t>::max() };
+
+        /** Maximum number of the threads simultaneously registered in the domain **/
+        static constexpr size_t slotsMax { 512 };
+
+        /** Number of the retired objects which triggers the reclamation attempt **/
+        static constexpr size_t reclaimBatch { 16 };
+
+        struct alignas(cacheLineSize) Slot
+        {
+            std::atomic<uint64_t> epoch { idle };
+            std::atomic<bool> used { false };
+        };
+
+        struct Retired
+        {
+            uint64_t epoch { 0 };
+            void* object { nullptr };
+            void (*deleter)(void*) { nullptr };
+        };
+
+        /**
+         * @brief The calling thread registration in the domain (released on the thread exit)
+         */
+        struct ThreadSlot
+        {
+            Slot* slot { nullptr };
+            size_t depth { 0 };
+
+            ThreadSlot();
+            ~ThreadSlot();
+        };
+
+        std::array<Slot, slotsMax> slots {};
+        alignas(cacheLineSize) std::atomic<uint64_t> globalEpoch { 1 };
+
+        std::mutex mtxRetired;
+        std::vector<Retired> retired;
+
+        EpochDomain() = default;
+
+        static ThreadSlot& threadSlot() {
+            static thread_local ThreadSlot slot;
+            return slot;
+        }
+
+    public:
+
+        EpochDomain(const EpochDomain&) = delete;
+        EpochDomain& operator=(const EpochDomain&) = delete;
+
+        ~EpochDomain()
+        {
+            // No readers left at the moment of the static destruction
+            for (const Retired& entry: retired)
+                entry.deleter(entry.object);
+        }
+
+        /**
+         * Returns the process-wide domain instance
+         */
+        static EpochDomain& instance()
+        {
+            static EpochDomain domain;
+            return domain;
+        }
+
+        /**
+         * @brief RAII read-side critical section: the objects observed inside of it stay alive until it ends.<br>
+         * Critical sections may be nested; only the outermost one announces the epoch
+         */
+        class Guard
+        {
+            ThreadSlot* owner { nullptr };
+
+        public:
+
+            Guard(): owner { &threadSlot() }
+            {
+                if (0 == owner->depth++) {
+                    const uint64_t epoch = instance().globalEpoch.load(std::memory_order_seq_cst);
+                    owner->slot->epoch.store(epoch, std::memory_order_seq_cst);
+                }
+            }
+
+            Guard(Guard&& other) noexcept: owner { std::exchange(other.owner, nullptr) } {
+            }
+
+            Guard(const Guard&) = delete;
+            Guard& operator=(const Guard&) = delete;
+            Guard& operator=(Guard&&) = delete;
+
+            ~Guard()
+            {
+                if (owner && 0 == --owner->depth)
+                    owner->slot->epoch.store(idle, std::memory_order_release);
+            }
+        };
+
+        /**
+         * Schedules the deletion of the object which is already unreachable for the new readers
+         * @param object the object to be deleted once all the readers which may reference it are gone
+         */
+        template<typename T>
+        void retire(const T* object)
+        {
+            const uint64_t epoch = globalEpoch.fetch_add(1, std::memory_order_seq_cst);
+            std::lock_guard<std::mutex> lock { mtxRetired };
+            retired.push_back({epoch, const_cast<T*>(object), [](void* ptr) { delete static_cast<T*>(ptr); }});
+            if (retired.size() >= reclaimBatch)
+                reclaimLocked();
+        }
+
+        /**
+         * Deletes all the retired objects which can not be referenced by any reader anymore
+         * @return the number of the objects deleted
+         */
+        size_t reclaim()
+        {
+            std::lock_guard<std::mutex> lock { mtxRetired };
+            return reclaimLocked();
+        }
+
+        /**
+         * Returns the number of the retired objects waiting to be deleted
+         */
+        [[nodiscard]]
+        size_t pending()
+        {
+            std::lock_guard<std::mutex> lock { mtxRetired };
+            return retired.size();
+        }
+
+        /**
+         * Advances the global epoch: to be called once the object is unlinked (see RetiredList)
+         * @return the retirement epoch of the object
+         */
+        uint64_t advance() noexcept {
+            return globalEpoch.fetch_add(1, std::memory_order_seq_cst);
+        }
+
+        /**
+         * Returns the oldest epoch announced by the readers: the objects retired before it can not be
+         * referenced by any reader anymore
+         */
+        [[nodiscard]]
+        uint64_t minActiveEpoch() const noexcept
+        {
+            uint64_t minEpoch = idle;
+            for (const Slot& slot: slots)
+                minEpoch = std::min(minEpoch, slot.epoch.load(std::memory_order_seq_cst));
+            return minEpoch;
+        }
+
+    private:
+
+        size_t reclaimLocked()
+        {
+            const uint64_t minEpoch = minActiveEpoch();
+            const auto alive = std::partition(retired.begin(), retired.end(), [minEpoch](const Retired& entry) {
+                return entry.epoch >= minEpoch;
+            });
+            const size_t reclaimed = std::distance(alive, retired.end());
+            for (auto iter = alive; iter != retired.end(); ++iter)
+                iter->deleter(iter->object);
+            retired.erase(alive, retired.end());
+            return reclaimed;
+        }
+    };
+
+    /**
+     * @brief The objects retired by a single owner and destroyed by the owner itself.<br>
+     * Unlike EpochDomain::retire(), the objects are destroyed only in the owner context (under its own lock)
+     * and never outlive the owner: suitable for the objects allocated from the owner memory resources or
+     * for the slots the owner reuses
+     * @tparam T type of the retired object (e.g. std::shared_ptr or the slot index)
+     * @note Not synchronized: shall be used under the owner lock
+     */
+    template<typename T>
+    class RetiredList
+    {
+        /** Retired in the order of the epochs: the reclaimable ones are always at the front **/
+        std::deque<std::pair<uint64_t, T>> retired;
+
+    public:
+
+        /**
+         * Retires the object, already unreachable for the new readers
+         */
+        void retire(T object) {
+            retired.emplace_back(EpochDomain::instance().advance(), std::move(object));
+        }
+
+        /**
+         * Destroys the objects no reader can reference anymore
+         * @param onReclaim callable <b>void(T&&)</b> receiving the reclaimed objects (e.g. to reuse them)
+         * @return the number of the objects reclaimed
+         */
+        template<typename Callback>
+        size_t reclaim(Callback&& onReclaim)
+        {
+            size_t reclaimed = 0;
+            const uint64_t minEpoch = EpochDomain::instance().minActiveEpoch();
+            for (; !retired.empty() && retired.front().first < minEpoch; ++reclaimed) {
+                onReclaim(std::move(retired.front().second));
+                retired.pop_front();
+            }
+            return reclaimed;
+        }
+
+        size_t reclaim() {
+            return reclaim([](T&&) {});
+        }
+
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return retired.size();
+        }
+    };
+
+    inline EpochDomain::ThreadSlot::ThreadSlot()
+    {
+        EpochDomain& domain = instance();
+        for (;;) {
+            for (Slot& candidate: domain.slots) {
+                bool expected = false;
+                if (!candidate.used.load(std::memory_order_relaxed) &&
+                    candidate.used.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                    slot = &candidate;
+                    return;
+                }
+            }
+            // All the slots are taken: wait for some thread to exit
+            std::this_thread::yield();
+        }
+    }
+
+    inline EpochDomain::ThreadSlot::~ThreadSlot()
+    {
+        slot->epoch.store(idle, std::memory_order_release);
+        slot->used.store(false, std::memory_order_release);
+    }
+}
+
+#endif //BOOKINGSERVICE_EPOCHDOMAIN_H
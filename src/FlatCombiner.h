@@ -0,0 +1,117 @@
+/**
+ * @file       FlatCombiner.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Flat combining synchronization primitive
+ */
+
+#ifndef BOOKINGSERVICE_FLATCOMBINER_H
+#define BOOKINGSERVICE_FLATCOMBINER_H
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "Concurrency.h"
+
+namespace Concurrency
+{
+    /**
+     * @brief Flat combining executor.<br>
+     * Threads publish their requests into a lock-free list, and whichever thread manages to acquire the lock
+     * (the <i>combiner</i>) applies the whole batch of pending requests in a single pass. <br>
+     * The rest of the threads just wait for their own request to be marked as done, so the lock (and the data
+     * protected by it) stays in the cache of a single core for the entire batch.
+     * @tparam Payload the request data passed to the apply function
+     * @tparam Result the per-request result returned by the apply function
+     * @note The lock is passed by reference, so that the owner can keep using it for non-combined operations
+     */
+    template<typename Payload, typename Result>
+    class FlatCombiner
+    {
+        struct Request
+        {
+            Payload payload;
+            Result result {};
+            Request* next { nullptr };
+            std::atomic<bool> done { false };
+        };
+
+        /** Maximum number of the batches a single combiner applies before releasing the lock **/
+        static constexpr size_t combinePassesMax { 8 };
+
+        std::mutex& mtx;
+        std::atomic<Request*> pending { nullptr };
+
+    public:
+
+        explicit FlatCombiner(std::mutex& mtx) noexcept: mtx { mtx } {
+        }
+
+        FlatCombiner(const FlatCombiner&) = delete;
+        FlatCombiner& operator=(const FlatCombiner&) = delete;
+
+        /**
+         * Publishes the request and waits until it is applied (either by this thread or by the other combiner)
+         * @param payload the request data
+         * @param apply callable <b>Result(const Payload&)</b> invoked under the lock
+         * @return the result produced by the <b>apply</b> call for this very request
+         * @note The request record lives on the caller stack - no memory allocations are performed
+         */
+        template<typename Fn>
+        Result submit(const Payload& payload, Fn&& apply)
+        {
+            Request request { payload };
+            Request* head = pending.load(std::memory_order_relaxed);
+            do {
+                request.next = head;
+            } while (!pending.compare_exchange_weak(head, &request,
+                                                    std::memory_order_release, std::memory_order_relaxed));
+
+            while (!request.done.load(std::memory_order_acquire))
+            {
+                if (mtx.try_lock()) {
+                    combine(apply);
+                    mtx.unlock();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            return request.result;
+        }
+
+    private:
+
+        template<typename Fn>
+        void combine(Fn& apply)
+        {
+            for (size_t pass = 0; pass < combinePassesMax; ++pass)
+            {
+                Request* batch = pending.exchange(nullptr, std::memory_order_acquire);
+                if (nullptr == batch)
+                    return;
+
+                // The list is LIFO: reverse it to apply requests in the order they were published
+                Request* ordered = nullptr;
+                while (batch) {
+                    Request* next = batch->next;
+                    batch->next = ordered;
+                    ordered = batch;
+                    batch = next;
+                }
+
+                while (ordered) {
+                    // Read the link first: once 'done' is set the owner may leave and destroy the request
+                    Request* next = ordered->next;
+                    ordered->result = apply(ordered->payload);
+                    ordered->done.store(true, std::memory_order_release);
+                    ordered = next;
+                }
+            }
+        }
+    };
+}
+
+#endif //BOOKINGSERVICE_FLATCOMBINER_H
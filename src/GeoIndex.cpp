@@ -0,0 +1,129 @@
+/**
+ * @file       GeoIndex.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Uniform grid spatial index: the nearest entries to the point with the lazy filtering
+ */
+
+#include "GeoIndex.h"
+
+#include <cmath>
+#include <numbers>
+
+namespace
+{
+    constexpr double earthRadiusKm { 6371.0088 };
+
+    constexpr double radians(double degrees) noexcept {
+        return degrees * std::numbers::pi / 180.0;
+    }
+}
+
+namespace DB
+{
+    double distanceKm(const GeoPoint& from, const GeoPoint& to) noexcept
+    {
+        const double sinLatitude = std::sin(radians(to.latitude - from.latitude) / 2);
+        const double sinLongitude = std::sin(radians(to.longitude - from.longitude) / 2);
+        const double haversine = sinLatitude * sinLatitude + std::cos(radians(from.latitude)) *
+                std::cos(radians(to.latitude)) * sinLongitude * sinLongitude;
+        return 2 * earthRadiusKm * std::asin(std::min(1.0, std::sqrt(haversine)));
+    }
+
+    void GeoIndex::add(size_t id, const GeoPoint& point)
+    {
+        const Cell cell = cellOf(point);
+        cells[keyOf(cell.row, cell.column)].push_back(Entry { id, point });
+        rowMin = std::min(rowMin, cell.row);
+        rowMax = std::max(rowMax, cell.row);
+        columnMin = std::min(columnMin, cell.column);
+        columnMax = std::max(columnMax, cell.column);
+        ++entriesCount;
+    }
+
+    bool GeoIndex::remove(size_t id, const GeoPoint& point)
+    {
+        const Cell cell = cellOf(point);
+        const auto iter = cells.find(keyOf(cell.row, cell.column));
+        if (cells.end() == iter)
+            return false;
+
+        std::vector<Entry>& entries = iter->second;
+        const auto entry = std::find_if(entries.begin(), entries.end(), [id](const Entry& entry) {
+            return entry.id == id;
+        });
+        if (entries.end() == entry)
+            return false;
+
+        // The bounding box is not shrunk: it only limits the search, so the stale one is still correct
+        *entry = entries.back();
+        entries.pop_back();
+        if (entries.empty())
+            cells.erase(iter);
+        --entriesCount;
+        return true;
+    }
+
+    GeoIndex::Cell GeoIndex::cellOf(const GeoPoint& point) const noexcept
+    {
+        return Cell { static_cast<int32_t>(std::floor((point.latitude + 90) / cellDegrees)),
+                      static_cast<int32_t>(std::floor((point.longitude + 180) / cellDegrees)) };
+    }
+
+    double GeoIndex::boundOutside(const GeoPoint& point, int32_t ring) const noexcept
+    {
+        const Cell center = cellOf(point);
+
+        // The distances (in degrees) from the point to the borders of the ring
+        const double latitudeGap = std::min((center.row + ring + 1) * cellDegrees - 90 - point.latitude,
+                                            point.latitude - ((center.row - ring) * cellDegrees - 90));
+        const double longitudeGap = std::min((center.column + ring + 1) * cellDegrees - 180 - point.longitude,
+                                             point.longitude - ((center.column - ring) * cellDegrees - 180));
+
+        // Beyond the rows of the ring: at least the latitude gap along the meridian
+        const double latitudeBound = earthRadiusKm * radians(latitudeGap);
+
+        // Beyond the columns of the ring, while within its rows: the haversine with the least cosine of latitudes
+        const double latitudeFarthest = std::min(90.0, std::abs(point.latitude) + latitudeGap);
+        const double cosines = std::cos(radians(point.latitude)) * std::cos(radians(latitudeFarthest));
+        const double sinLongitude = std::sin(radians(std::min(180.0, longitudeGap)) / 2);
+        const double longitudeBound = 2 * earthRadiusKm *
+                std::asin(std::min(1.0, std::sqrt(std::max(0.0, cosines)) * sinLongitude));
+
+        return std::min(latitudeBound, longitudeBound);
+    }
+
+    void GeoIndex::collectRing(const GeoPoint& point, Cell center, int32_t ring, double radiusKm,
+                               std::vector<Match>& candidates) const
+    {
+        const auto collectCell = [&](int32_t row, int32_t column) {
+            if (row < rowMin || row > rowMax || column < columnMin || column > columnMax)
+                return;
+            const auto iter = cells.find(keyOf(row, column));
+            if (cells.end() == iter)
+                return;
+            for (const Entry& entry: iter->second)
+                if (const double distance = distanceKm(point, entry.point); distance <= radiusKm)
+                    candidates.push_back(Match { entry.id, distance });
+        };
+
+        // Only the part of the ring within the bounding box of the occupied cells is visited
+        const int32_t columnFirst = std::max(center.column - ring, columnMin);
+        const int32_t columnLast = std::min(center.column + ring, columnMax);
+        for (const int32_t row: {center.row - ring, center.row + ring}) {
+            for (int32_t column = columnFirst; column <= columnLast; ++column)
+                collectCell(row, column);
+            if (0 == ring)
+                return;
+        }
+
+        const int32_t rowFirst = std::max(center.row - ring + 1, rowMin);
+        const int32_t rowLast = std::min(center.row + ring - 1, rowMax);
+        for (int32_t row = rowFirst; row <= rowLast; ++row) {
+            collectCell(row, center.column - ring);
+            collectCell(row, center.column + ring);
+        }
+    }
+}
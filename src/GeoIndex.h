@@ -0,0 +1,182 @@
+/**
+ * @file       GeoIndex.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Uniform grid spatial index: the nearest entries to the point with the lazy filtering
+ */
+
+#ifndef BOOKINGSERVICE_GEOINDEX_H
+#define BOOKINGSERVICE_GEOINDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace DB
+{
+    /**
+     * @brief The point on the Earth surface in degrees
+     */
+    struct GeoPoint
+    {
+        double latitude { 0 };
+        double longitude { 0 };
+    };
+
+    /**
+     * Returns the great-circle (haversine) distance between the points in kilometers
+     */
+    [[nodiscard]]
+    double distanceKm(const GeoPoint& from, const GeoPoint& to) noexcept;
+
+    /**
+     * @brief The spatial index of the entries locations: the uniform grid of the latitude/longitude cells.<br>
+     * The nearest search visits the cells in the rings of the growing size around the point cell and checks the
+     * candidates in the order of the distance: the ring is only visited if it may hold an entry closer than the
+     * candidates found so far, so the query touches a few cells around the point no matter how large the index is
+     * @note Concurrent queries are safe. Like the DB::Table itself, additions and removals shall not run
+     * concurrently with the queries. The cells are not wrapped around the antimeridian
+     */
+    class GeoIndex
+    {
+    public:
+
+        /** The search result: the entry ID and its distance from the point **/
+        struct Match
+        {
+            size_t id { 0 };
+            double distanceKm { 0 };
+        };
+
+        /** The cell size: about 28 km by latitude, so the city is covered by a few cells **/
+        static constexpr double cellDegreesDefault { 0.25 };
+
+        explicit GeoIndex(double cellDegrees = cellDegreesDefault) noexcept: cellDegrees { cellDegrees } {
+        }
+
+        /**
+         * Adds the entry location to the index
+         * @param id the entry ID
+         * @param point the entry location
+         */
+        void add(size_t id, const GeoPoint& point);
+
+        /**
+         * Removes the entry from the index
+         * @param id the entry ID
+         * @param point the entry location, as it was added
+         * @return False if there is no such entry at the location
+         */
+        bool remove(size_t id, const GeoPoint& point);
+
+        /**
+         * Returns the nearest entries accepted by the predicate
+         * @param point the point to search around
+         * @param limit the maximum number of the results (top-k)
+         * @param radiusKm the entries farther than the radius are not considered
+         * @param accept called with the Match of the candidate in the order of the distance, until the limit of
+         *        the accepted ones is reached: the expensive checks are performed for the nearest candidates only
+         * @return the accepted entries ordered by the distance
+         */
+        template<typename Predicate>
+        [[nodiscard]]
+        std::vector<Match> nearest(const GeoPoint& point, size_t limit, double radiusKm, Predicate&& accept) const;
+
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return entriesCount;
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return 0 == entriesCount;
+        }
+
+    private:
+
+        struct Entry
+        {
+            size_t id { 0 };
+            GeoPoint point;
+        };
+
+        struct Cell
+        {
+            int32_t row { 0 };
+            int32_t column { 0 };
+        };
+
+        double cellDegrees { cellDegreesDefault };
+        std::unordered_map<uint64_t, std::vector<Entry>> cells;
+        size_t entriesCount { 0 };
+
+        /** The bounding box of the cells ever occupied: the search stops once its ring covers it **/
+        int32_t rowMin { std::numeric_limits<int32_t>::max() };
+        int32_t rowMax { std::numeric_limits<int32_t>::min() };
+        int32_t columnMin { std::numeric_limits<int32_t>::max() };
+        int32_t columnMax { std::numeric_limits<int32_t>::min() };
+
+        [[nodiscard]]
+        Cell cellOf(const GeoPoint& point) const noexcept;
+
+        [[nodiscard]]
+        static uint64_t keyOf(int32_t row, int32_t column) noexcept {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(row)) << 32) | static_cast<uint32_t>(column);
+        }
+
+        /**
+         * Returns the lower bound of the distance from the point to any entry outside of the ring
+         * of the given radius (in cells) around the point cell
+         */
+        [[nodiscard]]
+        double boundOutside(const GeoPoint& point, int32_t ring) const noexcept;
+
+        /** Appends the entries of the ring cells (within the radius) to the candidates **/
+        void collectRing(const GeoPoint& point, Cell center, int32_t ring, double radiusKm,
+                         std::vector<Match>& candidates) const;
+    };
+
+    template<typename Predicate>
+    std::vector<GeoIndex::Match> GeoIndex::nearest(const GeoPoint& point, size_t limit, double radiusKm,
+                                                   Predicate&& accept) const
+    {
+        std::vector<Match> found;
+        if (0 == limit || empty())
+            return found;
+
+        // The min-heap of the candidates by the distance: only those closer than the unvisited rings are checked
+        const auto farther = [](const Match& left, const Match& right) {
+            return left.distanceKm > right.distanceKm || (left.distanceKm == right.distanceKm && left.id > right.id);
+        };
+        std::vector<Match> candidates;
+        const Cell center = cellOf(point);
+        for (int32_t ring = 0; ; ++ring)
+        {
+            collectRing(point, center, ring, radiusKm, candidates);
+            std::make_heap(candidates.begin(), candidates.end(), farther);
+
+            const bool covered = center.row - ring <= rowMin && center.row + ring >= rowMax &&
+                                 center.column - ring <= columnMin && center.column + ring >= columnMax;
+            const double bound = covered ? std::numeric_limits<double>::infinity() : boundOutside(point, ring);
+            while (!candidates.empty() && candidates.front().distanceKm <= bound)
+            {
+                std::pop_heap(candidates.begin(), candidates.end(), farther);
+                const Match candidate = candidates.back();
+                candidates.pop_back();
+                if (accept(candidate)) {
+                    found.push_back(candidate);
+                    if (found.size() == limit)
+                        return found;
+                }
+            }
+            if (covered || bound > radiusKm)
+                return found;
+        }
+    }
+}
+
+#endif //BOOKINGSERVICE_GEOINDEX_H
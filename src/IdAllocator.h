@@ -0,0 +1,104 @@
+/**
+ * @file       IdAllocator.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Thread-safe unique IDs allocation for the Table entries
+ */
+
+#ifndef BOOKINGSERVICE_IDALLOCATOR_H
+#define BOOKINGSERVICE_IDALLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Concurrency.h"
+
+namespace DB
+{
+    /**
+     * @brief Allocates the unique IDs of the entries of the <b>T</b> type (each type has its own sequence).<br>
+     * Threads reserve the blocks of IDs from the global atomic counter and hand them out locally, so the shared
+     * cache line is touched once per <b>blockSize</b> allocations. IDs are unique, but not dense: the IDs
+     * allocated by different threads interleave block-wise, and the unused rest of the block is lost when the thread
+     * exits. A single thread gets the strictly sequential IDs starting from 1
+     * @tparam T the entry type the IDs are allocated for
+     */
+    template<typename T>
+    class IdAllocator
+    {
+        /** Number of the IDs a thread reserves at once **/
+        static constexpr size_t blockSize { 64 };
+
+        struct alignas(Concurrency::cacheLineSize) Sequence
+        {
+            std::atomic<size_t> next { 1 };
+            /** Incremented on each reset()/resumeFrom(): the blocks reserved earlier are abandoned **/
+            std::atomic<uint64_t> generation { 0 };
+        };
+
+        struct Block
+        {
+            size_t next { 0 };
+            size_t end { 0 };
+            uint64_t generation { 0 };
+        };
+
+        static Sequence& sequence() noexcept {
+            static Sequence global;
+            return global;
+        }
+
+        static Block& threadBlock() noexcept {
+            static thread_local Block block;
+            return block;
+        }
+
+    public:
+
+        /**
+         * Returns the next unique ID (never zero)
+         */
+        [[nodiscard]]
+        static size_t allocate() noexcept
+        {
+            Sequence& global = sequence();
+            Block& block = threadBlock();
+            const uint64_t generation = global.generation.load(std::memory_order_acquire);
+            if (block.next == block.end || block.generation != generation) {
+                block.next = global.next.fetch_add(blockSize, std::memory_order_relaxed);
+                block.end = block.next + blockSize;
+                block.generation = generation;
+            }
+            return block.next++;
+        }
+
+        /**
+         * Continues the sequence after the entries restored from the persistent storage
+         * @param maxId the greatest ID in use: all the IDs allocated later are greater than it
+         */
+        static void resumeFrom(size_t maxId) noexcept
+        {
+            Sequence& global = sequence();
+            size_t next = global.next.load(std::memory_order_relaxed);
+            while (next <= maxId && !global.next.compare_exchange_weak(next, maxId + 1, std::memory_order_relaxed)) {
+            }
+            global.generation.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        /**
+         * Restarts the sequence from 1
+         * @note Intended for tests: the IDs allocated before are not unique anymore
+         */
+        static void reset() noexcept
+        {
+            Sequence& global = sequence();
+            global.next.store(1, std::memory_order_relaxed);
+            global.generation.fetch_add(1, std::memory_order_acq_rel);
+        }
+    };
+}
+
+#endif //BOOKINGSERVICE_IDALLOCATOR_H
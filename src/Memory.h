@@ -0,0 +1,112 @@
+/**
+ * @file       Memory.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Memory resources: allocation counters and the per-request arenas
+ */
+
+#ifndef BOOKINGSERVICE_MEMORY_H
+#define BOOKINGSERVICE_MEMORY_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+//! Polymorphic memory resources (std::pmr) used by the service to keep the hot paths off the global heap
+namespace Memory
+{
+    /**
+     * @brief Memory resource forwarding all the requests to the upstream one and counting them
+     */
+    class CountingResource: public std::pmr::memory_resource
+    {
+        std::pmr::memory_resource* upstream { nullptr };
+        std::atomic<size_t> allocationsCount { 0 };
+        std::atomic<size_t> deallocationsCount { 0 };
+        std::atomic<size_t> bytesAllocated { 0 };
+
+    public:
+
+        explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept:
+                upstream { upstream } {
+        }
+
+        /** Number of the allocations performed so far **/
+        [[nodiscard]]
+        size_t allocations() const noexcept {
+            return allocationsCount.load(std::memory_order_relaxed);
+        }
+
+        /** Number of the deallocations performed so far **/
+        [[nodiscard]]
+        size_t deallocations() const noexcept {
+            return deallocationsCount.load(std::memory_order_relaxed);
+        }
+
+        /** Total number of bytes allocated so far (deallocations are not subtracted) **/
+        [[nodiscard]]
+        size_t bytes() const noexcept {
+            return bytesAllocated.load(std::memory_order_relaxed);
+        }
+
+    private:
+
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            allocationsCount.fetch_add(1, std::memory_order_relaxed);
+            bytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+            return upstream->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+        {
+            deallocationsCount.fetch_add(1, std::memory_order_relaxed);
+            upstream->deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]]
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    /**
+     * Returns the process-wide resource, through which the service memory resources take the memory from the
+     * global heap: its counters show how often the pools and the arenas fall back to the heap
+     */
+    inline CountingResource& heapResource() noexcept
+    {
+        static CountingResource resource;
+        return resource;
+    }
+
+    /**
+     * @brief Monotonic arena for the short-lived data of a single request (parsed input, query results).<br>
+     * The memory is taken from the inline buffer (usually on the stack of the request handler) and released all
+     * at once when the arena is destroyed. Only the requests exceeding the buffer capacity reach the heap
+     * @tparam Capacity size of the inline buffer in bytes
+     * @note Not thread-safe: an arena belongs to a single request
+     */
+    template<size_t Capacity>
+    class RequestArena
+    {
+        alignas(std::max_align_t) std::array<std::byte, Capacity> buffer;
+        std::pmr::monotonic_buffer_resource resource { buffer.data(), buffer.size(), &heapResource() };
+
+    public:
+
+        RequestArena() = default;
+        RequestArena(const RequestArena&) = delete;
+        RequestArena& operator=(const RequestArena&) = delete;
+
+        [[nodiscard]]
+        std::pmr::memory_resource* get() noexcept {
+            return &resource;
+        }
+    };
+}
+
+#endif //BOOKINGSERVICE_MEMORY_H
@@ -0,0 +1,145 @@
+/**
+ * @file       MovieInfo.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Movie metadata (genre, rating, language, format, duration) and its bitmap indexes
+ */
+
+#include "MovieInfo.h"
+
+#include <algorithm>
+#include <cctype>
+#include <vector>
+
+namespace
+{
+    using namespace std::string_view_literals;
+
+    constexpr std::array genreNames { "unknown"sv, "action"sv, "animation"sv, "comedy"sv, "crime"sv, "drama"sv,
+                                      "fantasy"sv, "horror"sv, "scifi"sv, "thriller"sv };
+    constexpr std::array ratingNames { "unrated"sv, "g"sv, "pg"sv, "pg13"sv, "r"sv, "nc17"sv };
+    constexpr std::array formatNames { "2d"sv, "3d"sv, "imax"sv };
+
+    bool equalsIgnoreCase(std::string_view left, std::string_view right) noexcept
+    {
+        return std::equal(left.begin(), left.end(), right.begin(), right.end(), [](char lhs, char rhs) {
+            return std::tolower(static_cast<unsigned char>(lhs)) == std::tolower(static_cast<unsigned char>(rhs));
+        });
+    }
+
+    template<typename Enum, size_t Size>
+    std::optional<Enum> parse(const std::array<std::string_view, Size>& names, std::string_view name) noexcept
+    {
+        for (size_t idx = 0; idx < names.size(); ++idx)
+            if (equalsIgnoreCase(names[idx], name))
+                return static_cast<Enum>(idx);
+        return std::nullopt;
+    }
+
+    std::string lowerCase(std::string_view text)
+    {
+        std::string lower { text };
+        std::transform(lower.begin(), lower.end(), lower.begin(), [](char symbol) {
+            return static_cast<char>(std::tolower(static_cast<unsigned char>(symbol)));
+        });
+        return lower;
+    }
+}
+
+namespace Booking
+{
+    std::string_view toString(Genre genre) noexcept {
+        return genreNames[static_cast<size_t>(genre)];
+    }
+
+    std::string_view toString(Rating rating) noexcept {
+        return ratingNames[static_cast<size_t>(rating)];
+    }
+
+    std::string_view toString(Format format) noexcept {
+        return formatNames[static_cast<size_t>(format)];
+    }
+
+    std::optional<Genre> parseGenre(std::string_view name) noexcept {
+        return parse<Genre>(genreNames, name);
+    }
+
+    std::optional<Rating> parseRating(std::string_view name) noexcept {
+        return parse<Rating>(ratingNames, name);
+    }
+
+    std::optional<Format> parseFormat(std::string_view name) noexcept {
+        return parse<Format>(formatNames, name);
+    }
+
+    void MovieAttributesIndex::add(size_t id, const MovieInfo& info)
+    {
+        const auto value = static_cast<uint32_t>(id);
+        all.add(value);
+        byGenre[static_cast<size_t>(info.genre)].add(value);
+        byRating[static_cast<size_t>(info.rating)].add(value);
+        byFormat[static_cast<size_t>(info.format)].add(value);
+        if (!info.language.empty())
+            byLanguage[lowerCase(info.language)].add(value);
+    }
+
+    void MovieAttributesIndex::remove(size_t id, const MovieInfo& info)
+    {
+        const auto value = static_cast<uint32_t>(id);
+        all.remove(value);
+        playing.remove(value);
+        premieresCount.erase(value);
+        byGenre[static_cast<size_t>(info.genre)].remove(value);
+        byRating[static_cast<size_t>(info.rating)].remove(value);
+        byFormat[static_cast<size_t>(info.format)].remove(value);
+        if (const auto language = byLanguage.find(lowerCase(info.language)); byLanguage.end() != language) {
+            language->second.remove(value);
+            if (language->second.empty())
+                byLanguage.erase(language);
+        }
+    }
+
+    void MovieAttributesIndex::addPremiere(size_t id)
+    {
+        const auto value = static_cast<uint32_t>(id);
+        if (1 == ++premieresCount[value])
+            playing.add(value);
+    }
+
+    void MovieAttributesIndex::removePremiere(size_t id)
+    {
+        const auto value = static_cast<uint32_t>(id);
+        const auto count = premieresCount.find(value);
+        if (premieresCount.end() == count)
+            return;
+        if (0 == --count->second) {
+            premieresCount.erase(count);
+            playing.remove(value);
+        }
+    }
+
+    DB::RoaringBitmap MovieAttributesIndex::select(const MovieFilter& filter) const
+    {
+        std::vector<const DB::RoaringBitmap*> bitmaps;
+        if (filter.playingOnly)
+            bitmaps.push_back(&playing);
+        if (filter.genre)
+            bitmaps.push_back(&byGenre[static_cast<size_t>(filter.genre.value())]);
+        if (filter.rating)
+            bitmaps.push_back(&byRating[static_cast<size_t>(filter.rating.value())]);
+        if (filter.format)
+            bitmaps.push_back(&byFormat[static_cast<size_t>(filter.format.value())]);
+        if (filter.language) {
+            const auto language = byLanguage.find(lowerCase(filter.language.value()));
+            if (byLanguage.end() == language)
+                return DB::RoaringBitmap {};
+            bitmaps.push_back(&language->second);
+        }
+
+        if (bitmaps.empty())
+            return all;
+        return DB::RoaringBitmap::intersect(bitmaps);
+    }
+}
@@ -0,0 +1,168 @@
+/**
+ * @file       MovieInfo.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Movie metadata (genre, rating, language, format, duration) and its bitmap indexes
+ */
+
+#ifndef BOOKINGSERVICE_MOVIEINFO_H
+#define BOOKINGSERVICE_MOVIEINFO_H
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "RoaringBitmap.h"
+
+namespace Booking
+{
+    enum class Genre : uint8_t
+    {
+        Unknown,
+        Action,
+        Animation,
+        Comedy,
+        Crime,
+        Drama,
+        Fantasy,
+        Horror,
+        SciFi,
+        Thriller
+    };
+
+    /** The MPA rating **/
+    enum class Rating : uint8_t
+    {
+        Unrated,
+        G,
+        PG,
+        PG13,
+        R,
+        NC17
+    };
+
+    /** The projection format **/
+    enum class Format : uint8_t
+    {
+        Standard,
+        ThreeD,
+        IMAX
+    };
+
+    /**
+     * @brief The Movie metadata
+     */
+    struct MovieInfo
+    {
+        Genre genre { Genre::Unknown };
+        Rating rating { Rating::Unrated };
+
+        /** ISO 639-1 code of the original language (e.g. "en"), empty - unknown **/
+        std::string language;
+
+        Format format { Format::Standard };
+        uint16_t durationMinutes { 0 };
+    };
+
+    /**
+     * @brief The listing filter: the movies matching all the attributes specified
+     */
+    struct MovieFilter
+    {
+        /** Only the movies currently playing in theaters **/
+        bool playingOnly { false };
+
+        std::optional<Genre> genre { std::nullopt };
+        std::optional<Rating> rating { std::nullopt };
+        std::optional<std::string> language { std::nullopt };
+        std::optional<Format> format { std::nullopt };
+
+        /** Not longer than: the only attribute checked per movie instead of the bitmap **/
+        std::optional<uint16_t> durationMax { std::nullopt };
+    };
+
+    [[nodiscard]]
+    std::string_view toString(Genre genre) noexcept;
+
+    [[nodiscard]]
+    std::string_view toString(Rating rating) noexcept;
+
+    [[nodiscard]]
+    std::string_view toString(Format format) noexcept;
+
+    /**
+     * Parses the genre name (as returned by toString(Genre), case-insensitive)
+     */
+    [[nodiscard]]
+    std::optional<Genre> parseGenre(std::string_view name) noexcept;
+
+    [[nodiscard]]
+    std::optional<Rating> parseRating(std::string_view name) noexcept;
+
+    [[nodiscard]]
+    std::optional<Format> parseFormat(std::string_view name) noexcept;
+
+    /**
+     * @brief The bitmap index of the movies by the each value of the each attribute: the filtered listing is
+     * the intersection of the bitmaps of the values requested (see DB::RoaringBitmap), no movie is visited
+     * unless it matches. The "playing" bitmap is maintained from the premieres counts
+     * @note Like the DB::Table, modifications shall not run concurrently with the queries
+     */
+    class MovieAttributesIndex
+    {
+        DB::RoaringBitmap all;
+        DB::RoaringBitmap playing;
+        std::array<DB::RoaringBitmap, static_cast<size_t>(Genre::Thriller) + 1> byGenre;
+        std::array<DB::RoaringBitmap, static_cast<size_t>(Rating::NC17) + 1> byRating;
+        std::array<DB::RoaringBitmap, static_cast<size_t>(Format::IMAX) + 1> byFormat;
+        std::unordered_map<std::string, DB::RoaringBitmap> byLanguage;
+
+        /** The number of the premieres of the each playing movie **/
+        std::unordered_map<uint32_t, uint32_t> premieresCount;
+
+    public:
+
+        /**
+         * Adds the movie to the bitmaps of its attributes values
+         * @param id the Movie ID (shall fit 32 bits)
+         */
+        void add(size_t id, const MovieInfo& info);
+
+        /**
+         * Removes the movie from all the bitmaps
+         * @param info the movie attributes, as they were added
+         */
+        void remove(size_t id, const MovieInfo& info);
+
+        /**
+         * Accounts the premiere of the movie scheduled: the first one makes the movie playing
+         */
+        void addPremiere(size_t id);
+
+        /**
+         * Accounts the premiere of the movie unscheduled: the movie is not playing after the last one
+         */
+        void removePremiere(size_t id);
+
+        /**
+         * Returns the IDs of the movies matching the filter (except for the durationMax)
+         */
+        [[nodiscard]]
+        DB::RoaringBitmap select(const MovieFilter& filter) const;
+
+        /**
+         * Returns the IDs of the movies currently playing
+         */
+        [[nodiscard]]
+        const DB::RoaringBitmap& getPlaying() const noexcept {
+            return playing;
+        }
+    };
+}
+
+#endif //BOOKINGSERVICE_MOVIEINFO_H
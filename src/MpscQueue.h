@@ -0,0 +1,105 @@
+/**
+ * @file       MpscQueue.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Bounded lock-free multi-producer queue
+ */
+
+#ifndef BOOKINGSERVICE_MPSCQUEUE_H
+#define BOOKINGSERVICE_MPSCQUEUE_H
+
+#include <atomic>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+#include "Concurrency.h"
+
+namespace Concurrency
+{
+    /**
+     * @brief Bounded lock-free queue for many producers and a single consumer.<br>
+     * Each cell carries its own sequence number, so producers only contend on the tail index and
+     * never touch the consumer's head index (D. Vyukov's bounded queue algorithm)
+     * @tparam T type of the queued elements
+     */
+    template<typename T>
+    class MpscQueue
+    {
+        struct Cell
+        {
+            std::atomic<size_t> sequence { 0 };
+            T data {};
+        };
+
+        const size_t mask;
+        std::unique_ptr<Cell[]> cells;
+
+        alignas(cacheLineSize) std::atomic<size_t> tail { 0 };
+        alignas(cacheLineSize) size_t head { 0 };
+
+    public:
+
+        /**
+         * Constructor
+         * @param capacity the maximum number of elements in queue (rounded up to the power of two)
+         */
+        explicit MpscQueue(size_t capacity): mask { std::bit_ceil(std::max<size_t>(capacity, 2)) - 1 },
+                                              cells { std::make_unique<Cell[]>(mask + 1) }
+        {
+            for (size_t idx = 0; idx <= mask; ++idx)
+                cells[idx].sequence.store(idx, std::memory_order_relaxed);
+        }
+
+        MpscQueue(const MpscQueue&) = delete;
+        MpscQueue& operator=(const MpscQueue&) = delete;
+
+        /**
+         * Tries to enqueue the element. May be called from any number of threads simultaneously
+         * @return False if the queue is full
+         */
+        bool tryPush(T&& value)
+        {
+            size_t pos = tail.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& cell = cells[pos & mask];
+                const size_t seq = cell.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+                if (0 == diff) {
+                    if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        cell.data = std::move(value);
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * Tries to dequeue the element. Shall be called by the single consumer thread only
+         * @return std::nullopt if the queue is empty
+         */
+        std::optional<T> tryPop()
+        {
+            Cell& cell = cells[head & mask];
+            if (cell.sequence.load(std::memory_order_acquire) != head + 1)
+                return std::nullopt;
+
+            std::optional<T> value { std::move(cell.data) };
+            cell.sequence.store(head + mask + 1, std::memory_order_release);
+            ++head;
+            return value;
+        }
+    };
+}
+
+#endif //BOOKINGSERVICE_MPSCQUEUE_H
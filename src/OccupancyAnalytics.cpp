@@ -0,0 +1,148 @@
+/**
+ * @file       OccupancyAnalytics.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Columnar occupancy analytics over the premieres schedule
+ */
+
+#include "OccupancyAnalytics.h"
+
+#include <algorithm>
+#include <bit>
+#include <thread>
+
+namespace
+{
+    /** The ranges of fewer premieres are not worth a separate thread **/
+    constexpr size_t parallelRangeMin { 16'384 };
+
+    /**
+     * Splits the range [0, count) between the cores and calls <b>func(first, last, workerIdx)</b> for the each part
+     * @return number of the workers (parts) used
+     */
+    template<typename Fn>
+    size_t parallelFor(size_t count, Fn&& func)
+    {
+        const size_t coresCount = std::max(1u, std::thread::hardware_concurrency());
+        const size_t workersCount = std::clamp<size_t>(count / parallelRangeMin, 1, coresCount);
+        const size_t rangeSize = (count + workersCount - 1) / workersCount;
+        {
+            std::vector<std::jthread> workers;
+            for (size_t workerIdx = 1; workerIdx < workersCount; ++workerIdx)
+                workers.emplace_back([&func, workerIdx, rangeSize, count] {
+                    func(std::min(count, workerIdx * rangeSize), std::min(count, (workerIdx + 1) * rangeSize), workerIdx);
+                });
+            func(0, std::min(count, rangeSize), 0);
+        }
+        return workersCount;
+    }
+}
+
+namespace Booking
+{
+    OccupancySnapshot OccupancyAnalytics::capture()
+    {
+        OccupancySnapshot snapshot;
+        snapshot.time = std::chrono::system_clock::now();
+
+        // Scanned under the catalog lock: the premieres may be (un)scheduled concurrently
+        const bool hasVacant = service.readCatalog([&] {
+            const PremiereSchedule& schedule = service.bookingSchedule;
+            const std::span<const size_t> theaterIds = schedule.getTheaterIds();
+            const std::span<const size_t> movieIds = schedule.getMovieIds();
+            snapshot.theaterIds.assign(theaterIds.begin(), theaterIds.end());
+            snapshot.movieIds.assign(movieIds.begin(), movieIds.end());
+            snapshot.seatsBooked.resize(schedule.size());
+
+            parallelFor(schedule.size(), [&](size_t first, size_t last, size_t) {
+                for (size_t idx = first; idx < last; ++idx)
+                    snapshot.seatsBooked[idx] = schedule[idx].seatsBooked.load(std::memory_order_acquire);
+            });
+            return 0 != schedule.vacantCount();
+        });
+
+        // The slots of the unscheduled premieres are not the part of the occupancy
+        if (hasVacant) {
+            size_t alive = 0;
+            for (size_t idx = 0; idx < snapshot.movieIds.size(); ++idx) {
+                if (PremiereSchedule::vacantId == snapshot.movieIds[idx])
+                    continue;
+                snapshot.theaterIds[alive] = snapshot.theaterIds[idx];
+                snapshot.movieIds[alive] = snapshot.movieIds[idx];
+                snapshot.seatsBooked[alive] = snapshot.seatsBooked[idx];
+                ++alive;
+            }
+            snapshot.theaterIds.resize(alive);
+            snapshot.movieIds.resize(alive);
+            snapshot.seatsBooked.resize(alive);
+        }
+
+        history.push_back(TimelinePoint { snapshot.time, total(snapshot) });
+        if (history.size() > timelineCapacity)
+            history.pop_front();
+        return snapshot;
+    }
+
+    std::vector<OccupancyRow> OccupancyAnalytics::aggregate(const OccupancySnapshot& snapshot, GroupBy groupBy)
+    {
+        const std::vector<size_t>& keys = GroupBy::Theater == groupBy ? snapshot.theaterIds : snapshot.movieIds;
+        if (keys.empty())
+            return {};
+
+        // IDs are dense: the groups are the plain arrays indexed by ID instead of the hash tables
+        const size_t idMax = *std::max_element(keys.cbegin(), keys.cend());
+        struct Partial
+        {
+            std::vector<size_t> premieres;
+            std::vector<size_t> seatsBooked;
+        };
+        const size_t coresCount = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<Partial> partials(coresCount);
+
+        const size_t workersCount = parallelFor(keys.size(), [&](size_t first, size_t last, size_t workerIdx) {
+            Partial& partial = partials[workerIdx];
+            partial.premieres.assign(idMax + 1, 0);
+            partial.seatsBooked.assign(idMax + 1, 0);
+            for (size_t idx = first; idx < last; ++idx) {
+                ++partial.premieres[keys[idx]];
+                partial.seatsBooked[keys[idx]] += std::popcount(snapshot.seatsBooked[idx]);
+            }
+        });
+
+        std::vector<OccupancyRow> rows;
+        for (size_t id = 0; id <= idMax; ++id)
+        {
+            OccupancyRow row { id };
+            for (size_t workerIdx = 0; workerIdx < workersCount; ++workerIdx) {
+                row.premieres += partials[workerIdx].premieres[id];
+                row.seatsBooked += partials[workerIdx].seatsBooked[id];
+            }
+            row.seatsTotal = row.premieres * Theater::seatsCapacityMax;
+            if (0 != row.premieres)
+                rows.push_back(row);
+        }
+        return rows;
+    }
+
+    OccupancyRow OccupancyAnalytics::total(const OccupancySnapshot& snapshot)
+    {
+        const size_t coresCount = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<size_t> seatsBooked(coresCount, 0);
+        const size_t workersCount = parallelFor(snapshot.seatsBooked.size(),
+                                                [&](size_t first, size_t last, size_t workerIdx) {
+            size_t booked = 0;
+            for (size_t idx = first; idx < last; ++idx)
+                booked += std::popcount(snapshot.seatsBooked[idx]);
+            seatsBooked[workerIdx] = booked;
+        });
+
+        OccupancyRow row;
+        row.premieres = snapshot.seatsBooked.size();
+        row.seatsTotal = row.premieres * Theater::seatsCapacityMax;
+        for (size_t workerIdx = 0; workerIdx < workersCount; ++workerIdx)
+            row.seatsBooked += seatsBooked[workerIdx];
+        return row;
+    }
+}
@@ -0,0 +1,114 @@
+/**
+ * @file       OccupancyAnalytics.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Columnar occupancy analytics over the premieres schedule
+ */
+
+#ifndef BOOKINGSERVICE_OCCUPANCYANALYTICS_H
+#define BOOKINGSERVICE_OCCUPANCYANALYTICS_H
+
+#include <chrono>
+#include <deque>
+#include <vector>
+
+#include "BookingService.h"
+
+namespace Booking
+{
+    /**
+     * @brief Columnar copy of the schedule occupancy taken at some moment: the premiere I is described by
+     * the I-th element of the each column
+     */
+    struct OccupancySnapshot
+    {
+        std::chrono::system_clock::time_point time;
+        std::vector<size_t> theaterIds;
+        std::vector<size_t> movieIds;
+        /** The booked seats bitmaps (see Premiere::seatsBooked) **/
+        std::vector<uint32_t> seatsBooked;
+    };
+
+    /**
+     * @brief Aggregated occupancy of a group of premieres (of a theater, of a movie or of the whole schedule)
+     */
+    struct OccupancyRow
+    {
+        /** The Theater or Movie ID, depending on the grouping (zero for the total) **/
+        size_t id { 0 };
+        size_t premieres { 0 };
+        size_t seatsBooked { 0 };
+        size_t seatsTotal { 0 };
+
+        [[nodiscard]]
+        double ratio() const noexcept {
+            return 0 == seatsTotal ? 0.0 : static_cast<double>(seatsBooked) / static_cast<double>(seatsTotal);
+        }
+    };
+
+    /**
+     * @brief Occupancy analytics engine.<br>
+     * The schedule is captured into the columnar OccupancySnapshot (the seats bitmaps are read without locking,
+     * so the bookings are never blocked), and the aggregations run over the plain columns: the seats are counted
+     * with popcounts, grouping is done by the ID-indexed arrays (IDs are dense, see DB::IdAllocator). Both the
+     * capture and the aggregation are split by the ranges of premieres between the cores
+     * @note The schedule is scanned under the catalog lock of the service: safe against the concurrent scheduling
+     */
+    class OccupancyAnalytics
+    {
+    public:
+
+        enum class GroupBy {
+            Theater,
+            Movie
+        };
+
+        /** A point of the occupancy timeline: the total occupancy at the moment of the capture **/
+        struct TimelinePoint
+        {
+            std::chrono::system_clock::time_point time;
+            OccupancyRow total;
+        };
+
+        /** Number of the latest points kept in the timeline **/
+        static constexpr size_t timelineCapacity { 64 };
+
+        explicit OccupancyAnalytics(const BookingService& service) noexcept: service { service } {
+        }
+
+        /**
+         * Captures the current occupancy of all the premieres and appends its total to the timeline
+         */
+        [[nodiscard]]
+        OccupancySnapshot capture();
+
+        /**
+         * Returns the occupancy of the each theater or movie, ordered by ID
+         */
+        [[nodiscard]]
+        static std::vector<OccupancyRow> aggregate(const OccupancySnapshot& snapshot, GroupBy groupBy);
+
+        /**
+         * Returns the occupancy of all the premieres together
+         */
+        [[nodiscard]]
+        static OccupancyRow total(const OccupancySnapshot& snapshot);
+
+        /**
+         * Returns the totals of the latest captures (the oldest first)
+         */
+        [[nodiscard]]
+        const std::deque<TimelinePoint>& timeline() const noexcept {
+            return history;
+        }
+
+    private:
+
+        const BookingService& service;
+        std::deque<TimelinePoint> history;
+    };
+}
+
+#endif //BOOKINGSERVICE_OCCUPANCYANALYTICS_H
@@ -0,0 +1,149 @@
+/**
+ * @file       Pricing.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Dynamic seat pricing: the zone price tiers and the rules recomputed in batches over all premieres
+ */
+
+#include "Pricing.h"
+#include "BookingService.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+namespace
+{
+    using namespace Booking;
+
+    /**
+     * Multiplies the factor of the each premiere whose value matches the rule: the branch-free loop over
+     * the plain columns, vectorized by the compiler
+     */
+    template<typename Matches>
+    void applyRule(std::span<float> factors, std::span<const float> values, Matches&& matches, float factor) noexcept
+    {
+        for (size_t idx = 0; idx < factors.size(); ++idx)
+            factors[idx] *= matches(values[idx]) ? factor : 1.0f;
+    }
+
+    constexpr uint32_t seatsRange(uint32_t firstSeat, uint32_t lastSeat) noexcept {
+        return ((1u << (lastSeat - firstSeat + 1)) - 1) << (firstSeat - 1);
+    }
+
+    static_assert(Theater::seatsCapacityMax <= PricingEngine::seatsMax, "The zones shall fit all the seats");
+}
+
+namespace Booking
+{
+    PricingEngine::PricingEngine():
+            PricingEngine { { PriceZone { "Front", seatsRange(1, 5), 800 },
+                              PriceZone { "Middle", seatsRange(6, 15), 1'200 },
+                              PriceZone { "Back", seatsRange(16, Theater::seatsCapacityMax), 1'000 } },
+                            PricingRules { { OccupancyRule { 0.5f, 1.1f }, OccupancyRule { 0.8f, 1.25f } },
+                                           { LeadTimeRule { 24.0f, 1.1f }, LeadTimeRule { 2.0f, 1.2f } } } } {
+    }
+
+    PricingEngine::PricingEngine(std::vector<PriceZone> zones, PricingRules rules):
+            zones { std::move(zones) }, rules { std::move(rules) }
+    {
+        for (const PriceZone& zone: this->zones)
+            for (size_t seatIdx = 0; seatIdx < seatsMax; ++seatIdx)
+                if (zone.seats & (1u << seatIdx))
+                    seatPrices[seatIdx] = zone.basePrice;
+    }
+
+    void PricingEngine::setRules(PricingRules newRules)
+    {
+        {
+            std::lock_guard<std::mutex> lock { mtxRules };
+            rules = std::move(newRules);
+        }
+        markChanged();
+    }
+
+    void PricingEngine::notifyChanged() noexcept
+    {
+        // Taken by the waiter while checking the flag: the notification can not fall in between
+        {
+            std::lock_guard<std::mutex> lock { mtxWaiting };
+        }
+        changesWaiting.notify_one();
+    }
+
+    bool PricingEngine::waitForChanges(std::stop_token stopToken, Clock::time_point notBefore,
+                                       Clock::time_point deadline)
+    {
+        std::unique_lock<std::mutex> lock { mtxWaiting };
+        changesWaiting.wait_until(lock, stopToken, notBefore, [] { return false; });
+        return changesWaiting.wait_until(lock, stopToken, deadline, [this] {
+            return changed.load(std::memory_order_acquire);
+        });
+    }
+
+    Quote PricingEngine::quote(std::span<const uint16_t> seats, uint32_t priceFactor) const noexcept
+    {
+        uint64_t basePrice = 0;
+        for (const uint16_t seatNum: seats)
+            if (seatNum >= 1 && seatNum <= seatsMax)
+                basePrice += seatPrices[seatNum - 1];
+        // Rounded to the cents once for the whole order
+        return Quote { (basePrice * priceFactor + factorBase / 2) / factorBase, priceFactor };
+    }
+
+    size_t PricingEngine::reprice(const PremiereSchedule& schedule, Clock::time_point now, bool force)
+    {
+        std::lock_guard<std::mutex> lock { mtxRules };
+        // Reset before gathering: the bookings made during the batch shall trigger the next one
+        if (!changed.exchange(false, std::memory_order_acq_rel) && !force)
+            return 0;
+
+        const size_t count = schedule.size();
+        occupancy.resize(count);
+        hoursLeft.resize(count);
+        factors.assign(count, 1.0f);
+
+        // Gather: the only pass touching the premieres themselves
+        constexpr float seatsShare { 1.0f / Theater::seatsCapacityMax };
+        const int64_t nowSeconds = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+        for (size_t idx = 0; idx < count; ++idx)
+        {
+            const Premiere& premiere = schedule[idx];
+            occupancy[idx] = static_cast<float>(std::popcount(premiere.seatsBooked.load(std::memory_order_acquire)))
+                             * seatsShare;
+            const int64_t showtime = premiere.showtime.load(std::memory_order_relaxed);
+            hoursLeft[idx] = 0 == showtime ? std::numeric_limits<float>::infinity()
+                                           : static_cast<float>(showtime - nowSeconds) / 3'600.0f;
+        }
+
+        for (const OccupancyRule& rule: rules.occupancy)
+            applyRule(factors, occupancy, [occupancyMin = rule.occupancyMin](float value) {
+                return value >= occupancyMin;
+            }, rule.factor);
+        for (const LeadTimeRule& rule: rules.leadTime)
+            applyRule(factors, hoursLeft, [hoursMax = rule.hoursMax](float value) {
+                return value <= hoursMax;
+            }, rule.factor);
+
+        const float factorMin = rules.factorMin, factorMax = rules.factorMax;
+        for (float& factor: factors)
+            factor = std::clamp(factor, factorMin, factorMax);
+
+        // Scatter: only the changed factors are written, the premieres cache lines stay clean otherwise
+        size_t repriced = 0;
+        for (size_t idx = 0; idx < count; ++idx)
+        {
+            const uint32_t factor = static_cast<uint32_t>(factors[idx] * factorBase + 0.5f);
+            std::atomic<uint32_t>& priceFactor = schedule[idx].priceFactor;
+            if (schedule.isVacant(idx) || priceFactor.load(std::memory_order_relaxed) == factor)
+                continue;
+            priceFactor.store(factor, std::memory_order_release);
+            ++repriced;
+        }
+
+        version.fetch_add(1, std::memory_order_release);
+        return repriced;
+    }
+}
@@ -0,0 +1,198 @@
+/**
+ * @file       Pricing.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Dynamic seat pricing: the zone price tiers and the rules recomputed in batches over all premieres
+ */
+
+#ifndef BOOKINGSERVICE_PRICING_H
+#define BOOKINGSERVICE_PRICING_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+namespace Booking
+{
+    class PremiereSchedule;
+
+    /**
+     * @brief The price tier of the seat zone of the hall
+     */
+    struct PriceZone
+    {
+        std::string name;
+
+        /** The seats of the zone: bit N - 1 for the seat N (as Premiere::seatsBooked) **/
+        uint32_t seats { 0 };
+
+        /** The price of the seat (in cents) at the base price factor **/
+        uint32_t basePrice { 0 };
+    };
+
+    /** Multiplies the prices of the premiere booked by the occupancyMin share of the seats or more **/
+    struct OccupancyRule
+    {
+        float occupancyMin { 0 };
+        float factor { 1 };
+    };
+
+    /** Multiplies the prices of the premiere starting in hoursMax hours or less **/
+    struct LeadTimeRule
+    {
+        float hoursMax { 0 };
+        float factor { 1 };
+    };
+
+    /**
+     * @brief The rule set: the factors of all the rules matched are multiplied, the product is clamped
+     */
+    struct PricingRules
+    {
+        std::vector<OccupancyRule> occupancy;
+        std::vector<LeadTimeRule> leadTime;
+        float factorMin { 0.5f };
+        float factorMax { 2.0f };
+    };
+
+    /**
+     * @brief The price of the seats
+     */
+    struct Quote
+    {
+        /** The total of the seats (in cents) **/
+        uint64_t price { 0 };
+
+        /** The price factor applied: permille of the base prices of the zones **/
+        uint32_t priceFactor { 0 };
+    };
+
+    /**
+     * @brief Dynamic pricing of the premieres by the occupancy, the time left to the showtime and the seat zone.<br>
+     * The seat price is the base price of its zone times the price factor of the premiere. The factors are
+     * recomputed by reprice() in a single batch over the whole schedule: the occupancy and the lead time are
+     * gathered into the plain columns first, then each rule is applied to the whole column by the branch-free
+     * loop (vectorized by the compiler), and only the changed factors are written back to the premieres.
+     * <br> The factor of the premiere is a single atomic word, so the quote is taken with the same load as the
+     * booking sees: see Premiere::bookSeatsPriced()
+     */
+    class PricingEngine
+    {
+    public:
+
+        using Clock = std::chrono::system_clock;
+
+        /** The price factor of the base prices: the factors are permille **/
+        static constexpr uint32_t factorBase { 1'000 };
+
+        /** The seats the zones may contain: the width of the seats bitmap **/
+        static constexpr size_t seatsMax { 32 };
+
+        /**
+         * Constructor: the front, the middle and the back zones of the Theater::seatsCapacityMax seats hall and
+         * the default rules (the occupancy above 50% and 80%, the last day and the last two hours)
+         */
+        PricingEngine();
+
+        /**
+         * Constructor
+         * @param zones the zones of the hall: the seats out of any zone are free (zero price)
+         */
+        PricingEngine(std::vector<PriceZone> zones, PricingRules rules);
+
+        PricingEngine(const PricingEngine&) = delete;
+        PricingEngine& operator=(const PricingEngine&) = delete;
+
+        /**
+         * Replaces the rule set: applied to all premieres by the next reprice()
+         */
+        void setRules(PricingRules rules);
+
+        /**
+         * Returns the price of the seats at the price factor
+         * @note Lock-free: the zones never change. The seats out of the hall are not priced
+         */
+        [[nodiscard]]
+        Quote quote(std::span<const uint16_t> seats, uint32_t priceFactor) const noexcept;
+
+        /**
+         * Marks the occupancy as changed: the next reprice() recomputes the factors, the waitForChanges() returns
+         * @note Called by the premieres on each change of the seats: writes the shared flag and wakes the waiter
+         * only once per batch
+         */
+        void markChanged() noexcept
+        {
+            if (!changed.load(std::memory_order_relaxed) && !changed.exchange(true, std::memory_order_acq_rel))
+                notifyChanged();
+        }
+
+        /**
+         * Waits until the occupancy (or the rules) changes since the previous batch, but not before notBefore: the
+         * changes made in between are coalesced into a single batch
+         * @param deadline the time to stop waiting at, if nothing changes (e.g. the next forced batch)
+         * @return True, if changed. False on the deadline or the stop request
+         * @note Used by the repricing thread (see BookingService::startRepricing())
+         */
+        bool waitForChanges(std::stop_token stopToken, Clock::time_point notBefore, Clock::time_point deadline);
+
+        /**
+         * Recomputes the price factors of all the premieres of the schedule, if the occupancy (or the rules) has
+         * changed since the previous batch
+         * @param now the time the lead time to the showtimes is counted from
+         * @param force recompute anyway: the lead time changes with the time only, so the caller forces the batch
+         *        periodically
+         * @return the number of the premieres whose price factor has changed
+         * @note Like the other schedule readers, shall not run concurrently with the scheduling of new premieres
+         */
+        size_t reprice(const PremiereSchedule& schedule, Clock::time_point now = Clock::now(), bool force = false);
+
+        [[nodiscard]]
+        const std::vector<PriceZone>& getZones() const noexcept {
+            return zones;
+        }
+
+        /**
+         * Returns the number of the batches recomputed
+         */
+        [[nodiscard]]
+        uint64_t getVersion() const noexcept {
+            return version.load(std::memory_order_acquire);
+        }
+
+    private:
+
+        void notifyChanged() noexcept;
+
+        const std::vector<PriceZone> zones;
+
+        /** The base price of the seat N is at [N - 1]: the quotes never search the zones **/
+        std::array<uint32_t, seatsMax> seatPrices {};
+
+        std::atomic<bool> changed { true };
+        std::atomic<uint64_t> version { 0 };
+
+        /** Wakes the repricing thread waiting for the changes **/
+        std::mutex mtxWaiting;
+        std::condition_variable_any changesWaiting;
+
+        /** Serializes the batches with the rules updates **/
+        std::mutex mtxRules;
+        PricingRules rules;
+
+        /** The columns of the batch: reused, so the batches do not allocate in the steady state **/
+        std::vector<float> occupancy;
+        std::vector<float> hoursLeft;
+        std::vector<float> factors;
+    };
+}
+
+#endif //BOOKINGSERVICE_PRICING_H
@@ -0,0 +1,618 @@
+/**
+ * @file       Replication.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Primary/follower log-shipping replication of the BookingService over the local socket
+ */
+
+#include "Replication.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+    using namespace Replication;
+
+    /** The shipper checks the ChangeStream that often, when there is nothing to send **/
+    constexpr auto pollInterval { 100us };
+
+    int64_t nanoseconds(Clock::time_point time) noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+    }
+
+    template<typename T>
+    void append(std::string& buffer, T value) {
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void appendString(std::string& buffer, const std::string& value)
+    {
+        const auto size = static_cast<uint16_t>(std::min<size_t>(value.size(), std::numeric_limits<uint16_t>::max()));
+        append(buffer, size);
+        buffer.append(value, 0, size);
+    }
+
+    /** Sequential reader of the frame fields: fails (once and for all) on the truncated frame **/
+    class FrameReader
+    {
+        std::string_view frame;
+        bool valid { true };
+
+    public:
+
+        explicit FrameReader(std::string_view frame) noexcept: frame { frame } {
+        }
+
+        template<typename T>
+        T read() noexcept
+        {
+            T value {};
+            if (frame.size() < sizeof(T)) {
+                valid = false;
+                return value;
+            }
+            std::memcpy(&value, frame.data(), sizeof(T));
+            frame.remove_prefix(sizeof(T));
+            return value;
+        }
+
+        std::string readString()
+        {
+            const auto size = read<uint16_t>();
+            if (frame.size() < size) {
+                valid = false;
+                return {};
+            }
+            std::string value { frame.substr(0, size) };
+            frame.remove_prefix(size);
+            return value;
+        }
+
+        [[nodiscard]]
+        bool isValid() const noexcept {
+            return valid && frame.empty();
+        }
+    };
+
+    bool writeAll(int socketFd, std::string_view data) noexcept
+    {
+        while (!data.empty()) {
+            const ssize_t written = ::send(socketFd, data.data(), data.size(), MSG_NOSIGNAL);
+            if (written < 0 && EINTR == errno)
+                continue;
+            if (written <= 0)
+                return false;
+            data.remove_prefix(static_cast<size_t>(written));
+        }
+        return true;
+    }
+
+    bool readAll(int socketFd, char* data, size_t size) noexcept
+    {
+        while (size > 0) {
+            const ssize_t received = ::recv(socketFd, data, size, 0);
+            if (received < 0 && EINTR == errno)
+                continue;
+            if (received <= 0)
+                return false;
+            data += received;
+            size -= static_cast<size_t>(received);
+        }
+        return true;
+    }
+
+    template<typename Entry>
+    std::vector<Entry*> sortedById(std::vector<Entry*> entries)
+    {
+        std::sort(entries.begin(), entries.end(), [](const Entry* left, const Entry* right) {
+            return left->id < right->id;
+        });
+        return entries;
+    }
+
+    Record catalogRecord(RecordType type, int64_t timestamp, const std::string& name,
+                         const std::string& theaterName = {}, size_t premiereId = 0) {
+        return Record { type, 0, timestamp, name, theaterName, static_cast<uint32_t>(premiereId), 0, std::nullopt, {} };
+    }
+
+    Record movieRecord(int64_t timestamp, const std::string& name, const Booking::MovieInfo& info) {
+        Record record = catalogRecord(RecordType::AddMovie, timestamp, name);
+        record.movieInfo = info;
+        return record;
+    }
+
+    Record theaterRecord(int64_t timestamp, const std::string& name, std::optional<DB::GeoPoint> location) {
+        Record record = catalogRecord(RecordType::AddTheater, timestamp, name);
+        record.location = location;
+        return record;
+    }
+
+    sockaddr_un socketAddress(const std::string& path) noexcept
+    {
+        sockaddr_un address {};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+        return address;
+    }
+}
+
+namespace Replication
+{
+    void encode(const Record& record, std::string& buffer)
+    {
+        const size_t sizeOffset = buffer.size();
+        append(buffer, uint32_t { 0 });
+        append(buffer, record.type);
+        append(buffer, record.lsn);
+        append(buffer, record.timestamp);
+        switch (record.type)
+        {
+            case RecordType::RemoveMovie:
+            case RecordType::RemoveTheater:
+                appendString(buffer, record.name);
+                break;
+            case RecordType::AddMovie:
+                appendString(buffer, record.name);
+                append(buffer, record.movieInfo.genre);
+                append(buffer, record.movieInfo.rating);
+                append(buffer, record.movieInfo.format);
+                append(buffer, record.movieInfo.durationMinutes);
+                appendString(buffer, record.movieInfo.language);
+                break;
+            case RecordType::AddTheater:
+                appendString(buffer, record.name);
+                append(buffer, static_cast<uint8_t>(record.location.has_value()));
+                if (record.location) {
+                    append(buffer, record.location->latitude);
+                    append(buffer, record.location->longitude);
+                }
+                break;
+            case RecordType::ScheduleMovie:
+                appendString(buffer, record.name);
+                appendString(buffer, record.theaterName);
+                append(buffer, record.premiereId);
+                break;
+            case RecordType::UnscheduleMovie:
+                appendString(buffer, record.name);
+                appendString(buffer, record.theaterName);
+                break;
+            case RecordType::SeatsState:
+                append(buffer, record.premiereId);
+                append(buffer, record.seatsBooked);
+                break;
+            case RecordType::Heartbeat:
+                break;
+        }
+        const auto size = static_cast<uint32_t>(buffer.size() - sizeOffset - sizeof(uint32_t));
+        std::memcpy(buffer.data() + sizeOffset, &size, sizeof(size));
+    }
+
+    std::optional<Record> decode(std::string_view frame)
+    {
+        FrameReader reader { frame };
+        Record record;
+        record.type = reader.read<RecordType>();
+        record.lsn = reader.read<uint64_t>();
+        record.timestamp = reader.read<int64_t>();
+        switch (record.type)
+        {
+            case RecordType::RemoveMovie:
+            case RecordType::RemoveTheater:
+                record.name = reader.readString();
+                break;
+            case RecordType::AddMovie:
+                record.name = reader.readString();
+                record.movieInfo.genre = reader.read<Booking::Genre>();
+                record.movieInfo.rating = reader.read<Booking::Rating>();
+                record.movieInfo.format = reader.read<Booking::Format>();
+                record.movieInfo.durationMinutes = reader.read<uint16_t>();
+                record.movieInfo.language = reader.readString();
+                if (record.movieInfo.genre > Booking::Genre::Thriller ||
+                    record.movieInfo.rating > Booking::Rating::NC17 || record.movieInfo.format > Booking::Format::IMAX)
+                    return std::nullopt;
+                break;
+            case RecordType::AddTheater:
+                record.name = reader.readString();
+                if (0 != reader.read<uint8_t>()) {
+                    const auto latitude = reader.read<double>();
+                    record.location = DB::GeoPoint { latitude, reader.read<double>() };
+                }
+                break;
+            case RecordType::ScheduleMovie:
+                record.name = reader.readString();
+                record.theaterName = reader.readString();
+                record.premiereId = reader.read<uint32_t>();
+                break;
+            case RecordType::UnscheduleMovie:
+                record.name = reader.readString();
+                record.theaterName = reader.readString();
+                break;
+            case RecordType::SeatsState:
+                record.premiereId = reader.read<uint32_t>();
+                record.seatsBooked = reader.read<uint32_t>();
+                break;
+            case RecordType::Heartbeat:
+                break;
+            default:
+                return std::nullopt;
+        }
+        return reader.isValid() ? std::make_optional(std::move(record)) : std::nullopt;
+    }
+
+    int listenSocket(const std::string& path)
+    {
+        const int socketFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socketFd < 0)
+            return -1;
+
+        ::unlink(path.c_str());
+        const sockaddr_un address = socketAddress(path);
+        if (0 != ::bind(socketFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) ||
+            0 != ::listen(socketFd, SOMAXCONN)) {
+            ::close(socketFd);
+            return -1;
+        }
+        return socketFd;
+    }
+
+    int connectSocket(const std::string& path)
+    {
+        const int socketFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socketFd < 0)
+            return -1;
+
+        const sockaddr_un address = socketAddress(path);
+        if (0 != ::connect(socketFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address))) {
+            ::close(socketFd);
+            return -1;
+        }
+        return socketFd;
+    }
+}
+
+namespace Replication
+{
+    Primary::Primary(Booking::BookingService& service, Clock::duration heartbeatInterval):
+            service { service }, heartbeatInterval { heartbeatInterval }
+    {
+        const int64_t now = nanoseconds(Clock::now());
+        for (const Booking::Movie* movie: sortedById(service.getMovies()))
+            catalogLog.push_back(movieRecord(now, movie->name, movie->info));
+        for (const Booking::Theater* theater: sortedById(service.getTheaters()))
+            catalogLog.push_back(theaterRecord(now, theater->name, theater->location));
+
+        const std::span<const size_t> theaterIds = service.bookingSchedule.getTheaterIds();
+        const std::span<const size_t> movieIds = service.bookingSchedule.getMovieIds();
+        for (size_t idx = 0; idx < movieIds.size(); ++idx)
+            if (!service.bookingSchedule.isVacant(idx))
+                catalogLog.push_back(catalogRecord(RecordType::ScheduleMovie, now,
+                                                   service.movies.findEntryByID(movieIds[idx]).value()->name,
+                                                   service.theaters.findEntryByID(theaterIds[idx]).value()->name, idx));
+    }
+
+    Primary::~Primary()
+    {
+        std::lock_guard<std::mutex> lock { mtxFollowers };
+        // The shippers may be blocked sending to the followers not reading: unblock them
+        for (std::jthread& shipper: shippers)
+            shipper.request_stop();
+        for (const int socketFd: sockets)
+            ::shutdown(socketFd, SHUT_RDWR);
+        shippers.clear();
+        for (const int socketFd: sockets)
+            ::close(socketFd);
+    }
+
+    void Primary::addMovie(const std::string& movieName, Booking::MovieInfo info)
+    {
+        std::lock_guard<std::mutex> lock { mtxCatalog };
+        service.addMovie(movieName, info);
+        catalogLog.push_back(movieRecord(nanoseconds(Clock::now()), movieName, info));
+    }
+
+    void Primary::addTheater(const std::string& theaterName, std::optional<DB::GeoPoint> location)
+    {
+        std::lock_guard<std::mutex> lock { mtxCatalog };
+        service.addTheater(theaterName, location);
+        catalogLog.push_back(theaterRecord(nanoseconds(Clock::now()), theaterName, location));
+    }
+
+    bool Primary::scheduleMovie(const std::string& movieName, const std::string& theaterName)
+    {
+        std::lock_guard<std::mutex> lock { mtxCatalog };
+        if (!service.scheduleMovie(movieName, theaterName))
+            return false;
+        catalogLog.push_back(catalogRecord(RecordType::ScheduleMovie, nanoseconds(Clock::now()), movieName,
+                                           theaterName, service.getPremiere(theaterName, movieName).value()->id));
+        return true;
+    }
+
+    bool Primary::removeMovie(const std::string& movieName)
+    {
+        std::lock_guard<std::mutex> lock { mtxCatalog };
+        if (!service.removeMovie(movieName))
+            return false;
+        catalogLog.push_back(catalogRecord(RecordType::RemoveMovie, nanoseconds(Clock::now()), movieName));
+        return true;
+    }
+
+    bool Primary::removeTheater(const std::string& theaterName)
+    {
+        std::lock_guard<std::mutex> lock { mtxCatalog };
+        if (!service.removeTheater(theaterName))
+            return false;
+        catalogLog.push_back(catalogRecord(RecordType::RemoveTheater, nanoseconds(Clock::now()), theaterName));
+        return true;
+    }
+
+    bool Primary::unscheduleMovie(const std::string& movieName, const std::string& theaterName)
+    {
+        std::lock_guard<std::mutex> lock { mtxCatalog };
+        if (!service.unscheduleMovie(movieName, theaterName))
+            return false;
+        catalogLog.push_back(catalogRecord(RecordType::UnscheduleMovie, nanoseconds(Clock::now()),
+                                           movieName, theaterName));
+        return true;
+    }
+
+    void Primary::attach(int socketFd)
+    {
+        std::lock_guard<std::mutex> lock { mtxFollowers };
+        activeFollowers.fetch_add(1, std::memory_order_acq_rel);
+        sockets.push_back(socketFd);
+        shippers.emplace_back([this, socketFd](std::stop_token stopToken) {
+            ship(stopToken, socketFd);
+            activeFollowers.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+
+    void Primary::ship(std::stop_token stopToken, int socketFd)
+    {
+        // Subscribed before the state is read: no change can fall in between
+        std::optional<Booking::ChangeStream::Consumer> consumer = service.changeStream.subscribe();
+        if (!consumer)
+            return;
+
+        uint64_t lsn = 0;
+        size_t catalogSent = 0;
+        bool resync = true;
+        std::string buffer;
+        std::array<Booking::SeatChange, 256> events {};
+        std::vector<uint32_t> changed;
+        Clock::time_point lastSent = Clock::now();
+
+        const auto add = [&buffer, &lsn](Record record) {
+            record.lsn = ++lsn;
+            encode(record, buffer);
+        };
+
+        while (!stopToken.stop_requested())
+        {
+            // Stamped before the poll: every booking published before the stamp is polled and shipped with it,
+            // so the follower synced to the stamp has all of them (see Follower::waitUntilSynced())
+            const int64_t now = nanoseconds(Clock::now());
+
+            // The bookings first, the catalog next: the premiere of any booking polled is in the catalog log already
+            const Booking::ChangeStream::PollResult polled = consumer->poll(events);
+            resync = resync || 0 != polled.lost;
+            changed.clear();
+            for (size_t idx = 0; idx < polled.count; ++idx)
+                changed.push_back(events[idx].premiereId);
+            std::sort(changed.begin(), changed.end());
+            changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+
+            {
+                std::lock_guard<std::mutex> lock { mtxCatalog };
+                // The mutations logged after the stamp are not stamped later than it: the bookings made after
+                // the stamp are not polled yet
+                for (; catalogSent < catalogLog.size(); ++catalogSent) {
+                    Record record = catalogLog[catalogSent];
+                    record.timestamp = std::min(record.timestamp, now);
+                    add(std::move(record));
+                }
+
+                // The current state is sent: it already includes all the changes polled (and maybe some more)
+                const size_t premieresCount = service.bookingSchedule.size();
+                const auto addSeats = [&](uint32_t premiereId) {
+                    const Booking::Premiere& premiere = service.bookingSchedule[premiereId];
+                    add(Record { RecordType::SeatsState, 0, now, {}, {}, premiereId,
+                                 premiere.seatsBooked.load(std::memory_order_acquire), std::nullopt, {} });
+                };
+                if (resync) {
+                    for (uint32_t premiereId = 0; premiereId < premieresCount; ++premiereId)
+                        addSeats(premiereId);
+                    resync = false;
+                } else {
+                    for (const uint32_t premiereId: changed)
+                        if (premiereId < premieresCount)
+                            addSeats(premiereId);
+                }
+            }
+
+            if (buffer.empty() && Clock::now() - lastSent >= heartbeatInterval)
+                add(Record { RecordType::Heartbeat, 0, now, {}, {}, 0, 0, std::nullopt, {} });
+
+            if (!buffer.empty()) {
+                if (!writeAll(socketFd, buffer))
+                    return;
+                buffer.clear();
+                lastSent = Clock::now();
+            }
+            if (polled.count < events.size())
+                std::this_thread::sleep_for(pollInterval);
+        }
+    }
+}
+
+namespace Replication
+{
+    Follower::Follower(int socketFd, Clock::duration maxStaleness):
+            socketFd { socketFd }, maxStaleness { maxStaleness },
+            receiver { [this](std::stop_token stopToken) { receive(stopToken); } } {
+    }
+
+    Follower::~Follower()
+    {
+        receiver.request_stop();
+        ::shutdown(socketFd, SHUT_RDWR);
+        receiver.join();
+        ::close(socketFd);
+    }
+
+    void Follower::receive(std::stop_token stopToken)
+    {
+        std::string frame;
+        while (!stopToken.stop_requested())
+        {
+            uint32_t size = 0;
+            if (!readAll(socketFd, reinterpret_cast<char*>(&size), sizeof(size)))
+                break;
+            frame.resize(size);
+            if (!readAll(socketFd, frame.data(), size))
+                break;
+
+            const std::optional<Record> record = decode(frame);
+            if (!record)
+                break;
+            apply(record.value());
+        }
+
+        std::lock_guard<std::mutex> lock { mtxLag };
+        connected.store(false, std::memory_order_release);
+        applied.notify_all();
+    }
+
+    void Follower::apply(const Record& record)
+    {
+        switch (record.type)
+        {
+            case RecordType::AddMovie: {
+                std::unique_lock<std::shared_mutex> lock { mtxCatalog };
+                service.addMovie(record.name, record.movieInfo);
+                break;
+            }
+            case RecordType::AddTheater: {
+                std::unique_lock<std::shared_mutex> lock { mtxCatalog };
+                service.addTheater(record.name, record.location);
+                break;
+            }
+            case RecordType::ScheduleMovie: {
+                std::unique_lock<std::shared_mutex> lock { mtxCatalog };
+                service.scheduleMovie(record.name, record.theaterName, record.premiereId);
+                break;
+            }
+            case RecordType::RemoveMovie: {
+                std::unique_lock<std::shared_mutex> lock { mtxCatalog };
+                service.removeMovie(record.name);
+                break;
+            }
+            case RecordType::RemoveTheater: {
+                std::unique_lock<std::shared_mutex> lock { mtxCatalog };
+                service.removeTheater(record.name);
+                break;
+            }
+            case RecordType::UnscheduleMovie: {
+                std::unique_lock<std::shared_mutex> lock { mtxCatalog };
+                service.unscheduleMovie(record.name, record.theaterName);
+                break;
+            }
+            case RecordType::SeatsState: {
+                std::shared_lock<std::shared_mutex> lock { mtxCatalog };
+                if (record.premiereId >= service.bookingSchedule.size())
+                    break;
+                Booking::Premiere& premiere = service.bookingSchedule[record.premiereId];
+                std::lock_guard<std::mutex> bookingLock { premiere.mtxBooking };
+                premiere.seats.setWord(0, record.seatsBooked);
+                premiere.publishOccupancy();
+                break;
+            }
+            case RecordType::Heartbeat:
+                break;
+        }
+
+        const Clock::time_point now = Clock::now();
+        std::lock_guard<std::mutex> lock { mtxLag };
+        lastLsn.store(record.lsn, std::memory_order_release);
+        lastTimestamp.store(record.timestamp, std::memory_order_release);
+        if (RecordType::Heartbeat != record.type)
+        {
+            const Clock::duration delay = now - Clock::time_point { std::chrono::nanoseconds { record.timestamp } };
+            ++lag.count;
+            lag.total += delay;
+            lag.max = std::max(lag.max, delay);
+            lag.last = delay;
+        }
+        applied.notify_all();
+    }
+
+    Clock::duration Follower::staleness() const noexcept
+    {
+        const int64_t timestamp = lastTimestamp.load(std::memory_order_acquire);
+        if (0 == timestamp)
+            return Clock::duration::max();
+        return std::chrono::nanoseconds { nanoseconds(Clock::now()) - timestamp };
+    }
+
+    bool Follower::waitUntilSynced(Clock::time_point primaryTime, Clock::duration timeout) const
+    {
+        const int64_t target = nanoseconds(primaryTime);
+        std::unique_lock<std::mutex> lock { mtxLag };
+        return applied.wait_for(lock, timeout, [&] {
+            return lastTimestamp.load(std::memory_order_acquire) >= target ||
+                   !connected.load(std::memory_order_acquire);
+        }) && lastTimestamp.load(std::memory_order_acquire) >= target;
+    }
+
+    LagStatistics Follower::getLag() const
+    {
+        std::lock_guard<std::mutex> lock { mtxLag };
+        return lag;
+    }
+
+    std::optional<std::vector<Booking::Movie*>> Follower::getMovies() const
+    {
+        std::shared_lock<std::shared_mutex> lock { mtxCatalog };
+        if (!isFresh())
+            return std::nullopt;
+        return service.getMovies();
+    }
+
+    std::optional<std::vector<Booking::Theater*>> Follower::getTheatersByMovie(const std::string& movieName) const
+    {
+        std::shared_lock<std::shared_mutex> lock { mtxCatalog };
+        if (!isFresh())
+            return std::nullopt;
+        return service.getTheatersByMovie(movieName);
+    }
+
+    std::optional<std::vector<uint16_t>> Follower::getSeatsAvailable(const std::string& theaterName,
+                                                                     const std::string& movieName) const
+    {
+        std::shared_lock<std::shared_mutex> lock { mtxCatalog };
+        if (!isFresh())
+            return std::nullopt;
+
+        std::vector<uint16_t> seatsAvailable;
+        const std::optional<Booking::BookingService::PremierePtr> premiere =
+                service.getPremiere(theaterName, movieName);
+        if (!premiere)
+            return seatsAvailable;
+
+        // The bitmap is read without the premiere lock: the applier never waits for the readers
+        const uint32_t seatsBooked = premiere.value()->seatsBooked.load(std::memory_order_acquire);
+        for (uint16_t seatNum = 1; seatNum <= Booking::Theater::seatsCapacityMax; ++seatNum)
+            if (0 == (seatsBooked >> (seatNum - 1) & 1u))
+                seatsAvailable.push_back(seatNum);
+        return seatsAvailable;
+    }
+}
@@ -0,0 +1,286 @@
+/**
+ * @file       Replication.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Primary/follower log-shipping replication of the BookingService over the local socket
+ */
+
+#ifndef BOOKINGSERVICE_REPLICATION_H
+#define BOOKINGSERVICE_REPLICATION_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BookingService.h"
+
+//! Log-shipping replication: the primary streams the ordered mutations, the followers serve the reads
+namespace Replication
+{
+    using namespace std::chrono_literals;
+    using Clock = std::chrono::steady_clock;
+
+    enum class RecordType : uint8_t
+    {
+        AddMovie = 1,
+        AddTheater,
+        ScheduleMovie,
+        /** The current booked seats of the premiere: idempotent, so re-sending it is always safe **/
+        SeatsState,
+        /** Nothing has changed up to the timestamp: keeps the follower staleness bounded when idle **/
+        Heartbeat,
+        RemoveMovie,
+        RemoveTheater,
+        UnscheduleMovie
+    };
+
+    /**
+     * @brief The replication log record.<br>
+     * The wire format: uint32_t size of the rest of the frame, then the type, the LSN, the timestamp and the
+     * type specific payload (the names prefixed with uint16_t length and/or the premiere ID and the seats bitmap,
+     * the Theater location flag followed by its coordinates, if any, the Movie metadata)
+     */
+    struct Record
+    {
+        RecordType type { RecordType::Heartbeat };
+
+        /** Log sequence number: consecutive within the stream sent to a follower **/
+        uint64_t lsn { 0 };
+
+        /** Clock (CLOCK_MONOTONIC - common to all processes of the host) nanoseconds of the mutation: all the
+         *  mutations of the primary up to that time are shipped not later than the record **/
+        int64_t timestamp { 0 };
+
+        /** The Movie (AddMovie, RemoveMovie, ScheduleMovie, UnscheduleMovie) or the Theater (AddTheater,
+         *  RemoveTheater) name **/
+        std::string name;
+
+        /** The Theater name (ScheduleMovie, UnscheduleMovie) **/
+        std::string theaterName;
+
+        /** The premiere index in the schedule (ScheduleMovie, SeatsState) and its booked seats bitmap (SeatsState).
+         *  The follower places the premieres into the same slots: the slots of the unscheduled ones are reused **/
+        uint32_t premiereId { 0 };
+        uint32_t seatsBooked { 0 };
+
+        /** The Theater location (AddTheater) **/
+        std::optional<DB::GeoPoint> location { std::nullopt };
+
+        /** The Movie metadata (AddMovie) **/
+        Booking::MovieInfo movieInfo {};
+    };
+
+    /**
+     * Appends the encoded frame of the record to the buffer
+     */
+    void encode(const Record& record, std::string& buffer);
+
+    /**
+     * Decodes the frame body (the frame without its size prefix)
+     * @return std::nullopt if the frame is malformed
+     */
+    [[nodiscard]]
+    std::optional<Record> decode(std::string_view frame);
+
+    /**
+     * Creates the Unix domain socket listening at the path
+     * @return the socket descriptor or -1 in case of error
+     */
+    [[nodiscard]]
+    int listenSocket(const std::string& path);
+
+    /**
+     * Connects to the Unix domain socket listening at the path
+     * @return the socket descriptor or -1 in case of error
+     */
+    [[nodiscard]]
+    int connectSocket(const std::string& path);
+
+    /**
+     * @brief The primary: applies the catalog mutations to the service and ships the log to the attached followers.
+     * <br> The bookings are taken from the service ChangeStream (see BookingService::changeStream), so the booking
+     * path itself is not affected. The catalog changes shall go through the Primary, to be replicated
+     */
+    class Primary
+    {
+    public:
+
+        /**
+         * Constructor: the current catalog of the service becomes the beginning of the log
+         * @param heartbeatInterval the follower staleness is refreshed at least that often, when there are no changes
+         */
+        explicit Primary(Booking::BookingService& service, Clock::duration heartbeatInterval = 10ms);
+
+        Primary(const Primary&) = delete;
+        Primary& operator=(const Primary&) = delete;
+
+        ~Primary();
+
+        void addMovie(const std::string& movieName, Booking::MovieInfo info = {});
+
+        void addTheater(const std::string& theaterName, std::optional<DB::GeoPoint> location = std::nullopt);
+
+        bool scheduleMovie(const std::string& movieName, const std::string& theaterName);
+
+        bool removeMovie(const std::string& movieName);
+
+        bool removeTheater(const std::string& theaterName);
+
+        bool unscheduleMovie(const std::string& movieName, const std::string& theaterName);
+
+        /**
+         * Starts shipping to the follower connected via the socket: the whole state first, then the changes
+         * @param socketFd the connected socket: owned by the Primary from now on
+         * @note Thread-safe: the followers may attach concurrently, while the others are being shipped to
+         */
+        void attach(int socketFd);
+
+        /**
+         * Returns the number of the followers being shipped to (the disconnected ones are not counted)
+         */
+        [[nodiscard]]
+        size_t followersCount() const noexcept {
+            return activeFollowers.load(std::memory_order_acquire);
+        }
+
+    private:
+
+        /** Sends the log to the single follower until it disconnects or the primary stops **/
+        void ship(std::stop_token stopToken, int socketFd);
+
+        Booking::BookingService& service;
+        const Clock::duration heartbeatInterval;
+
+        /** The catalog mutations in order (the bookings are not logged: they are read from the ChangeStream) **/
+        std::mutex mtxCatalog;
+        std::vector<Record> catalogLog;
+
+        std::atomic<size_t> activeFollowers { 0 };
+        /** Guards the followers sockets and their shippers: the attachments are concurrent with each other **/
+        std::mutex mtxFollowers;
+
+        /** The followers sockets: closed by the destructor only, after the shippers stop **/
+        std::vector<int> sockets;
+        std::vector<std::jthread> shippers;
+    };
+
+    /** Replication lag: from the mutation on the primary till it is applied by the follower **/
+    struct LagStatistics
+    {
+        uint64_t count { 0 };
+        Clock::duration total {};
+        Clock::duration max {};
+        Clock::duration last {};
+
+        [[nodiscard]]
+        Clock::duration mean() const noexcept {
+            return 0 == count ? Clock::duration {} : total / static_cast<Clock::rep>(count);
+        }
+    };
+
+    /**
+     * @brief The follower: applies the log received from the primary to its own BookingService and serves the
+     * read-only queries, as long as its state is not staler than the configured bound
+     */
+    class Follower
+    {
+    public:
+
+        /**
+         * Constructor: starts applying the log
+         * @param socketFd the socket connected to the primary: owned by the Follower
+         * @param maxStaleness the queries are not served, if the last record applied is older
+         */
+        explicit Follower(int socketFd, Clock::duration maxStaleness = 100ms);
+
+        Follower(const Follower&) = delete;
+        Follower& operator=(const Follower&) = delete;
+
+        ~Follower();
+
+        /**
+         * @return all the movies or std::nullopt if the replica is too stale
+         * @note The entries returned may be removed by the replication: they stay valid while the caller is inside
+         * of the Concurrency::EpochDomain::Guard
+         */
+        [[nodiscard]]
+        std::optional<std::vector<Booking::Movie*>> getMovies() const;
+
+        /**
+         * @return the theaters showing the movie or std::nullopt if the replica is too stale
+         */
+        [[nodiscard]]
+        std::optional<std::vector<Booking::Theater*>> getTheatersByMovie(const std::string& movieName) const;
+
+        /**
+         * @return the seats available for booking or std::nullopt if the replica is too stale
+         */
+        [[nodiscard]]
+        std::optional<std::vector<uint16_t>> getSeatsAvailable(const std::string& theaterName,
+                                                               const std::string& movieName) const;
+
+        /**
+         * Waits until the follower applies the log up to the specified primary time (read-your-writes)
+         * @return False on timeout
+         */
+        bool waitUntilSynced(Clock::time_point primaryTime, Clock::duration timeout) const;
+
+        /**
+         * Returns the age of the follower state: the time since the primary sent the last record applied
+         */
+        [[nodiscard]]
+        Clock::duration staleness() const noexcept;
+
+        [[nodiscard]]
+        uint64_t appliedLsn() const noexcept {
+            return lastLsn.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]]
+        bool isConnected() const noexcept {
+            return connected.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]]
+        LagStatistics getLag() const;
+
+    private:
+
+        void receive(std::stop_token stopToken);
+
+        void apply(const Record& record);
+
+        [[nodiscard]]
+        bool isFresh() const noexcept {
+            return staleness() <= maxStaleness;
+        }
+
+        Booking::BookingService service;
+        const int socketFd;
+        const Clock::duration maxStaleness;
+
+        /** The catalog additions are exclusive, the queries are shared **/
+        mutable std::shared_mutex mtxCatalog;
+
+        std::atomic<uint64_t> lastLsn { 0 };
+        std::atomic<int64_t> lastTimestamp { 0 };
+        std::atomic<bool> connected { true };
+
+        mutable std::mutex mtxLag;
+        mutable std::condition_variable applied;
+        LagStatistics lag;
+
+        std::jthread receiver;
+    };
+}
+
+#endif //BOOKINGSERVICE_REPLICATION_H
@@ -0,0 +1,62 @@
+/**
+ * @file       ResponseCache.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Pre-rendered responses of the catalog listing commands, cached per catalog version
+ */
+
+#include "ResponseCache.h"
+
+#include <mutex>
+
+namespace CLI
+{
+    ResponseCache::ResponseCache(size_t entriesMax): entriesMax { entriesMax } {
+    }
+
+    ResponseCache::Response ResponseCache::find(Listing listing, std::string_view params, uint64_t version) const
+    {
+        const std::shared_lock lock { mtxResponses };
+        if (this->version != version)
+            return nullptr;
+
+        const Responses& listingResponses = responses[static_cast<size_t>(listing)];
+        if (const auto iter = listingResponses.find(params); listingResponses.end() != iter)
+            return iter->second;
+        return nullptr;
+    }
+
+    ResponseCache::Response ResponseCache::store(Listing listing,
+                                                 std::string_view params,
+                                                 uint64_t version,
+                                                 std::string response)
+    {
+        Response rendered = std::make_shared<const std::string>(std::move(response));
+
+        const std::lock_guard lock { mtxResponses };
+        if (version < this->version)
+            return rendered;
+        if (version > this->version) {
+            for (Responses& listingResponses: responses)
+                listingResponses.clear();
+            entriesCount = 0;
+            this->version = version;
+        }
+        if (entriesCount >= entriesMax)
+            return rendered;
+
+        // Rendered concurrently by another session: the first one is kept
+        const auto [iter, inserted] = responses[static_cast<size_t>(listing)].try_emplace(std::string { params },
+                                                                                          std::move(rendered));
+        entriesCount += inserted ? 1 : 0;
+        return iter->second;
+    }
+
+    size_t ResponseCache::size() const
+    {
+        const std::shared_lock lock { mtxResponses };
+        return entriesCount;
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file       ResponseCache.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Pre-rendered responses of the catalog listing commands, cached per catalog version
+ */
+
+#ifndef BOOKINGSERVICE_RESPONSECACHE_H
+#define BOOKINGSERVICE_RESPONSECACHE_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace CLI
+{
+    /**
+     * @brief The rendered (serialized) responses of the catalog listings: the listing is rendered once per catalog
+     * version (see Booking::BookingService::getCatalogVersion()) and then served as a single buffer write.<br>
+     * The responses of the older versions are never served: the first response of the newer version drops them all.
+     * The cache may be shared by the sessions: the lookups take the shared lock only
+     */
+    class ResponseCache
+    {
+    public:
+
+        /** The listing commands cached **/
+        enum class Listing : uint8_t
+        {
+            Theaters,
+            Movies,
+            PlayingMovies,
+            TheatersByMovie
+        };
+
+        using Response = std::shared_ptr<const std::string>;
+
+        /**
+         * Constructor
+         * @param entriesMax the responses kept (of all the listings): the parameters of the listings are the user
+         * input, the responses beyond the limit are rendered on each request and not cached
+         */
+        explicit ResponseCache(size_t entriesMax = 256);
+
+        ResponseCache(const ResponseCache&) = delete;
+        ResponseCache& operator=(const ResponseCache&) = delete;
+
+        /**
+         * Returns the response of the listing with the parameters rendered for the catalog version
+         * @return nullptr, if not rendered yet
+         */
+        [[nodiscard]]
+        Response find(Listing listing, std::string_view params, uint64_t version) const;
+
+        /**
+         * Caches the response of the listing rendered for the catalog version
+         * @param version the catalog version read before the rendering has started: the response is at least as
+         * new as the version, so it is never served after the catalog changes
+         * @return the response cached (or the response passed, if it is outdated already or there is no room)
+         */
+        Response store(Listing listing, std::string_view params, uint64_t version, std::string response);
+
+        /**
+         * Returns the number of the responses cached
+         */
+        [[nodiscard]]
+        size_t size() const;
+
+    private:
+
+        struct StringHash
+        {
+            using is_transparent = void;
+
+            size_t operator()(std::string_view text) const noexcept {
+                return std::hash<std::string_view> {}(text);
+            }
+        };
+
+        using Responses = std::unordered_map<std::string, Response, StringHash, std::equal_to<>>;
+
+        const size_t entriesMax;
+
+        mutable std::shared_mutex mtxResponses;
+        uint64_t version { 0 };
+        size_t entriesCount { 0 };
+
+        /** The responses by the listing parameters, per listing: the lookups do not allocate **/
+        std::array<Responses, 4> responses;
+    };
+}
+
+#endif //BOOKINGSERVICE_RESPONSECACHE_H
@@ -0,0 +1,205 @@
+/**
+ * @file       RoaringBitmap.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Compressed (roaring) bitmap of the entries IDs: the sorted arrays and the bitsets by the 64K chunks
+ */
+
+#include "RoaringBitmap.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace
+{
+    constexpr size_t bitsetWords { 65536 / 64 };
+
+    constexpr uint16_t highOf(uint32_t value) noexcept {
+        return static_cast<uint16_t>(value >> 16);
+    }
+
+    constexpr uint16_t lowOf(uint32_t value) noexcept {
+        return static_cast<uint16_t>(value & 0xFFFF);
+    }
+
+    /** The first container with the key not less than the given one **/
+    template<typename Iterator>
+    Iterator findContainer(Iterator first, Iterator last, uint16_t key)
+    {
+        return std::lower_bound(first, last, key, [](const auto& container, uint16_t key) {
+            return container.key < key;
+        });
+    }
+}
+
+namespace DB
+{
+    bool RoaringBitmap::Container::contains(uint16_t low) const noexcept
+    {
+        if (isBitset())
+            return 0 != (words[low / 64] & (uint64_t { 1 } << (low % 64)));
+        return std::binary_search(values.begin(), values.end(), low);
+    }
+
+    void RoaringBitmap::Container::toBitset()
+    {
+        words.assign(bitsetWords, 0);
+        for (const uint16_t low: values)
+            words[low / 64] |= uint64_t { 1 } << (low % 64);
+        std::vector<uint16_t>().swap(values);
+    }
+
+    void RoaringBitmap::Container::toArray()
+    {
+        values.clear();
+        values.reserve(cardinality);
+        for (size_t wordIdx = 0; wordIdx < words.size(); ++wordIdx)
+            for (uint64_t word = words[wordIdx]; 0 != word; word &= word - 1)
+                values.push_back(static_cast<uint16_t>(wordIdx * 64 + std::countr_zero(word)));
+        std::vector<uint64_t>().swap(words);
+    }
+
+    bool RoaringBitmap::add(uint32_t value)
+    {
+        auto container = findContainer(containers.begin(), containers.end(), highOf(value));
+        if (containers.end() == container || container->key != highOf(value))
+            container = containers.insert(container, Container { highOf(value), 0, {}, {} });
+
+        const uint16_t low = lowOf(value);
+        if (container->isBitset()) {
+            uint64_t& word = container->words[low / 64];
+            const uint64_t bit = uint64_t { 1 } << (low % 64);
+            if (0 != (word & bit))
+                return false;
+            word |= bit;
+        } else {
+            const auto position = std::lower_bound(container->values.begin(), container->values.end(), low);
+            if (container->values.end() != position && *position == low)
+                return false;
+            container->values.insert(position, low);
+            if (container->values.size() > arrayCardinalityMax)
+                container->toBitset();
+        }
+        ++container->cardinality;
+        return true;
+    }
+
+    bool RoaringBitmap::remove(uint32_t value)
+    {
+        const auto container = findContainer(containers.begin(), containers.end(), highOf(value));
+        if (containers.end() == container || container->key != highOf(value))
+            return false;
+
+        const uint16_t low = lowOf(value);
+        if (container->isBitset()) {
+            uint64_t& word = container->words[low / 64];
+            const uint64_t bit = uint64_t { 1 } << (low % 64);
+            if (0 == (word & bit))
+                return false;
+            word &= ~bit;
+        } else {
+            const auto position = std::lower_bound(container->values.begin(), container->values.end(), low);
+            if (container->values.end() == position || *position != low)
+                return false;
+            container->values.erase(position);
+        }
+
+        if (0 == --container->cardinality)
+            containers.erase(container);
+        else if (container->isBitset() && container->cardinality <= arrayCardinalityMax)
+            container->toArray();
+        return true;
+    }
+
+    bool RoaringBitmap::contains(uint32_t value) const noexcept
+    {
+        const auto container = findContainer(containers.begin(), containers.end(), highOf(value));
+        return containers.end() != container && container->key == highOf(value) && container->contains(lowOf(value));
+    }
+
+    size_t RoaringBitmap::cardinality() const noexcept
+    {
+        size_t total = 0;
+        for (const Container& container: containers)
+            total += container.cardinality;
+        return total;
+    }
+
+    size_t RoaringBitmap::memoryUsage() const noexcept
+    {
+        size_t bytes = containers.capacity() * sizeof(Container);
+        for (const Container& container: containers)
+            bytes += container.values.capacity() * sizeof(uint16_t) + container.words.capacity() * sizeof(uint64_t);
+        return bytes;
+    }
+
+    RoaringBitmap::Container RoaringBitmap::intersect(const Container& left, const Container& right)
+    {
+        Container result { left.key, 0, {}, {} };
+        if (left.isBitset() && right.isBitset())
+        {
+            result.words.resize(bitsetWords);
+            for (size_t wordIdx = 0; wordIdx < bitsetWords; ++wordIdx) {
+                result.words[wordIdx] = left.words[wordIdx] & right.words[wordIdx];
+                result.cardinality += std::popcount(result.words[wordIdx]);
+            }
+            if (result.cardinality <= arrayCardinalityMax)
+                result.toArray();
+        }
+        else if (left.isBitset() || right.isBitset())
+        {
+            // The array values probed against the bitset
+            const Container& array = left.isBitset() ? right : left;
+            const Container& bitset = left.isBitset() ? left : right;
+            result.values.reserve(array.values.size());
+            for (const uint16_t low: array.values)
+                if (bitset.contains(low))
+                    result.values.push_back(low);
+        }
+        else
+        {
+            result.values.reserve(std::min(left.values.size(), right.values.size()));
+            std::set_intersection(left.values.begin(), left.values.end(), right.values.begin(), right.values.end(),
+                                  std::back_inserter(result.values));
+        }
+        if (!result.isBitset())
+            result.cardinality = static_cast<uint32_t>(result.values.size());
+        return result;
+    }
+
+    RoaringBitmap& RoaringBitmap::operator&=(const RoaringBitmap& other)
+    {
+        std::vector<Container> intersection;
+        auto otherContainer = other.containers.begin();
+        for (const Container& container: containers)
+        {
+            otherContainer = findContainer(otherContainer, other.containers.end(), container.key);
+            if (other.containers.end() == otherContainer)
+                break;
+            if (otherContainer->key != container.key)
+                continue;
+            if (Container common = intersect(container, *otherContainer); 0 != common.cardinality)
+                intersection.push_back(std::move(common));
+        }
+        containers = std::move(intersection);
+        return *this;
+    }
+
+    RoaringBitmap RoaringBitmap::intersect(std::span<const RoaringBitmap* const> bitmaps)
+    {
+        if (bitmaps.empty())
+            return RoaringBitmap {};
+
+        std::vector<const RoaringBitmap*> ordered { bitmaps.begin(), bitmaps.end() };
+        std::sort(ordered.begin(), ordered.end(), [](const RoaringBitmap* left, const RoaringBitmap* right) {
+            return left->cardinality() < right->cardinality();
+        });
+
+        RoaringBitmap result = *ordered.front();
+        for (auto bitmap = ordered.begin() + 1; bitmap != ordered.end() && !result.empty(); ++bitmap)
+            result &= **bitmap;
+        return result;
+    }
+}
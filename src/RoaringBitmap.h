@@ -0,0 +1,129 @@
+/**
+ * @file       RoaringBitmap.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Compressed (roaring) bitmap of the entries IDs: the sorted arrays and the bitsets by the 64K chunks
+ */
+
+#ifndef BOOKINGSERVICE_ROARINGBITMAP_H
+#define BOOKINGSERVICE_ROARINGBITMAP_H
+
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace DB
+{
+    /**
+     * @brief The set of the 32-bit IDs, compressed the roaring way.<br>
+     * The IDs are split into the chunks by their upper 16 bits. The sparse chunk is the sorted array of the lower
+     * 16 bits (2 bytes per ID), the dense one (more than arrayCardinalityMax IDs) - the bitset of 8 KB, so neither
+     * the sparse nor the dense sets waste the memory. The intersection only visits the chunks present in both sets
+     * and picks the algorithm by the containers kinds: the merge of the arrays, the bitset probes or the word ANDs
+     * @note Not synchronized: like the DB::Table, modifications shall not run concurrently with the reads
+     */
+    class RoaringBitmap
+    {
+    public:
+
+        /** The array container with more IDs is turned into the bitset (the same 8 KB) **/
+        static constexpr size_t arrayCardinalityMax { 4096 };
+
+        /**
+         * Adds the ID
+         * @return False if the ID is present already
+         */
+        bool add(uint32_t value);
+
+        /**
+         * Removes the ID
+         * @return False if there is no such ID
+         */
+        bool remove(uint32_t value);
+
+        [[nodiscard]]
+        bool contains(uint32_t value) const noexcept;
+
+        /**
+         * Returns the number of the IDs
+         */
+        [[nodiscard]]
+        size_t cardinality() const noexcept;
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return containers.empty();
+        }
+
+        /**
+         * Keeps the IDs present in the other bitmap as well
+         */
+        RoaringBitmap& operator&=(const RoaringBitmap& other);
+
+        /**
+         * Returns the intersection of the bitmaps: starts from the smallest one, so the result never grows
+         * and the empty intermediate result stops the evaluation
+         */
+        [[nodiscard]]
+        static RoaringBitmap intersect(std::span<const RoaringBitmap* const> bitmaps);
+
+        /**
+         * Calls the callback for the each ID in the ascending order
+         */
+        template<typename Callback>
+        void forEach(Callback&& callback) const
+        {
+            for (const Container& container: containers)
+            {
+                const uint32_t high = static_cast<uint32_t>(container.key) << 16;
+                if (!container.isBitset()) {
+                    for (const uint16_t low: container.values)
+                        callback(high | low);
+                    continue;
+                }
+                for (size_t wordIdx = 0; wordIdx < container.words.size(); ++wordIdx)
+                    for (uint64_t word = container.words[wordIdx]; 0 != word; word &= word - 1)
+                        callback(high | static_cast<uint32_t>(wordIdx * 64 + std::countr_zero(word)));
+            }
+        }
+
+        /**
+         * Returns the memory occupied by the containers in bytes
+         */
+        [[nodiscard]]
+        size_t memoryUsage() const noexcept;
+
+    private:
+
+        /** The IDs of the 64K chunk: either the sorted array (values) or the bitset (words) **/
+        struct Container
+        {
+            uint16_t key { 0 };
+            uint32_t cardinality { 0 };
+            std::vector<uint16_t> values;
+            std::vector<uint64_t> words;
+
+            [[nodiscard]]
+            bool isBitset() const noexcept {
+                return !words.empty();
+            }
+
+            [[nodiscard]]
+            bool contains(uint16_t low) const noexcept;
+
+            void toBitset();
+            void toArray();
+        };
+
+        /** Sorted by the key **/
+        std::vector<Container> containers;
+
+        [[nodiscard]]
+        static Container intersect(const Container& left, const Container& right);
+    };
+}
+
+#endif //BOOKINGSERVICE_ROARINGBITMAP_H
@@ -0,0 +1,295 @@
+/**
+ * @file       SearchIndex.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Prefix and fuzzy (typo-tolerant) search over the Table entries names
+ */
+
+#include "SearchIndex.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace
+{
+    /** Prefix search looks through at most (limit * prefixScanFactor) keys of the matching range **/
+    constexpr size_t prefixScanFactor { 16 };
+
+    /** Fuzzy matches with the lower similarity are considered as noise **/
+    constexpr float fuzzyScoreMin { 0.3f };
+
+    /** Maximum number of the postings scanned to collect the fuzzy candidates: the rest are verified only **/
+    constexpr size_t fuzzyScanBudget { 8'192 };
+
+    /** Number of the best fuzzy candidates (by the selective trigrams) re-scored exactly **/
+    constexpr size_t fuzzyCandidatesMax { 256 };
+
+    /** Prefix matches go before any fuzzy match in the combined search **/
+    constexpr float prefixScoreBase { 1.0f };
+
+    template<typename Matches>
+    void sortByScore(Matches& matches, size_t limit)
+    {
+        const auto middle = matches.begin() + static_cast<std::ptrdiff_t>(std::min(limit, matches.size()));
+        std::partial_sort(matches.begin(), middle, matches.end(), [](const auto& left, const auto& right) {
+            return left.score > right.score || (left.score == right.score && left.id < right.id);
+        });
+        matches.erase(middle, matches.end());
+    }
+}
+
+namespace DB
+{
+    std::string SearchIndex::normalize(std::string_view text)
+    {
+        std::string normalized;
+        normalized.reserve(text.size());
+        for (const char symbol: text)
+        {
+            const auto code = static_cast<unsigned char>(symbol);
+            if (std::isalnum(code)) {
+                normalized.push_back(static_cast<char>(std::tolower(code)));
+            } else if (!normalized.empty() && ' ' != normalized.back()) {
+                normalized.push_back(' ');
+            }
+        }
+        if (!normalized.empty() && ' ' == normalized.back())
+            normalized.pop_back();
+        return normalized;
+    }
+
+    std::vector<uint32_t> SearchIndex::extractTrigrams(std::string_view normalized)
+    {
+        // Pad with spaces: the word boundaries become a part of the trigrams
+        std::string padded;
+        padded.reserve(normalized.size() + 2);
+        padded.append(" ").append(normalized).append(" ");
+
+        std::vector<uint32_t> result;
+        for (size_t idx = 0; idx + 3 <= padded.size(); ++idx) {
+            result.push_back(static_cast<uint32_t>(static_cast<unsigned char>(padded[idx])) << 16 |
+                             static_cast<uint32_t>(static_cast<unsigned char>(padded[idx + 1])) << 8 |
+                             static_cast<uint32_t>(static_cast<unsigned char>(padded[idx + 2])));
+        }
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    }
+
+    void SearchIndex::add(std::string_view name, size_t id)
+    {
+        const std::string normalized = normalize(name);
+        entries.push_back(Entry {
+            static_cast<uint32_t>(arena.size()),
+            static_cast<uint32_t>(normalized.size()),
+            id,
+            static_cast<uint32_t>(extractTrigrams(normalized).size())
+        });
+        arena.append(normalized);
+        built.store(false, std::memory_order_release);
+    }
+
+    void SearchIndex::remove(size_t id)
+    {
+        if (removedId == id)
+            return;
+        const auto iter = std::find_if(entries.begin(), entries.end(), [id](const Entry& entry) {
+            return entry.id == id;
+        });
+        if (entries.end() == iter)
+            return;
+
+        iter->id = removedId;
+        if (++removedCount * 2 > entries.size())
+            compact();
+    }
+
+    void SearchIndex::compact()
+    {
+        std::string compacted;
+        std::vector<Entry> alive;
+        alive.reserve(entries.size() - removedCount);
+        for (Entry entry: entries) {
+            if (removedId == entry.id)
+                continue;
+            const std::string_view name = text(entry);
+            entry.offset = static_cast<uint32_t>(compacted.size());
+            compacted.append(name);
+            alive.push_back(entry);
+        }
+
+        arena = std::move(compacted);
+        entries = std::move(alive);
+        removedCount = 0;
+        keys.clear();
+        trigrams.clear();
+        indexedCount = 0;
+        built.store(false, std::memory_order_release);
+    }
+
+    void SearchIndex::ensureBuilt() const
+    {
+        if (built.load(std::memory_order_acquire))
+            return;
+
+        std::lock_guard<std::mutex> lock { mtxBuild };
+        if (built.load(std::memory_order_relaxed))
+            return;
+
+        // Only the entries added since the last build are indexed: the new keys are sorted and merged in
+        const auto keysIndexed = static_cast<std::ptrdiff_t>(keys.size());
+        for (size_t entryIdx = indexedCount; entryIdx < entries.size(); ++entryIdx)
+        {
+            const Entry& entry = entries[entryIdx];
+            const std::string_view name = text(entry);
+            for (size_t pos = 0; pos < name.size(); ++pos)
+                if (0 == pos || ' ' == name[pos - 1])
+                    keys.push_back(Key { static_cast<uint32_t>(entry.offset + pos), static_cast<uint32_t>(entryIdx) });
+
+            for (const uint32_t trigram: extractTrigrams(name))
+                trigrams[trigram].push_back(static_cast<uint32_t>(entryIdx));
+        }
+
+        const auto byText = [this](const Key& left, const Key& right) {
+            return keyText(left) < keyText(right);
+        };
+        std::sort(keys.begin() + keysIndexed, keys.end(), byText);
+        std::inplace_merge(keys.begin(), keys.begin() + keysIndexed, keys.end(), byText);
+
+        indexedCount = entries.size();
+        built.store(true, std::memory_order_release);
+    }
+
+    std::vector<SearchIndex::Match> SearchIndex::searchPrefix(std::string_view prefix, size_t limit) const
+    {
+        const std::string normalized = normalize(prefix);
+        if (normalized.empty() || 0 == limit)
+            return {};
+        ensureBuilt();
+
+        const auto first = std::lower_bound(keys.cbegin(), keys.cend(), normalized,
+                                            [this](const Key& key, const std::string& value) {
+            return keyText(key) < value;
+        });
+
+        std::vector<Match> matches;
+        std::vector<uint32_t> seen;
+        const size_t scanMax = limit * prefixScanFactor;
+        for (auto iter = first; iter != keys.cend() && seen.size() < scanMax; ++iter)
+        {
+            if (!keyText(*iter).starts_with(normalized))
+                break;
+            if (seen.cend() != std::find(seen.cbegin(), seen.cend(), iter->entryIdx))
+                continue;
+            seen.push_back(iter->entryIdx);
+
+            // The shorter the name, the closer it is to the query. Matching from the name start is better
+            const Entry& entry = entries[iter->entryIdx];
+            if (removedId == entry.id)
+                continue;
+            const float closeness = static_cast<float>(normalized.size()) / static_cast<float>(entry.length);
+            const float atStart = iter->offset == entry.offset ? 0.5f : 0.0f;
+            matches.push_back(Match { entry.id, prefixScoreBase + closeness + atStart });
+        }
+
+        sortByScore(matches, limit);
+        return matches;
+    }
+
+    std::vector<SearchIndex::Match> SearchIndex::searchFuzzy(std::string_view query, size_t limit) const
+    {
+        const std::string normalized = normalize(query);
+        if (normalized.empty() || 0 == limit)
+            return {};
+        ensureBuilt();
+
+        const std::vector<uint32_t> queryTrigrams = extractTrigrams(normalized);
+        std::vector<const std::vector<uint32_t>*> postings;
+        for (const uint32_t trigram: queryTrigrams)
+            if (const auto iter = trigrams.find(trigram); trigrams.end() != iter)
+                postings.push_back(&iter->second);
+        if (postings.empty())
+            return {};
+
+        // The rare trigrams are the most selective ones: process them first
+        std::sort(postings.begin(), postings.end(), [](const auto* left, const auto* right) {
+            return left->size() < right->size();
+        });
+
+        // Candidates are collected from the selective trigrams only ...
+        std::unordered_map<uint32_t, uint32_t> shared;
+        shared.reserve(fuzzyScanBudget);
+        size_t scanned = 0;
+        for (const std::vector<uint32_t>* posting: postings)
+        {
+            if (!shared.empty() && scanned + posting->size() > fuzzyScanBudget)
+                break;
+            const size_t scanMax = std::min(posting->size(), fuzzyScanBudget);
+            for (size_t idx = 0; idx < scanMax; ++idx)
+                ++shared[(*posting)[idx]];
+            scanned += scanMax;
+        }
+
+        std::vector<std::pair<uint32_t, uint32_t>> candidates(shared.cbegin(), shared.cend());
+        if (candidates.size() > fuzzyCandidatesMax) {
+            std::nth_element(candidates.begin(), candidates.begin() + fuzzyCandidatesMax, candidates.end(),
+                             [](const auto& left, const auto& right) { return left.second > right.second; });
+            candidates.resize(fuzzyCandidatesMax);
+        }
+
+        // ... and the best of them are re-scored exactly by their own trigrams (cheaper than the long postings lookup)
+        for (auto& [entryIdx, count]: candidates)
+        {
+            const std::vector<uint32_t> entryTrigrams = extractTrigrams(text(entries[entryIdx]));
+            count = 0;
+            for (auto queryIter = queryTrigrams.cbegin(), entryIter = entryTrigrams.cbegin();
+                 queryIter != queryTrigrams.cend() && entryIter != entryTrigrams.cend(); )
+            {
+                if (*queryIter < *entryIter) {
+                    ++queryIter;
+                } else if (*entryIter < *queryIter) {
+                    ++entryIter;
+                } else {
+                    ++count, ++queryIter, ++entryIter;
+                }
+            }
+        }
+
+        std::vector<Match> matches;
+        for (const auto& [entryIdx, count]: candidates)
+        {
+            // Dice coefficient: 2 * |common| / (|query trigrams| + |name trigrams|)
+            const Entry& entry = entries[entryIdx];
+            if (removedId == entry.id)
+                continue;
+            const float score = 2.0f * static_cast<float>(count) /
+                                static_cast<float>(queryTrigrams.size() + entry.trigramsCount);
+            if (score >= fuzzyScoreMin)
+                matches.push_back(Match { entry.id, score });
+        }
+
+        sortByScore(matches, limit);
+        return matches;
+    }
+
+    std::vector<SearchIndex::Match> SearchIndex::search(std::string_view query, size_t limit) const
+    {
+        std::vector<Match> matches = searchPrefix(query, limit);
+        if (matches.size() >= limit)
+            return matches;
+
+        for (const Match& match: searchFuzzy(query, limit))
+        {
+            const bool known = std::any_of(matches.cbegin(), matches.cend(), [&match](const Match& existing) {
+                return existing.id == match.id;
+            });
+            if (!known)
+                matches.push_back(match);
+            if (matches.size() == limit)
+                break;
+        }
+        return matches;
+    }
+}
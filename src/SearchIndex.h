@@ -0,0 +1,146 @@
+/**
+ * @file       SearchIndex.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Prefix and fuzzy (typo-tolerant) search over the Table entries names
+ */
+
+#ifndef BOOKINGSERVICE_SEARCHINDEX_H
+#define BOOKINGSERVICE_SEARCHINDEX_H
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace DB
+{
+    /**
+     * @brief Full-text search index over the entries names.<br>
+     * - <b>Prefix search</b>: the sorted array of the keys (each key is the normalized name starting from one of
+     *   its words), so any word prefix query is a binary search for the contiguous range of keys - the flattened
+     *   trie, stored in two plain arrays instead of a tree of nodes
+     * - <b>Fuzzy search</b>: the trigram inverted index; candidates are ranked by the Dice coefficient over
+     *   the shared trigrams, which tolerates typos, missing and swapped letters
+     *
+     * Entries are added incrementally, the search structures are extended by the first query after the changes
+     * @note Concurrent queries are safe. Like the DB::Table itself, additions and removals shall not run
+     * concurrently with the queries: the BookingService serializes them by its catalog lock
+     */
+    class SearchIndex
+    {
+    public:
+
+        /** The search result: the entry ID and its relevance (the greater - the better) **/
+        struct Match
+        {
+            size_t id { 0 };
+            float score { 0 };
+        };
+
+        /**
+         * Adds the entry name to the index
+         * @param name the entry name
+         * @param id the entry ID
+         */
+        void add(std::string_view name, size_t id);
+
+        /**
+         * Removes the entry from the index: the removed entries are skipped by the queries and compacted away
+         * (by the next query) once they make up the half of the index
+         * @param id the entry ID
+         */
+        void remove(size_t id);
+
+        /**
+         * Returns the entries having a word starting with the query (the query may span several words)
+         * @param prefix the beginning of the name or of any word in it, case-insensitive
+         * @param limit the maximum number of the results (top-k)
+         * @return matches ordered by relevance: the shorter names and the match at the name start go first
+         */
+        [[nodiscard]]
+        std::vector<Match> searchPrefix(std::string_view prefix, size_t limit) const;
+
+        /**
+         * Returns the entries whose names are similar to the query (typo-tolerant)
+         * @param query the name to search for (possibly misspelled), case-insensitive
+         * @param limit the maximum number of the results (top-k)
+         * @return matches ordered by the similarity
+         */
+        [[nodiscard]]
+        std::vector<Match> searchFuzzy(std::string_view query, size_t limit) const;
+
+        /**
+         * Combined search: prefix matches first, filled up with the fuzzy matches
+         */
+        [[nodiscard]]
+        std::vector<Match> search(std::string_view query, size_t limit) const;
+
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return entries.size() - removedCount;
+        }
+
+        /**
+         * Normalizes the text for indexing: lower case ASCII letters and digits, words separated by single spaces
+         */
+        [[nodiscard]]
+        static std::string normalize(std::string_view text);
+
+    private:
+
+        /** The ID of the removed entries (the IDs of the Table entries start from 1) **/
+        static constexpr size_t removedId { 0 };
+
+        struct Entry
+        {
+            uint32_t offset { 0 };
+            uint32_t length { 0 };
+            size_t id { 0 };
+            uint32_t trigramsCount { 0 };
+        };
+
+        /** The key of the prefix index: the suffix of the normalized name, starting from a word start **/
+        struct Key
+        {
+            uint32_t offset { 0 };
+            uint32_t entryIdx { 0 };
+        };
+
+        void ensureBuilt() const;
+
+        /** Drops the removed entries: the index is rebuilt from scratch by the next query **/
+        void compact();
+
+        [[nodiscard]]
+        static std::vector<uint32_t> extractTrigrams(std::string_view normalized);
+
+        [[nodiscard]]
+        std::string_view text(const Entry& entry) const noexcept {
+            return std::string_view { arena }.substr(entry.offset, entry.length);
+        }
+
+        [[nodiscard]]
+        std::string_view keyText(const Key& key) const noexcept {
+            const Entry& entry = entries[key.entryIdx];
+            return std::string_view { arena }.substr(key.offset, entry.offset + entry.length - key.offset);
+        }
+
+        /** All the normalized names, stored contiguously **/
+        std::string arena;
+        std::vector<Entry> entries;
+        size_t removedCount { 0 };
+
+        mutable std::mutex mtxBuild;
+        mutable std::atomic<bool> built { true };
+        mutable size_t indexedCount { 0 };
+        mutable std::vector<Key> keys;
+        mutable std::unordered_map<uint32_t, std::vector<uint32_t>> trigrams;
+    };
+}
+
+#endif //BOOKINGSERVICE_SEARCHINDEX_H
@@ -0,0 +1,392 @@
+/**
+ * @file       SeatMap.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Seat maps specialized by the hall capacity class: a single word, fixed bitset and dynamic bitset
+ */
+
+#ifndef BOOKINGSERVICE_SEATMAP_H
+#define BOOKINGSERVICE_SEATMAP_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Booking
+{
+    /**
+     * The capacity classes of the halls: each one has its own seat map layout (see SeatMapFor)
+     */
+    enum class CapacityClass : uint8_t
+    {
+        /** Up to 64 seats: a single word, booked with a single CAS **/
+        Small,
+        /** Up to mediumCapacityMax seats: the bitset array of the fixed size **/
+        Medium,
+        /** The bitset allocated for the capacity given at runtime **/
+        Large
+    };
+
+    inline constexpr size_t smallCapacityMax { 64 };
+    inline constexpr size_t mediumCapacityMax { 1024 };
+
+    [[nodiscard]]
+    constexpr CapacityClass capacityClassOf(size_t capacity) noexcept
+    {
+        if (capacity <= smallCapacityMax)
+            return CapacityClass::Small;
+        return capacity <= mediumCapacityMax ? CapacityClass::Medium : CapacityClass::Large;
+    }
+
+    //! The bitset operations shared by the seat maps: the seat N is the bit (N - 1)
+    namespace SeatBits
+    {
+        constexpr size_t wordsFor(size_t capacity) noexcept {
+            return (capacity + 63) / 64;
+        }
+
+        constexpr uint64_t bit(uint16_t seat) noexcept {
+            return uint64_t { 1 } << ((seat - 1u) % 64);
+        }
+
+        /** The bits of the first seatsCount seats of the word **/
+        constexpr uint64_t mask(size_t seatsCount) noexcept {
+            return 64 <= seatsCount ? ~uint64_t { 0 } : (uint64_t { 1 } << seatsCount) - 1;
+        }
+
+        /**
+         * Books all the seats or none of them: rolls back the seats booked by the request, if any seat is
+         * booked already (or booked twice by the same request) or does not exist
+         */
+        inline bool book(std::span<uint64_t> words, size_t capacity, std::span<const uint16_t> seats) noexcept
+        {
+            for (size_t idx = 0; idx < seats.size(); ++idx)
+            {
+                const uint16_t seat = seats[idx];
+                if (0 == seat || seat > capacity || 0 != (words[(seat - 1u) / 64] & bit(seat))) {
+                    for (size_t rollbackIdx = 0; rollbackIdx < idx; ++rollbackIdx)
+                        words[(seats[rollbackIdx] - 1u) / 64] &= ~bit(seats[rollbackIdx]);
+                    return false;
+                }
+                words[(seat - 1u) / 64] |= bit(seat);
+            }
+            return true;
+        }
+
+        template<typename Callback>
+        void forEachAvailable(std::span<const uint64_t> words, size_t capacity, Callback&& callback)
+        {
+            for (size_t wordIdx = 0; wordIdx < words.size(); ++wordIdx)
+            {
+                const size_t seatsInWord = std::min<size_t>(64, capacity - wordIdx * 64);
+                uint64_t available = ~words[wordIdx] & mask(seatsInWord);
+                for (; 0 != available; available &= available - 1)
+                    callback(static_cast<uint16_t>(wordIdx * 64 + std::countr_zero(available) + 1));
+            }
+        }
+
+        /**
+         * Returns the first seat of the leftmost run of the seatsTogether available seats in a row, if any
+         * @param booked the bitmap of the booked seats of the word
+         * @param seatsInWord the number of the seats in the word
+         */
+        constexpr std::optional<uint16_t> firstRun(uint64_t booked, size_t seatsInWord, size_t seatsTogether) noexcept
+        {
+            if (0 == seatsTogether || seatsTogether > seatsInWord)
+                return std::nullopt;
+
+            // The bit stays set only if the seatsTogether - 1 seats after it are available as well
+            const uint64_t available = ~booked & mask(seatsInWord);
+            uint64_t runs = available;
+            for (size_t shift = 1; shift < seatsTogether && 0 != runs; ++shift)
+                runs &= available >> shift;
+            if (0 == runs)
+                return std::nullopt;
+            return static_cast<uint16_t>(std::countr_zero(runs) + 1);
+        }
+
+        inline size_t count(std::span<const uint64_t> words) noexcept
+        {
+            size_t booked = 0;
+            for (const uint64_t word: words)
+                booked += std::popcount(word);
+            return booked;
+        }
+    }
+
+    /**
+     * @brief The seat map of the small hall: all the seats in a single word.<br>
+     * The booking is lock-free (a single CAS for all the seats of the request); the version and the change
+     * publication of the Premiere still take its lock
+     * @tparam Capacity the number of the seats, fixed at compile time
+     */
+    template<size_t Capacity> requires (0 < Capacity && Capacity <= smallCapacityMax)
+    class SmallSeatMap
+    {
+        std::atomic<uint64_t> booked { 0 };
+
+        /** The bits of the seats: std::nullopt if any of them is repeated or does not exist **/
+        static std::optional<uint64_t> maskOf(std::span<const uint16_t> seats) noexcept
+        {
+            uint64_t mask = 0;
+            for (const uint16_t seat: seats) {
+                if (0 == seat || seat > Capacity || 0 != (mask & SeatBits::bit(seat)))
+                    return std::nullopt;
+                mask |= SeatBits::bit(seat);
+            }
+            return mask;
+        }
+
+    public:
+
+        static constexpr CapacityClass capacityClass { CapacityClass::Small };
+
+        /** The capacity argument only unifies the constructors of the seat maps: fixed at compile time **/
+        explicit SmallSeatMap(size_t = Capacity) noexcept {
+        }
+
+        SmallSeatMap(const SmallSeatMap& other) noexcept: booked { other.booked.load(std::memory_order_relaxed) } {
+        }
+
+        SmallSeatMap& operator=(const SmallSeatMap& other) noexcept {
+            booked.store(other.booked.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+
+        [[nodiscard]]
+        static constexpr size_t capacity() noexcept {
+            return Capacity;
+        }
+
+        /**
+         * Books all the seats or none of them: lock-free, any number of threads may book concurrently
+         * @return False if any of the seats is booked already, repeated or does not exist
+         */
+        bool book(std::span<const uint16_t> seats) noexcept
+        {
+            const std::optional<uint64_t> mask = maskOf(seats);
+            if (!mask)
+                return false;
+
+            uint64_t current = booked.load(std::memory_order_relaxed);
+            do {
+                if (0 != (current & mask.value()))
+                    return false;
+            } while (!booked.compare_exchange_weak(current, current | mask.value(),
+                                                   std::memory_order_acq_rel, std::memory_order_relaxed));
+            return true;
+        }
+
+        /**
+         * Books all the seats or none of them: a plain store instead of the CAS
+         * @note The caller shall serialize the writers (e.g. the Premiere::mtxBooking lock)
+         */
+        bool bookExclusive(std::span<const uint16_t> seats) noexcept
+        {
+            const std::optional<uint64_t> mask = maskOf(seats);
+            const uint64_t current = booked.load(std::memory_order_relaxed);
+            if (!mask || 0 != (current & mask.value()))
+                return false;
+            booked.store(current | mask.value(), std::memory_order_release);
+            return true;
+        }
+
+        void release(uint16_t seat) noexcept {
+            booked.fetch_and(~SeatBits::bit(seat), std::memory_order_acq_rel);
+        }
+
+        [[nodiscard]]
+        bool isBooked(uint16_t seat) const noexcept {
+            return 0 != (booked.load(std::memory_order_acquire) & SeatBits::bit(seat));
+        }
+
+        [[nodiscard]]
+        size_t bookedCount() const noexcept {
+            return std::popcount(booked.load(std::memory_order_acquire));
+        }
+
+        /**
+         * Returns the bitmap of the seats [64 * idx + 1, 64 * idx + 64]
+         */
+        [[nodiscard]]
+        uint64_t word([[maybe_unused]] size_t idx) const noexcept {
+            return booked.load(std::memory_order_acquire);
+        }
+
+        void setWord([[maybe_unused]] size_t idx, uint64_t bits) noexcept {
+            booked.store(bits & SeatBits::mask(Capacity), std::memory_order_release);
+        }
+
+        void reset() noexcept {
+            booked.store(0, std::memory_order_release);
+        }
+
+        template<typename Callback>
+        void forEachAvailable(Callback&& callback) const
+        {
+            const uint64_t word = booked.load(std::memory_order_acquire);
+            SeatBits::forEachAvailable(std::span<const uint64_t> { &word, 1 }, Capacity,
+                                       std::forward<Callback>(callback));
+        }
+    };
+
+    /**
+     * @brief The seat map of the medium hall: the bitset of the size fixed at compile time, no allocations
+     * @tparam Capacity the number of the seats
+     * @note Not synchronized: the Premiere modifies it under its lock
+     */
+    template<size_t Capacity> requires (0 < Capacity && Capacity <= mediumCapacityMax)
+    class FixedSeatMap
+    {
+        std::array<uint64_t, SeatBits::wordsFor(Capacity)> words {};
+
+    public:
+
+        static constexpr CapacityClass capacityClass { CapacityClass::Medium };
+
+        /** The capacity argument only unifies the constructors of the seat maps: fixed at compile time **/
+        explicit FixedSeatMap(size_t = Capacity) noexcept {
+        }
+
+        [[nodiscard]]
+        static constexpr size_t capacity() noexcept {
+            return Capacity;
+        }
+
+        bool book(std::span<const uint16_t> seats) noexcept {
+            return SeatBits::book(words, Capacity, seats);
+        }
+
+        bool bookExclusive(std::span<const uint16_t> seats) noexcept {
+            return book(seats);
+        }
+
+        void release(uint16_t seat) noexcept {
+            words[(seat - 1u) / 64] &= ~SeatBits::bit(seat);
+        }
+
+        [[nodiscard]]
+        bool isBooked(uint16_t seat) const noexcept {
+            return 0 != (words[(seat - 1u) / 64] & SeatBits::bit(seat));
+        }
+
+        [[nodiscard]]
+        size_t bookedCount() const noexcept {
+            return SeatBits::count(words);
+        }
+
+        [[nodiscard]]
+        uint64_t word(size_t idx) const noexcept {
+            return words[idx];
+        }
+
+        void setWord(size_t idx, uint64_t bits) noexcept {
+            words[idx] = bits;
+        }
+
+        void reset() noexcept {
+            words.fill(0);
+        }
+
+        template<typename Callback>
+        void forEachAvailable(Callback&& callback) const {
+            SeatBits::forEachAvailable(words, Capacity, std::forward<Callback>(callback));
+        }
+    };
+
+    /**
+     * @brief The seat map of the large hall: the bitset allocated for the capacity given at runtime
+     * @note Not synchronized: the Premiere modifies it under its lock
+     */
+    class DynamicSeatMap
+    {
+        std::vector<uint64_t> words;
+        size_t seatsCount { 0 };
+
+    public:
+
+        static constexpr CapacityClass capacityClass { CapacityClass::Large };
+
+        explicit DynamicSeatMap(size_t capacity): words(SeatBits::wordsFor(capacity), 0), seatsCount { capacity } {
+        }
+
+        [[nodiscard]]
+        size_t capacity() const noexcept {
+            return seatsCount;
+        }
+
+        bool book(std::span<const uint16_t> seats) noexcept {
+            return SeatBits::book(words, seatsCount, seats);
+        }
+
+        bool bookExclusive(std::span<const uint16_t> seats) noexcept {
+            return book(seats);
+        }
+
+        void release(uint16_t seat) noexcept {
+            words[(seat - 1u) / 64] &= ~SeatBits::bit(seat);
+        }
+
+        [[nodiscard]]
+        bool isBooked(uint16_t seat) const noexcept {
+            return 0 != (words[(seat - 1u) / 64] & SeatBits::bit(seat));
+        }
+
+        [[nodiscard]]
+        size_t bookedCount() const noexcept {
+            return SeatBits::count(words);
+        }
+
+        [[nodiscard]]
+        uint64_t word(size_t idx) const noexcept {
+            return words[idx];
+        }
+
+        void setWord(size_t idx, uint64_t bits) noexcept {
+            words[idx] = bits;
+        }
+
+        void reset() noexcept {
+            std::fill(words.begin(), words.end(), 0);
+        }
+
+        template<typename Callback>
+        void forEachAvailable(Callback&& callback) const {
+            SeatBits::forEachAvailable(words, seatsCount, std::forward<Callback>(callback));
+        }
+    };
+
+    template<size_t Capacity, CapacityClass = capacityClassOf(Capacity)>
+    struct SeatMapSelector
+    {
+        using Type = DynamicSeatMap;
+    };
+
+    template<size_t Capacity>
+    struct SeatMapSelector<Capacity, CapacityClass::Small>
+    {
+        using Type = SmallSeatMap<Capacity>;
+    };
+
+    template<size_t Capacity>
+    struct SeatMapSelector<Capacity, CapacityClass::Medium>
+    {
+        using Type = FixedSeatMap<Capacity>;
+    };
+
+    /**
+     * The seat map of the hall of the given capacity: the layout is selected at compile time, so the booking
+     * path has no runtime dispatch at all
+     */
+    template<size_t Capacity>
+    using SeatMapFor = typename SeatMapSelector<Capacity>::Type;
+}
+
+#endif //BOOKINGSERVICE_SEATMAP_H
@@ -0,0 +1,200 @@
+/**
+ * @file       ShardedBookingService.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Thread-per-core (shared-nothing) BookingService definition
+*/
+
+#include "ShardedBookingService.h"
+
+#include <pthread.h>
+
+namespace
+{
+    /** Number of the empty queue polls before the shard thread goes to sleep **/
+    constexpr size_t spinsBeforeWait { 128 };
+
+    void pinToCore(std::jthread& thread, size_t coreIdx) noexcept
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(coreIdx % std::max(1u, std::thread::hardware_concurrency()), &cpuSet);
+        // Pinning is an optimization only: just keep running wherever the OS scheduled us in case of failure
+        pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet);
+    }
+}
+
+namespace Booking
+{
+    CatalogReplica::CatalogReplica(const BookingService& service)
+    {
+        for (const Movie* movie: service.getMovies())
+            movieIds.emplace(movie->name, movie->id);
+        for (const Theater* theater: service.getTheaters())
+            theaterIds.emplace(theater->name, theater->id);
+        const std::span<const size_t> scheduledTheaterIds = service.bookingSchedule.getTheaterIds();
+        const std::span<const size_t> scheduledMovieIds = service.bookingSchedule.getMovieIds();
+        for (size_t idx = 0; idx < scheduledMovieIds.size(); ++idx)
+            if (!service.bookingSchedule.isVacant(idx))
+                premiereIndex.emplace(PremiereKey { scheduledTheaterIds[idx], scheduledMovieIds[idx] }, idx);
+    }
+
+    std::optional<size_t> CatalogReplica::findPremiere(size_t theaterId, size_t movieId) const noexcept
+    {
+        if (const auto iter = premiereIndex.find(PremiereKey { theaterId, movieId }); premiereIndex.end() != iter)
+            return iter->second;
+        return std::nullopt;
+    }
+
+    std::optional<size_t> CatalogReplica::findPremiere(const std::string& theaterName,
+                                                       const std::string& movieName) const noexcept
+    {
+        const auto theater = theaterIds.find(theaterName);
+        const auto movie = movieIds.find(movieName);
+        if (theaterIds.end() == theater || movieIds.end() == movie)
+            return std::nullopt;
+        return findPremiere(theater->second, movie->second);
+    }
+}
+
+namespace Booking
+{
+    void ShardedBookingService::Shard::post(Task task)
+    {
+        // Back-pressure: the producer waits for the shard to drain the queue
+        while (!requests.tryPush(std::move(task)))
+            std::this_thread::yield();
+        notifications.fetch_add(1, std::memory_order_release);
+        notifications.notify_one();
+    }
+
+    void ShardedBookingService::Shard::run()
+    {
+        size_t spins = 0;
+        while (!stopped)
+        {
+            if (std::optional<Task> task = requests.tryPop(); task.has_value()) {
+                (*task)();
+                spins = 0;
+                continue;
+            }
+
+            if (++spins < spinsBeforeWait)
+                continue;
+
+            const uint32_t observed = notifications.load(std::memory_order_acquire);
+            if (std::optional<Task> task = requests.tryPop(); task.has_value()) {
+                (*task)();
+                spins = 0;
+                continue;
+            }
+            notifications.wait(observed, std::memory_order_acquire);
+        }
+    }
+
+    ShardedBookingService::ShardedBookingService(const BookingService& service, size_t shardsCount):
+            catalog { service }
+    {
+        shardsCount = std::max<size_t>(1, shardsCount);
+        shards.reserve(shardsCount);
+        for (size_t shardIdx = 0; shardIdx < shardsCount; ++shardIdx)
+        {
+            Shard& shard = *shards.emplace_back(std::make_unique<Shard>());
+            shard.worker = std::jthread([&shard] { shard.run(); });
+            pinToCore(shard.worker, shardIdx);
+        }
+
+        // The premiere with global index I belongs to the shard I % N at the local position I / N
+        std::vector<std::future<void>> populated;
+        for (size_t shardIdx = 0; shardIdx < shardsCount; ++shardIdx)
+        {
+            auto promise = std::make_shared<std::promise<void>>();
+            populated.push_back(promise->get_future());
+            Shard& shard = *shards[shardIdx];
+            shard.post([this, &service, &shard, promise, shardIdx, shardsCount] {
+                for (size_t idx = shardIdx; idx < service.bookingSchedule.size(); idx += shardsCount) {
+                    const Premiere& source = service.bookingSchedule[idx];
+                    // By the IDs: the slot may be vacant, its Theater and Movie removed already
+                    Premiere& premiere = shard.premieres.emplace_back(source.theaterId, source.movieId);
+                    premiere.seats = source.seats;
+                    premiere.publishOccupancy();
+                    // Published to the sharded service stream, by the global index of the premiere
+                    premiere.id = source.id;
+                    premiere.changeStream = &changeStream;
+                    premiere.trending = &trending;
+                }
+                promise->set_value();
+            });
+        }
+        for (std::future<void>& future: populated)
+            future.wait();
+    }
+
+    ShardedBookingService::~ShardedBookingService()
+    {
+        for (std::unique_ptr<Shard>& shard: shards)
+            shard->post([&target = *shard] { target.stopped = true; });
+        // Shard::worker is std::jthread - joined in the Shard destructor
+    }
+
+    template<typename Result, typename Fn>
+    std::future<Result> ShardedBookingService::execute(std::optional<size_t> premiereIdx,
+                                                       Result fallback,
+                                                       Fn&& func)
+    {
+        std::promise<Result> promise;
+        std::future<Result> result = promise.get_future();
+        if (!premiereIdx.has_value()) {
+            promise.set_value(std::move(fallback));
+            return result;
+        }
+
+        Shard& shard = *shards[premiereIdx.value() % shards.size()];
+        const size_t localIdx = premiereIdx.value() / shards.size();
+        shard.post([&shard, localIdx, func = std::forward<Fn>(func),
+                    promise = std::make_shared<std::promise<Result>>(std::move(promise))] {
+            promise->set_value(func(shard.premieres[localIdx]));
+        });
+        return result;
+    }
+
+    std::future<bool> ShardedBookingService::bookSeats(size_t theaterId,
+                                                       size_t movieId,
+                                                       std::vector<uint16_t> seatsToBook)
+    {
+        return execute(catalog.findPremiere(theaterId, movieId), false,
+                       [seats = std::move(seatsToBook)](Premiere& premiere) {
+            return premiere.bookSeats(seats);
+        });
+    }
+
+    std::future<bool> ShardedBookingService::bookSeats(const std::string& theaterName,
+                                                       const std::string& movieName,
+                                                       std::vector<uint16_t> seatsToBook)
+    {
+        return execute(catalog.findPremiere(theaterName, movieName), false,
+                       [seats = std::move(seatsToBook)](Premiere& premiere) {
+            return premiere.bookSeats(seats);
+        });
+    }
+
+    std::future<std::vector<uint16_t>> ShardedBookingService::getSeatsAvailable(size_t theaterId,
+                                                                                size_t movieId)
+    {
+        return execute(catalog.findPremiere(theaterId, movieId), std::vector<uint16_t>{},
+                       [](const Premiere& premiere) {
+            return premiere.getSeatsAvailable();
+        });
+    }
+
+    std::future<std::vector<uint16_t>> ShardedBookingService::getSeatsAvailable(const std::string& theaterName,
+                                                                                const std::string& movieName)
+    {
+        return execute(catalog.findPremiere(theaterName, movieName), std::vector<uint16_t>{},
+                       [](const Premiere& premiere) {
+            return premiere.getSeatsAvailable();
+        });
+    }
+}
@@ -0,0 +1,186 @@
+/**
+ * @file       ShardedBookingService.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Thread-per-core (shared-nothing) BookingService declaration
+*/
+
+#ifndef BOOKINGSERVICE_SHARDEDBOOKINGSERVICE_H
+#define BOOKINGSERVICE_SHARDEDBOOKINGSERVICE_H
+
+#include <future>
+#include <functional>
+#include <thread>
+#include <utility>
+
+#include "BookingService.h"
+#include "MpscQueue.h"
+
+namespace Booking
+{
+    /**
+     * @brief Read-only copy of the catalog (Movies, Theaters and the premieres placement)<br>
+     * Built once from the BookingService tables and never modified afterwards, so the cache lines with
+     * the catalog data stay shared between all the cores and never bounce
+     */
+    struct CatalogReplica
+    {
+        std::unordered_map<std::string, size_t> movieIds;
+        std::unordered_map<std::string, size_t> theaterIds;
+
+        /** The (theaterId, movieId) pair: the full IDs, so any two premieres have the different keys **/
+        using PremiereKey = std::pair<size_t, size_t>;
+
+        struct PremiereKeyHash
+        {
+            size_t operator()(const PremiereKey& key) const noexcept {
+                // The boost::hash_combine mixing: the theater and the movie IDs do not cancel each other out
+                size_t seed = std::hash<size_t> {}(key.first);
+                seed ^= std::hash<size_t> {}(key.second) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+                return seed;
+            }
+        };
+
+        /** Maps the (theaterId, movieId) key to the global premiere index **/
+        std::unordered_map<PremiereKey, size_t, PremiereKeyHash> premiereIndex;
+
+        explicit CatalogReplica(const BookingService& service);
+
+        [[nodiscard]]
+        std::optional<size_t> findPremiere(size_t theaterId, size_t movieId) const noexcept;
+
+        [[nodiscard]]
+        std::optional<size_t> findPremiere(const std::string& theaterName,
+                                           const std::string& movieName) const noexcept;
+    };
+
+    /**
+     * @brief Shared-nothing BookingService: the premieres are partitioned by their index across N shards. <br>
+     * Each shard owns its premieres exclusively, runs on its own thread (pinned to a core) and
+     * is fed with requests through the lock-free MPSC queue. Callers never touch the premiere data directly
+     * @note The schedule is fixed at the moment of construction: the source BookingService shall not be
+     * modified while the sharded service is running
+     */
+    class ShardedBookingService: NonCopyable
+    {
+    public:
+
+        /** The message type sent to shards **/
+        using Task = std::function<void()>;
+
+        /**
+         * Constructor: Splits the schedule of the existing service between the shards and starts them
+         * @param service the source of the catalog and the schedule
+         * @param shardsCount number of shards (by default - one per each hardware thread)
+         */
+        explicit ShardedBookingService(const BookingService& service,
+                                       size_t shardsCount = std::max(1u, std::thread::hardware_concurrency()));
+
+        /**
+         * Destructor: stops all the shards (the requests already queued are processed)
+         */
+        ~ShardedBookingService() override;
+
+        [[nodiscard]]
+        size_t getShardsCount() const noexcept {
+            return shards.size();
+        }
+
+        [[nodiscard]]
+        const CatalogReplica& getCatalog() const noexcept {
+            return catalog;
+        }
+
+        /**
+         * Returns the stream the seats changes of the shards premieres are published to
+         * @note The events are identified by the global premiere index, the same as in the source schedule
+         */
+        [[nodiscard]]
+        ChangeStream& getChangeStream() noexcept {
+            return changeStream;
+        }
+
+        /**
+         * Returns the tracker the bookings of the shards premieres are counted by
+         */
+        [[nodiscard]]
+        TrendingTracker& getTrending() noexcept {
+            return trending;
+        }
+
+        /**
+         * Books the seats for the premiere of the movie in the theater
+         * @return a future with the booking result. False - if the premiere not found or the seats are not available
+         * @note Not priced: the shards own the copies of the premieres, the PricingEngine of the source service
+         * does not reprice them
+         */
+        [[nodiscard]]
+        std::future<bool> bookSeats(size_t theaterId, size_t movieId, std::vector<uint16_t> seatsToBook);
+
+        /**
+         * Books the seats for the premiere of the movie in the theater
+         * @return a future with the booking result. False - if the premiere not found or the seats are not available
+         * @note Not priced: the shards own the copies of the premieres, the PricingEngine of the source service
+         * does not reprice them
+         */
+        [[nodiscard]]
+        std::future<bool> bookSeats(const std::string& theaterName, const std::string& movieName,
+                                    std::vector<uint16_t> seatsToBook);
+
+        /**
+         * Returns a list of theater seats available for booking
+         * @return a future with the seats numbers. Empty collection if the premiere not found or sold out
+         */
+        [[nodiscard]]
+        std::future<std::vector<uint16_t>> getSeatsAvailable(size_t theaterId, size_t movieId);
+
+        /**
+         * Returns a list of theater seats available for booking
+         * @return a future with the seats numbers. Empty collection if the premiere not found or sold out
+         */
+        [[nodiscard]]
+        std::future<std::vector<uint16_t>> getSeatsAvailable(const std::string& theaterName,
+                                                             const std::string& movieName);
+
+    private:
+
+        /**
+         * @brief A single shard: the premieres partition, the worker thread and its requests queue
+         */
+        struct Shard
+        {
+            /** Capacity of the requests queue of the each shard **/
+            static constexpr size_t queueCapacity { 4096 };
+
+            Concurrency::MpscQueue<Task> requests { queueCapacity };
+
+            /** Incremented on the each request - the worker thread waits on it when the queue is empty **/
+            alignas(Concurrency::cacheLineSize) std::atomic<uint32_t> notifications { 0 };
+
+            /** Premieres owned by the shard. Populated by the shard thread itself, so the memory is allocated
+             *  and touched first on the core the shard is pinned to **/
+            ChunkedVector<Premiere> premieres;
+
+            bool stopped { false };
+            std::jthread worker;
+
+            void post(Task task);
+            void run();
+        };
+
+        template<typename Result, typename Fn>
+        std::future<Result> execute(std::optional<size_t> premiereIdx, Result fallback, Fn&& func);
+
+        const CatalogReplica catalog;
+
+        /** The shards own the copies of the premieres: their changes and bookings are not the source ones **/
+        ChangeStream changeStream;
+        TrendingTracker trending;
+
+        std::vector<std::unique_ptr<Shard>> shards;
+    };
+}
+
+#endif //BOOKINGSERVICE_SHARDEDBOOKINGSERVICE_H
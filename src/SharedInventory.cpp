@@ -0,0 +1,378 @@
+/**
+ * @file       SharedInventory.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Seat inventory in the POSIX shared memory: several front-end processes book the same premieres
+ */
+
+#include "SharedInventory.h"
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <memory>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    using namespace Ipc;
+
+    constexpr uint32_t seatsMask { (1u << Booking::Theater::seatsCapacityMax) - 1 };
+
+    /** POSIX shared memory object names start with the slash **/
+    std::string segmentName(const std::string& name) {
+        return name.starts_with('/') ? name : '/' + name;
+    }
+
+    constexpr size_t alignUp(size_t offset, size_t alignment) noexcept {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    /** The offsets of the catalog arrays in the segment: the header is at its beginning **/
+    struct SegmentOffsets
+    {
+        size_t movies { 0 };
+        size_t theaters { 0 };
+        size_t premieres { 0 };
+        size_t premieresIndex { 0 };
+        size_t size { 0 };
+    };
+
+    uint32_t indexSlotsCount(const InventoryLayout& layout) noexcept {
+        return std::bit_ceil(std::max<uint32_t>(2 * layout.premieresMax, 2));
+    }
+
+    SegmentOffsets segmentOffsets(const InventoryLayout& layout) noexcept
+    {
+        SegmentOffsets offsets;
+        offsets.movies = alignUp(sizeof(InventoryHeader), alignof(SharedEntry));
+        offsets.theaters = offsets.movies + layout.moviesMax * sizeof(SharedEntry);
+        offsets.premieres = alignUp(offsets.theaters + layout.theatersMax * sizeof(SharedEntry),
+                                    alignof(SharedPremiere));
+        offsets.premieresIndex = offsets.premieres + layout.premieresMax * sizeof(SharedPremiere);
+        offsets.size = offsets.premieresIndex + indexSlotsCount(layout) * sizeof(std::atomic<uint32_t>);
+        return offsets;
+    }
+
+    uint32_t premiereHash(uint32_t theaterId, uint32_t movieId) noexcept
+    {
+        const uint64_t key = (static_cast<uint64_t>(theaterId) << 32) | movieId;
+        return static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ull) >> 32);
+    }
+
+    /** Constructs the array at the offset in the segment **/
+    template<typename Type>
+    Type* construct(void* segment, size_t offset, size_t count)
+    {
+        Type* array = reinterpret_cast<Type*>(static_cast<std::byte*>(segment) + offset);
+        std::uninitialized_value_construct_n(array, count);
+        return array;
+    }
+}
+
+namespace Ipc
+{
+    SharedInventory::CatalogLock::CatalogLock(SharedInventory& inventory) noexcept: inventory { inventory }
+    {
+        pthread_mutex_t& mutex = inventory.header->mtxCatalog;
+        const int result = ::pthread_mutex_lock(&mutex);
+        // ENOTRECOVERABLE (the previous taker has not repaired it), EINVAL, ...: the lock is not taken
+        if (0 != result && EOWNERDEAD != result)
+            return;
+
+        if (EOWNERDEAD == result) {
+            // The owner died holding the lock: the catalog is repaired before it is made consistent again
+            inventory.recover();
+            if (0 != ::pthread_mutex_consistent(&mutex)) {
+                ::pthread_mutex_unlock(&mutex);
+                return;
+            }
+            inventory.header->recoveries.fetch_add(1, std::memory_order_relaxed);
+        }
+        locked = true;
+    }
+
+    SharedInventory::CatalogLock::~CatalogLock()
+    {
+        if (locked)
+            ::pthread_mutex_unlock(&inventory.header->mtxCatalog);
+    }
+
+    size_t SharedInventory::segmentSize(const InventoryLayout& layout) noexcept
+    {
+        return segmentOffsets(layout).size;
+    }
+
+    SharedInventory::SharedInventory(const std::string& name, const InventoryLayout& layout)
+    {
+        const std::string path = segmentName(name);
+        const int fd = ::shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0)
+            return;
+
+        const SegmentOffsets offsets = segmentOffsets(layout);
+        void* address = MAP_FAILED;
+        if (0 == ::ftruncate(fd, static_cast<off_t>(offsets.size)))
+            address = ::mmap(nullptr, offsets.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (MAP_FAILED == address) {
+            ::shm_unlink(path.c_str());
+            return;
+        }
+
+        InventoryHeader* created = new (address) InventoryHeader {};
+        created->layout = layout;
+        created->indexMask = indexSlotsCount(layout) - 1;
+
+        pthread_mutexattr_t attributes;
+        ::pthread_mutexattr_init(&attributes);
+        ::pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+        ::pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+        ::pthread_mutex_init(&created->mtxCatalog, &attributes);
+        ::pthread_mutexattr_destroy(&attributes);
+
+        created->movies = construct<SharedEntry>(address, offsets.movies, layout.moviesMax);
+        created->theaters = construct<SharedEntry>(address, offsets.theaters, layout.theatersMax);
+        created->premieres = construct<SharedPremiere>(address, offsets.premieres, layout.premieresMax);
+        created->premieresIndex = construct<std::atomic<uint32_t>>(address, offsets.premieresIndex,
+                                                                   indexSlotsCount(layout));
+
+        header = created;
+        size = offsets.size;
+        owned = path;
+        header->ready.store(InventoryHeader::magic, std::memory_order_release);
+    }
+
+    SharedInventory::SharedInventory(const std::string& name)
+    {
+        const int fd = ::shm_open(segmentName(name).c_str(), O_RDWR, 0);
+        if (fd < 0)
+            return;
+
+        struct stat status {};
+        void* address = MAP_FAILED;
+        if (0 == ::fstat(fd, &status) && static_cast<size_t>(status.st_size) >= sizeof(InventoryHeader))
+            address = ::mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (MAP_FAILED == address)
+            return;
+
+        InventoryHeader* mapped = static_cast<InventoryHeader*>(address);
+        const bool ready = InventoryHeader::magic == mapped->ready.load(std::memory_order_acquire) &&
+                           segmentSize(mapped->layout) <= static_cast<size_t>(status.st_size);
+        if (!ready) {
+            ::munmap(address, static_cast<size_t>(status.st_size));
+            return;
+        }
+        header = mapped;
+        size = static_cast<size_t>(status.st_size);
+    }
+
+    SharedInventory::~SharedInventory()
+    {
+        if (nullptr == header)
+            return;
+        ::munmap(header, size);
+        if (!owned.empty())
+            ::shm_unlink(owned.c_str());
+    }
+
+    bool SharedInventory::load(const Booking::BookingService& service)
+    {
+        bool loaded = true;
+        for (const Booking::Movie* movie: service.getMoviesView())
+            loaded &= addMovie(static_cast<uint32_t>(movie->id), movie->name);
+        for (const Booking::Theater* theater: service.getTheatersView())
+            loaded &= addTheater(static_cast<uint32_t>(theater->id), theater->name);
+
+        const Booking::PremiereSchedule& schedule = service.bookingSchedule;
+        for (size_t slot = 0; slot < schedule.size(); ++slot) {
+            if (schedule.isVacant(slot))
+                continue;
+            const Booking::Premiere& premiere = schedule[slot];
+            loaded &= addPremiere(static_cast<uint32_t>(schedule.getTheaterIds()[slot]),
+                                  static_cast<uint32_t>(schedule.getMovieIds()[slot]),
+                                  premiere.seatsBooked.load(std::memory_order_acquire));
+        }
+        return loaded;
+    }
+
+    size_t SharedInventory::share(Booking::BookingService& service)
+    {
+        // Under the catalog lock: the premieres can not be (un)scheduled meanwhile
+        return service.readCatalog([&] {
+            Booking::PremiereSchedule& schedule = service.bookingSchedule;
+            size_t shared = 0;
+            for (size_t slot = 0; slot < schedule.size(); ++slot) {
+                if (schedule.isVacant(slot))
+                    continue;
+                SharedPremiere* premiere = findPremiere(static_cast<uint32_t>(schedule.getTheaterIds()[slot]),
+                                                        static_cast<uint32_t>(schedule.getMovieIds()[slot]));
+                if (nullptr == premiere)
+                    continue;
+                schedule[slot].shareSeats(&premiere->seatsBooked);
+                ++shared;
+            }
+            return shared;
+        });
+    }
+
+    bool SharedInventory::addMovie(uint32_t id, std::string_view name)
+    {
+        const CatalogLock lock { *this };
+        if (!lock.ownsLock())
+            return false;
+
+        const uint32_t count = header->moviesCount.load(std::memory_order_relaxed);
+        if (count == header->layout.moviesMax || name.size() >= sizeof(SharedEntry::name))
+            return false;
+
+        // Invisible until the count is published: the entry of the dead owner is simply overwritten
+        SharedEntry& entry = header->movies[count];
+        entry.id = id;
+        std::fill(std::copy(name.begin(), name.end(), entry.name.begin()), entry.name.end(), '\0');
+        header->moviesCount.store(count + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool SharedInventory::addTheater(uint32_t id, std::string_view name)
+    {
+        const CatalogLock lock { *this };
+        if (!lock.ownsLock())
+            return false;
+
+        const uint32_t count = header->theatersCount.load(std::memory_order_relaxed);
+        if (count == header->layout.theatersMax || name.size() >= sizeof(SharedEntry::name))
+            return false;
+
+        SharedEntry& entry = header->theaters[count];
+        entry.id = id;
+        std::fill(std::copy(name.begin(), name.end(), entry.name.begin()), entry.name.end(), '\0');
+        header->theatersCount.store(count + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool SharedInventory::addPremiere(uint32_t theaterId, uint32_t movieId, uint32_t seatsBooked)
+    {
+        const CatalogLock lock { *this };
+        if (!lock.ownsLock())
+            return false;
+
+        const uint32_t count = header->premieresCount.load(std::memory_order_relaxed);
+        if (count == header->layout.premieresMax || nullptr != findPremiere(theaterId, movieId))
+            return false;
+
+        SharedPremiere& premiere = header->premieres[count];
+        premiere.theaterId = theaterId;
+        premiere.movieId = movieId;
+        premiere.seatsBooked.store(seatsBooked & seatsMask, std::memory_order_relaxed);
+        header->premieresCount.store(count + 1, std::memory_order_release);
+        index(count);
+        return true;
+    }
+
+    void SharedInventory::index(uint32_t premiereIdx) noexcept
+    {
+        const SharedPremiere& premiere = header->premieres[premiereIdx];
+        for (uint32_t slot = premiereHash(premiere.theaterId, premiere.movieId); ; ++slot) {
+            std::atomic<uint32_t>& entry = header->premieresIndex[slot & header->indexMask];
+            if (0 == entry.load(std::memory_order_relaxed)) {
+                entry.store(premiereIdx + 1, std::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    void SharedInventory::recover() noexcept
+    {
+        // The dead owner may have published the premiere, but not indexed it yet
+        const uint32_t count = header->premieresCount.load(std::memory_order_relaxed);
+        for (uint32_t premiereIdx = 0; premiereIdx < count; ++premiereIdx) {
+            const SharedPremiere& premiere = header->premieres[premiereIdx];
+            if (nullptr == findPremiere(premiere.theaterId, premiere.movieId))
+                index(premiereIdx);
+        }
+    }
+
+    std::optional<uint32_t> SharedInventory::findEntry(const OffsetPtr<SharedEntry>& entries,
+                                                       const std::atomic<uint32_t>& count,
+                                                       std::string_view name) noexcept
+    {
+        const uint32_t entriesCount = count.load(std::memory_order_acquire);
+        for (uint32_t idx = 0; idx < entriesCount; ++idx) {
+            const SharedEntry& entry = entries[idx];
+            if (name == std::string_view { entry.name.data() })
+                return entry.id;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<uint32_t> SharedInventory::findMovie(std::string_view movieName) const noexcept
+    {
+        return findEntry(header->movies, header->moviesCount, movieName);
+    }
+
+    std::optional<uint32_t> SharedInventory::findTheater(std::string_view theaterName) const noexcept
+    {
+        return findEntry(header->theaters, header->theatersCount, theaterName);
+    }
+
+    SharedPremiere* SharedInventory::findPremiere(uint32_t theaterId, uint32_t movieId) const noexcept
+    {
+        for (uint32_t slot = premiereHash(theaterId, movieId); ; ++slot) {
+            const uint32_t entry = header->premieresIndex[slot & header->indexMask].load(std::memory_order_acquire);
+            if (0 == entry)
+                return nullptr;
+            SharedPremiere& premiere = header->premieres[entry - 1];
+            if (premiere.theaterId == theaterId && premiere.movieId == movieId)
+                return &premiere;
+        }
+    }
+
+    std::optional<std::vector<uint16_t>> SharedInventory::getSeatsAvailable(uint32_t theaterId, uint32_t movieId) const
+    {
+        const SharedPremiere* premiere = findPremiere(theaterId, movieId);
+        if (nullptr == premiere)
+            return std::nullopt;
+
+        const uint32_t available = ~premiere->seatsBooked.load(std::memory_order_acquire) & seatsMask;
+        std::vector<uint16_t> seats;
+        seats.reserve(std::popcount(available));
+        for (uint32_t bits = available; 0 != bits; bits &= bits - 1)
+            seats.push_back(static_cast<uint16_t>(std::countr_zero(bits) + 1));
+        return seats;
+    }
+
+    Status SharedInventory::bookSeats(uint32_t theaterId, uint32_t movieId, std::span<const uint16_t> seats) noexcept
+    {
+        SharedPremiere* premiere = findPremiere(theaterId, movieId);
+        if (nullptr == premiere)
+            return Status::NotFound;
+
+        uint32_t requested = 0;
+        for (const uint16_t seat: seats) {
+            const uint32_t bit = seat >= 1 && seat <= Booking::Theater::seatsCapacityMax ? 1u << (seat - 1) : 0;
+            if (0 == bit || 0 != (requested & bit))
+                return Status::Rejected;
+            requested |= bit;
+        }
+        if (0 == requested)
+            return Status::Rejected;
+
+        // The single CAS books all the seats at once: no other process can see (or book) a part of them
+        uint32_t booked = premiere->seatsBooked.load(std::memory_order_relaxed);
+        do {
+            if (0 != (booked & requested))
+                return Status::Rejected;
+        } while (!premiere->seatsBooked.compare_exchange_weak(booked, booked | requested,
+                                                              std::memory_order_acq_rel, std::memory_order_relaxed));
+        return Status::Ok;
+    }
+}
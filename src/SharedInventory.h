@@ -0,0 +1,322 @@
+/**
+ * @file       SharedInventory.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Seat inventory in the POSIX shared memory: several front-end processes book the same premieres
+ */
+
+#ifndef BOOKINGSERVICE_SHAREDINVENTORY_H
+#define BOOKINGSERVICE_SHAREDINVENTORY_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <pthread.h>
+
+#include "BookingService.h"
+#include "SharedMemoryIpc.h"
+
+namespace Ipc
+{
+    /**
+     * @brief The pointer stored in the shared memory: the offset of the target from the pointer itself.<br>
+     * The segment is mapped at the different addresses in the different processes, while the offsets within
+     * the segment are the same everywhere. Zero offset - nullptr (the pointer never points to itself)
+     */
+    template<typename Type>
+    class OffsetPtr
+    {
+        std::ptrdiff_t offset { 0 };
+
+    public:
+
+        OffsetPtr() noexcept = default;
+
+        OffsetPtr(Type* pointer) noexcept {
+            *this = pointer;
+        }
+
+        OffsetPtr(const OffsetPtr& other) noexcept: OffsetPtr { other.get() } {
+        }
+
+        OffsetPtr& operator=(const OffsetPtr& other) noexcept {
+            return *this = other.get();
+        }
+
+        OffsetPtr& operator=(Type* pointer) noexcept
+        {
+            offset = nullptr == pointer ? 0 : reinterpret_cast<const std::byte*>(pointer) -
+                                              reinterpret_cast<const std::byte*>(this);
+            return *this;
+        }
+
+        [[nodiscard]]
+        Type* get() const noexcept
+        {
+            if (0 == offset)
+                return nullptr;
+            return reinterpret_cast<Type*>(const_cast<std::byte*>(reinterpret_cast<const std::byte*>(this)) + offset);
+        }
+
+        [[nodiscard]]
+        Type& operator[](size_t idx) const noexcept {
+            return get()[idx];
+        }
+
+        [[nodiscard]]
+        Type* operator->() const noexcept {
+            return get();
+        }
+
+        [[nodiscard]]
+        explicit operator bool() const noexcept {
+            return 0 != offset;
+        }
+    };
+
+    /** The capacities of the inventory segment: fixed at its creation **/
+    struct InventoryLayout
+    {
+        uint32_t moviesMax { 1'024 };
+        uint32_t theatersMax { 256 };
+        uint32_t premieresMax { 4'096 };
+    };
+
+    /**
+     * @brief The Movie or the Theater of the shared catalog
+     */
+    struct SharedEntry
+    {
+        /** The ID of the entry in the BookingService the catalog was loaded from **/
+        uint32_t id { 0 };
+
+        std::array<char, 60> name {};
+    };
+
+    /**
+     * @brief The premiere seat state shared by the processes: the booked seats bitmap (bit N - 1 for the seat N,
+     * as the Premiere::seatsBooked) is changed by the single CAS, so the booking is visible to everyone entirely or
+     * not at all, and the process killed in the middle of the booking leaves no partial state and holds no lock.
+     * The premieres never share the cache lines
+     */
+    struct alignas(Concurrency::cacheLineSize) SharedPremiere
+    {
+        std::atomic<uint32_t> seatsBooked { 0 };
+        uint32_t theaterId { 0 };
+        uint32_t movieId { 0 };
+    };
+
+    /**
+     * @brief The header of the inventory segment: the catalog arrays follow it in the same segment.<br>
+     * The catalog is appended under the process-shared robust mutex; the entries are published by the counters,
+     * so the readers (and the bookings) never lock
+     */
+    struct InventoryHeader
+    {
+        /** Set last, when the segment is initialized **/
+        static constexpr uint32_t magic { 0x424B494E };
+
+        std::atomic<uint32_t> ready { 0 };
+        InventoryLayout layout;
+
+        /** The premieres hash index: (the premiere index + 1) by the Theater and the Movie IDs, zero - empty **/
+        uint32_t indexMask { 0 };
+
+        pthread_mutex_t mtxCatalog;
+
+        /** Number of the times the catalog lock was recovered from the dead owner **/
+        std::atomic<uint32_t> recoveries { 0 };
+
+        std::atomic<uint32_t> moviesCount { 0 };
+        std::atomic<uint32_t> theatersCount { 0 };
+        std::atomic<uint32_t> premieresCount { 0 };
+
+        OffsetPtr<SharedEntry> movies;
+        OffsetPtr<SharedEntry> theaters;
+        OffsetPtr<SharedPremiere> premieres;
+        OffsetPtr<std::atomic<uint32_t>> premieresIndex;
+    };
+
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "The seats and the counters are shared by the processes");
+
+    /**
+     * @brief The seat inventory (the catalog and the premieres seats) in the POSIX shared memory segment.<br>
+     * Each front-end process maps the segment (the crash of one does not take the others down) and books the
+     * seats directly, without a server: all-or-nothing, with no overbooking across the processes.
+     * <br> Usage:
+     * @code
+     *   SharedInventory inventory { "booking-inventory", InventoryLayout {} };  // by the deploying process
+     *   inventory.load(service);
+     *   ...
+     *   SharedInventory inventory { "booking-inventory" };                      // by the each front-end process
+     *   inventory.bookSeats(inventory.findTheater("4DX").value(), inventory.findMovie("Terminator").value(), seats);
+     *   inventory.share(service);                   // the process serving its BookingService books through it too
+     * @endcode
+     * @warning load() copies the BookingService: the premieres of the service book through the inventory only
+     * once they are shared by share(). The premieres scheduled afterwards are not shared, until share() is called
+     * again
+     */
+    class SharedInventory
+    {
+    public:
+
+        /**
+         * @brief The catalog lock: the process-shared robust mutex. If its owner has died, the lock is taken over and
+         * the catalog is repaired first (see recover()): a crashed process never blocks the catalog of the others.
+         * <br> The lock may still fail (e.g. the mutex is not recoverable anymore): the catalog change shall check
+         * ownsLock() and fail then
+         */
+        class CatalogLock
+        {
+            SharedInventory& inventory;
+            bool locked { false };
+
+        public:
+
+            explicit CatalogLock(SharedInventory& inventory) noexcept;
+            ~CatalogLock();
+
+            CatalogLock(const CatalogLock&) = delete;
+            CatalogLock& operator=(const CatalogLock&) = delete;
+
+            [[nodiscard]]
+            bool ownsLock() const noexcept {
+                return locked;
+            }
+        };
+
+        /**
+         * Constructor: creates the new segment
+         * @param layout the capacities of the catalog
+         * @note The segment is removed by the destructor of the creator
+         * @see isAttached()
+         */
+        SharedInventory(const std::string& name, const InventoryLayout& layout);
+
+        /**
+         * Constructor: maps the existing segment created by another process
+         * @see isAttached()
+         */
+        explicit SharedInventory(const std::string& name);
+
+        SharedInventory(const SharedInventory&) = delete;
+        SharedInventory& operator=(const SharedInventory&) = delete;
+
+        ~SharedInventory();
+
+        /**
+         * Returns False, if the segment can not be created (or does not exist) or is not initialized yet
+         */
+        [[nodiscard]]
+        bool isAttached() const noexcept {
+            return nullptr != header;
+        }
+
+        /**
+         * Places the catalog and the current seats of the premieres of the service into the inventory: the one-time
+         * copy, the later changes of the service are not reflected (see the class description)
+         * @return False if any of the entries could not be added (the entries which fit are kept)
+         * @note Like the BookingService lookups, shall not run concurrently with the catalog changes of the service
+         */
+        bool load(const Booking::BookingService& service);
+
+        /**
+         * Routes the bookings of the service premieres through the inventory: each premiere found in the inventory
+         * (by the Theater and the Movie IDs) books its seats by the CAS of the shared word from now on (see
+         * Booking::Premiere::shareSeats()), so the processes never overbook, whether they book through
+         * the inventory or through their services (and the Ipc::Server or the CLI serving them)
+         * @return the number of the premieres shared
+         * @note The inventory shall outlive the bookings of the service
+         */
+        size_t share(Booking::BookingService& service);
+
+        /**
+         * Appends the Movie to the catalog
+         * @param id the Movie ID in the BookingService
+         * @return False if there is no room, the name is too long or the catalog lock can not be taken
+         */
+        bool addMovie(uint32_t id, std::string_view name);
+
+        /**
+         * Appends the Theater to the catalog
+         * @param id the Theater ID in the BookingService
+         * @return False if there is no room, the name is too long or the catalog lock can not be taken
+         */
+        bool addTheater(uint32_t id, std::string_view name);
+
+        /**
+         * Appends the premiere of the Movie in the Theater
+         * @param seatsBooked the seats booked already (bit N - 1 for the seat N)
+         * @return False if there is no room, the premiere exists already or the catalog lock can not be taken
+         */
+        bool addPremiere(uint32_t theaterId, uint32_t movieId, uint32_t seatsBooked = 0);
+
+        [[nodiscard]]
+        std::optional<uint32_t> findMovie(std::string_view movieName) const noexcept;
+
+        [[nodiscard]]
+        std::optional<uint32_t> findTheater(std::string_view theaterName) const noexcept;
+
+        /**
+         * @return the premiere or nullptr if there is no such premiere
+         */
+        [[nodiscard]]
+        SharedPremiere* findPremiere(uint32_t theaterId, uint32_t movieId) const noexcept;
+
+        /**
+         * @return the seats available or std::nullopt if there is no such premiere
+         */
+        [[nodiscard]]
+        std::optional<std::vector<uint16_t>> getSeatsAvailable(uint32_t theaterId, uint32_t movieId) const;
+
+        /**
+         * Books the seats: all or none, lock-free
+         * @return Status::Ok if booked, Status::Rejected if any of the seats is not available,
+         *         Status::NotFound if there is no such premiere
+         */
+        [[nodiscard]]
+        Status bookSeats(uint32_t theaterId, uint32_t movieId, std::span<const uint16_t> seats) noexcept;
+
+        /**
+         * Returns the number of the times the catalog lock was taken over from the dead process
+         */
+        [[nodiscard]]
+        uint32_t getRecoveries() const noexcept {
+            return header->recoveries.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]]
+        static size_t segmentSize(const InventoryLayout& layout) noexcept;
+
+    private:
+
+        [[nodiscard]]
+        static std::optional<uint32_t> findEntry(const OffsetPtr<SharedEntry>& entries,
+                                                 const std::atomic<uint32_t>& count,
+                                                 std::string_view name) noexcept;
+
+        /** Adds the premiere published already to the premieres index. Shall be called under the CatalogLock **/
+        void index(uint32_t premiereIdx) noexcept;
+
+        /** Indexes the premieres the dead owner of the lock has published, but not indexed. The entries it has not
+         *  published are invisible and are overwritten by the next additions **/
+        void recover() noexcept;
+
+        InventoryHeader* header { nullptr };
+        size_t size { 0 };
+
+        /** The segment name: set for the creator only, which removes the segment **/
+        std::string owned;
+    };
+}
+
+#endif //BOOKINGSERVICE_SHAREDINVENTORY_H
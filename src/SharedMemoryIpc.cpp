@@ -0,0 +1,479 @@
+/**
+ * @file       SharedMemoryIpc.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Shared-memory request/response channel of the BookingService for the co-located clients
+ */
+
+#include "SharedMemoryIpc.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace
+{
+    using namespace Ipc;
+
+    /** Busy polling rounds before yielding the CPU: the round trip shall not pay for the scheduler wake-up.
+     *  On the single CPU the peer can not make progress while we spin, so there is no point to **/
+    const size_t spinsMax { std::thread::hardware_concurrency() > 1 ? 256u : 0u };
+
+    /** The idle server gives up the CPU for that long, once it has yielded that many times in a row **/
+    constexpr size_t yieldsMax { 4096 };
+    constexpr auto idleSleep { 20us };
+
+    constexpr uint32_t seatsMask { (1u << Booking::Theater::seatsCapacityMax) - 1 };
+
+    /** POSIX shared memory object names start with the slash **/
+    std::string segmentName(const std::string& name) {
+        return name.starts_with('/') ? name : '/' + name;
+    }
+
+    /** Waits for the event in the busy loop first, then yielding the CPU and finally sleeping (if allowed) **/
+    class Backoff
+    {
+        size_t idleRounds { 0 };
+
+    public:
+
+        void reset() noexcept {
+            idleRounds = 0;
+        }
+
+        void wait(bool allowSleep) noexcept
+        {
+            ++idleRounds;
+            if (idleRounds < spinsMax)
+                return;
+            if (allowSleep && idleRounds >= spinsMax + yieldsMax)
+                std::this_thread::sleep_for(idleSleep);
+            else
+                std::this_thread::yield();
+        }
+    };
+
+    Message makeResponse(const Message& request, Status status = Status::Ok) noexcept
+    {
+        Message response;
+        response.requestId = request.requestId;
+        response.opcode = request.opcode;
+        response.status = status;
+        response.movieId = request.movieId;
+        response.theaterId = request.theaterId;
+        return response;
+    }
+
+    /** The IDs are size_t, the message fields are uint32_t: the greater IDs are rejected, not truncated **/
+    std::optional<uint32_t> toMessageId(size_t id) noexcept
+    {
+        if (id > std::numeric_limits<uint32_t>::max())
+            return std::nullopt;
+        return static_cast<uint32_t>(id);
+    }
+
+    Message findByName(const Booking::BookingService& service, const Message& request)
+    {
+        if (request.count > request.payload.size())
+            return makeResponse(request, Status::Malformed);
+
+        const std::string name { request.payload.data(), request.count };
+        Message response = makeResponse(request, Status::NotFound);
+        std::optional<size_t> id;
+        if (Opcode::FindMovie == request.opcode) {
+            if (const std::optional<Booking::Movie*> movie = service.findMovie(name); movie)
+                id = movie.value()->id;
+        } else if (const std::optional<Booking::Theater*> theater = service.findTheater(name); theater) {
+            id = theater.value()->id;
+        }
+        if (!id)
+            return response;
+
+        const std::optional<uint32_t> messageId = toMessageId(id.value());
+        if (!messageId)
+            return makeResponse(request, Status::OutOfRange);
+        (Opcode::FindMovie == request.opcode ? response.movieId : response.theaterId) = messageId.value();
+        response.status = Status::Ok;
+        return response;
+    }
+
+    Message getTheatersByMovie(const Booking::BookingService& service, const Message& request)
+    {
+        const std::optional<Booking::Movie*> movie = service.movies.findEntryByID(request.movieId);
+        if (!movie)
+            return makeResponse(request, Status::NotFound);
+
+        // Sorted by ID: the pages of the consecutive requests shall not overlap
+        std::vector<Booking::Theater*> theaters = service.getTheatersByMovie(movie.value()->name);
+        std::ranges::sort(theaters, {}, &Booking::Theater::id);
+
+        const std::optional<uint32_t> theatersCount = toMessageId(theaters.size());
+        if (!theatersCount)
+            return makeResponse(request, Status::OutOfRange);
+
+        Message response = makeResponse(request);
+        response.offset = theatersCount.value();
+        for (size_t idx = request.offset; idx < theaters.size() && response.count < Message::idsMax; ++idx) {
+            const std::optional<uint32_t> theaterId = toMessageId(theaters[idx]->id);
+            if (!theaterId)
+                return makeResponse(request, Status::OutOfRange);
+            std::memcpy(response.payload.data() + response.count * sizeof(uint32_t), &theaterId.value(), sizeof(uint32_t));
+            ++response.count;
+        }
+        return response;
+    }
+
+    Message getSeatsAvailable(const Booking::BookingService& service, const Message& request) noexcept
+    {
+        const std::optional<Booking::Premiere*> premiere = service.findPremiere(request.theaterId, request.movieId);
+        if (!premiere)
+            return makeResponse(request, Status::NotFound);
+
+        Message response = makeResponse(request);
+        response.seats = ~premiere.value()->seatsBooked.load(std::memory_order_acquire) & seatsMask;
+        return response;
+    }
+
+    Message bookSeats(const Booking::BookingService& service, const Message& request)
+    {
+        const std::optional<Booking::Premiere*> premiere = service.findPremiere(request.theaterId, request.movieId);
+        if (!premiere)
+            return makeResponse(request, Status::NotFound);
+        if (0 == request.seats || 0 != (request.seats & ~seatsMask))
+            return makeResponse(request, Status::Rejected);
+
+        std::array<uint16_t, Booking::Theater::seatsCapacityMax> seats {};
+        size_t seatsCount = 0;
+        for (uint16_t seat = 1; seat <= Booking::Theater::seatsCapacityMax; ++seat)
+            if (0 != (request.seats & (1u << (seat - 1))))
+                seats[seatsCount++] = seat;
+
+        const bool booked = premiere.value()->bookSeats(std::span<const uint16_t> { seats.data(), seatsCount });
+        Message response = makeResponse(request, booked ? Status::Ok : Status::Rejected);
+        response.seats = request.seats;
+        return response;
+    }
+}
+
+namespace Ipc
+{
+    bool SpscRing::tryPush(const Message& message) noexcept
+    {
+        const uint32_t position = tail.load(std::memory_order_relaxed);
+        if (position - headCached == capacity) {
+            headCached = head.load(std::memory_order_acquire);
+            if (position - headCached == capacity)
+                return false;
+        }
+        messages[position & (capacity - 1)] = message;
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool SpscRing::tryPop(Message& message) noexcept
+    {
+        const uint32_t position = head.load(std::memory_order_relaxed);
+        if (position == tailCached) {
+            tailCached = tail.load(std::memory_order_acquire);
+            if (position == tailCached)
+                return false;
+        }
+        message = messages[position & (capacity - 1)];
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    Message handle(Booking::BookingService& service, const Message& request)
+    {
+        // The entries found stay valid till the response is ready, even if removed meanwhile
+        const Concurrency::EpochDomain::Guard guard;
+        switch (request.opcode)
+        {
+            case Opcode::FindMovie:
+            case Opcode::FindTheater:
+                return findByName(service, request);
+            case Opcode::GetTheatersByMovie:
+                return getTheatersByMovie(service, request);
+            case Opcode::GetSeatsAvailable:
+                return getSeatsAvailable(service, request);
+            case Opcode::BookSeats:
+                return bookSeats(service, request);
+        }
+        return makeResponse(request, Status::Malformed);
+    }
+}
+
+namespace Ipc
+{
+    Server::Server(Booking::BookingService& service): service { service } {
+        server = std::jthread { [this](std::stop_token stopToken) { serve(std::move(stopToken)); } };
+    }
+
+    Server::~Server()
+    {
+        server.request_stop();
+        server.join();
+        for (const Segment& segment: segments) {
+            ::munmap(segment.address, sizeof(Channel));
+            ::shm_unlink(segment.name.c_str());
+        }
+    }
+
+    bool Server::addClient(const std::string& name)
+    {
+        std::lock_guard<std::mutex> lock { mtxSegments };
+        if (channelsCount.load(std::memory_order_relaxed) == clientsMax)
+            return false;
+
+        const std::string path = segmentName(name);
+        const int fd = ::shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0)
+            return false;
+
+        void* address = MAP_FAILED;
+        if (0 == ::ftruncate(fd, sizeof(Channel)))
+            address = ::mmap(nullptr, sizeof(Channel), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (MAP_FAILED == address) {
+            ::shm_unlink(path.c_str());
+            return false;
+        }
+
+        Channel* channel = new (address) Channel {};
+        segments.push_back(Segment { path, address });
+        channel->ready.store(Channel::magic, std::memory_order_release);
+        return publish(channel);
+    }
+
+    bool Server::attach(Channel& channel)
+    {
+        std::lock_guard<std::mutex> lock { mtxSegments };
+        return publish(&channel);
+    }
+
+    bool Server::publish(Channel* channel)
+    {
+        const size_t count = channelsCount.load(std::memory_order_relaxed);
+        if (count == clientsMax)
+            return false;
+        channels[count] = channel;
+        channelsCount.store(count + 1, std::memory_order_release);
+        return true;
+    }
+
+    void Server::setAdmission(Admission::AdmissionController& controller,
+                              uint64_t clientId,
+                              Admission::Lane clientLane) noexcept
+    {
+        clientIdBase = clientId;
+        lane = clientLane;
+        admission.store(&controller, std::memory_order_release);
+    }
+
+    Message Server::execute(size_t channelIdx, const Message& request)
+    {
+        Admission::AdmissionController* controller = admission.load(std::memory_order_acquire);
+        if (nullptr == controller)
+            return handle(service, request);
+
+        // The permit is held until the response is ready
+        const Admission::Permit permit = controller->admit(clientIdBase + channelIdx, lane);
+        switch (permit.getVerdict()) {
+            case Admission::Verdict::RateLimited:
+                return makeResponse(request, Status::RateLimited);
+            case Admission::Verdict::Shed:
+                return makeResponse(request, Status::Shed);
+            case Admission::Verdict::Admitted:
+                break;
+        }
+        return handle(service, request);
+    }
+
+    void Server::serve(std::stop_token stopToken)
+    {
+        Backoff backoff;
+        Message request;
+        while (!stopToken.stop_requested())
+        {
+            bool served = false;
+            const size_t count = channelsCount.load(std::memory_order_acquire);
+            for (size_t idx = 0; idx < count; ++idx)
+            {
+                Channel* channel = channels[idx];
+                std::optional<Message>& pending = parked[idx];
+                if (pending) {
+                    if (!channel->responses.tryPush(pending.value()))
+                        continue;
+                    pending.reset();
+                    served = true;
+                }
+
+                // The client not reading its responses (e.g. after the timeout) fills the ring: its next response
+                // waits in the parked slot and its requests are not taken, while the other clients are served
+                while (channel->requests.tryPop(request)) {
+                    const Message response = execute(idx, request);
+                    served = true;
+                    if (!channel->responses.tryPush(response)) {
+                        pending = response;
+                        responsesParked.fetch_add(1, std::memory_order_relaxed);
+                        break;
+                    }
+                }
+            }
+
+            if (served)
+                backoff.reset();
+            else
+                backoff.wait(true);
+        }
+    }
+}
+
+namespace Ipc
+{
+    Client::Client(const std::string& name)
+    {
+        const int fd = ::shm_open(segmentName(name).c_str(), O_RDWR, 0);
+        if (fd < 0)
+            return;
+
+        void* mapped = ::mmap(nullptr, sizeof(Channel), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (MAP_FAILED == mapped)
+            return;
+
+        address = mapped;
+        Channel* mappedChannel = static_cast<Channel*>(mapped);
+        if (Channel::magic == mappedChannel->ready.load(std::memory_order_acquire))
+            channel = mappedChannel;
+    }
+
+    Client::Client(Channel& channel) noexcept: channel { &channel } {
+    }
+
+    Client::~Client()
+    {
+        if (nullptr != address)
+            ::munmap(address, sizeof(Channel));
+    }
+
+    std::optional<Message> Client::call(Message request, Clock::duration timeout) noexcept
+    {
+        if (nullptr == channel)
+            return std::nullopt;
+
+        request.requestId = ++requestId;
+        const Clock::time_point deadline = Clock::now() + timeout;
+        Backoff backoff;
+        while (!channel->requests.tryPush(request)) {
+            if (Clock::now() > deadline)
+                return std::nullopt;
+            backoff.wait(false);
+        }
+
+        backoff.reset();
+        Message response;
+        for (;;)
+        {
+            if (channel->responses.tryPop(response)) {
+                // The responses to the requests timed out before are dropped
+                if (response.requestId == request.requestId)
+                    return response;
+                continue;
+            }
+            if (Clock::now() > deadline)
+                return std::nullopt;
+            backoff.wait(false);
+        }
+    }
+
+    std::optional<uint32_t> Client::findByName(Opcode opcode, std::string_view name) noexcept
+    {
+        Message request;
+        if (name.size() > request.payload.size())
+            return std::nullopt;
+
+        request.opcode = opcode;
+        request.count = static_cast<uint16_t>(name.size());
+        std::ranges::copy(name, request.payload.begin());
+        const std::optional<Message> response = call(request);
+        if (!response || Status::Ok != response->status)
+            return std::nullopt;
+        return Opcode::FindMovie == opcode ? response->movieId : response->theaterId;
+    }
+
+    std::optional<uint32_t> Client::findMovie(std::string_view movieName) noexcept {
+        return findByName(Opcode::FindMovie, movieName);
+    }
+
+    std::optional<uint32_t> Client::findTheater(std::string_view theaterName) noexcept {
+        return findByName(Opcode::FindTheater, theaterName);
+    }
+
+    std::optional<std::vector<uint32_t>> Client::getTheatersByMovie(uint32_t movieId)
+    {
+        std::vector<uint32_t> theaterIds;
+        Message request;
+        request.opcode = Opcode::GetTheatersByMovie;
+        request.movieId = movieId;
+        do {
+            request.offset = static_cast<uint32_t>(theaterIds.size());
+            const std::optional<Message> response = call(request);
+            if (!response || Status::Ok != response->status)
+                return std::nullopt;
+            if (0 == response->count)
+                break;
+
+            const size_t size = theaterIds.size();
+            theaterIds.resize(size + response->count);
+            std::memcpy(theaterIds.data() + size, response->payload.data(), response->count * sizeof(uint32_t));
+            if (theaterIds.size() >= response->offset)
+                break;
+        } while (true);
+        return theaterIds;
+    }
+
+    std::optional<std::vector<uint16_t>> Client::getSeatsAvailable(uint32_t theaterId, uint32_t movieId)
+    {
+        Message request;
+        request.opcode = Opcode::GetSeatsAvailable;
+        request.theaterId = theaterId;
+        request.movieId = movieId;
+        const std::optional<Message> response = call(request);
+        if (!response || Status::Ok != response->status)
+            return std::nullopt;
+
+        std::vector<uint16_t> seats;
+        seats.reserve(std::popcount(response->seats));
+        for (uint16_t seat = 1; seat <= Booking::Theater::seatsCapacityMax; ++seat)
+            if (0 != (response->seats & (1u << (seat - 1))))
+                seats.push_back(seat);
+        return seats;
+    }
+
+    std::optional<Status> Client::bookSeats(uint32_t theaterId, uint32_t movieId, std::span<const uint16_t> seats) noexcept
+    {
+        Message request;
+        request.opcode = Opcode::BookSeats;
+        request.theaterId = theaterId;
+        request.movieId = movieId;
+        for (const uint16_t seat: seats) {
+            if (0 == seat || seat > Booking::Theater::seatsCapacityMax)
+                return Status::Rejected;
+            request.seats |= 1u << (seat - 1);
+        }
+
+        const std::optional<Message> response = call(request);
+        if (!response)
+            return std::nullopt;
+        return response->status;
+    }
+}
@@ -0,0 +1,334 @@
+/**
+ * @file       SharedMemoryIpc.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Shared-memory request/response channel of the BookingService for the co-located clients
+ */
+
+#ifndef BOOKINGSERVICE_SHAREDMEMORYIPC_H
+#define BOOKINGSERVICE_SHAREDMEMORYIPC_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Admission.h"
+#include "BookingService.h"
+#include "Concurrency.h"
+
+//! Shared-memory IPC: the binary requests of the co-located clients, without the syscalls and the text parsing
+namespace Ipc
+{
+    using namespace std::chrono_literals;
+    using Clock = std::chrono::steady_clock;
+
+    enum class Opcode : uint8_t
+    {
+        /** The Movie ID by the name (in the payload) **/
+        FindMovie = 1,
+        /** The Theater ID by the name (in the payload) **/
+        FindTheater,
+        /** The IDs of the theaters showing the movie, starting from the offset: as much as fit into the payload **/
+        GetTheatersByMovie,
+        /** The available seats bitmap of the premiere **/
+        GetSeatsAvailable,
+        /** Books the seats of the bitmap: all or none. Not priced: the fixed message has no room for the quote,
+         *  the priced bookings go through the text CLI (see Premiere::bookSeatsPriced()) **/
+        BookSeats
+    };
+
+    enum class Status : uint8_t
+    {
+        Ok,
+        /** There is no such movie, theater or premiere **/
+        NotFound,
+        /** The seats are already booked (or do not exist) **/
+        Rejected,
+        /** Unknown opcode or the payload does not fit **/
+        Malformed,
+        /** The ID (or the number of the IDs) found does not fit into the uint32_t field of the message **/
+        OutOfRange,
+        /** The client exceeded its rate: retry later (see Server::setAdmission()) **/
+        RateLimited,
+        /** The service runs at its concurrency limit: retry later (see Server::setAdmission()) **/
+        Shed
+    };
+
+    /**
+     * @brief The request and the response: the fixed size binary record of two cache lines.<br>
+     * The seats are passed as the bitmaps: bit N - 1 for the seat N (see Premiere::seatsBooked)
+     */
+    struct Message
+    {
+        /** Set by the client: the response carries the same ID **/
+        uint32_t requestId { 0 };
+
+        Opcode opcode { Opcode::FindMovie };
+        Status status { Status::Ok };
+
+        /** The payload length: the name bytes or the number of IDs **/
+        uint16_t count { 0 };
+
+        uint32_t movieId { 0 };
+        uint32_t theaterId { 0 };
+
+        /** GetTheatersByMovie: the first theater to return (request) / the total number of theaters (response) **/
+        uint32_t offset { 0 };
+
+        /** GetSeatsAvailable: the seats available (response). BookSeats: the seats to book (request) **/
+        uint32_t seats { 0 };
+
+        /** The name (FindMovie, FindTheater) or the uint32_t IDs (GetTheatersByMovie) **/
+        std::array<char, 2 * Concurrency::cacheLineSize - 24> payload {};
+
+        static constexpr size_t idsMax { sizeof(payload) / sizeof(uint32_t) };
+    };
+
+    static_assert(sizeof(Message) == 2 * Concurrency::cacheLineSize, "Message shall occupy two cache lines");
+    static_assert(std::is_trivially_copyable_v<Message>, "Message is copied to/from the shared memory as is");
+
+    /**
+     * @brief Bounded lock-free single-producer single-consumer ring of the messages, placed into the shared memory.
+     * <br> The indices are the free-running counters on their own cache lines; each side also caches the last seen
+     * index of the other side, so the shared index line is read only when the ring looks full (empty)
+     */
+    class SpscRing
+    {
+    public:
+
+        static constexpr uint32_t capacity { 64 };
+
+        /**
+         * Tries to enqueue the message. Shall be called by the single producer
+         * @return False if the ring is full
+         */
+        bool tryPush(const Message& message) noexcept;
+
+        /**
+         * Tries to dequeue the message. Shall be called by the single consumer
+         * @return False if the ring is empty
+         */
+        bool tryPop(Message& message) noexcept;
+
+    private:
+
+        static_assert(std::atomic<uint32_t>::is_always_lock_free, "The indices are shared between the processes");
+        static_assert(0 == (capacity & (capacity - 1)), "The capacity shall be a power of two");
+
+        /** The producer line: its index and the cached consumer index **/
+        alignas(Concurrency::cacheLineSize) std::atomic<uint32_t> tail { 0 };
+        uint32_t headCached { 0 };
+
+        /** The consumer line: its index and the cached producer index **/
+        alignas(Concurrency::cacheLineSize) std::atomic<uint32_t> head { 0 };
+        uint32_t tailCached { 0 };
+
+        alignas(Concurrency::cacheLineSize) std::array<Message, capacity> messages {};
+    };
+
+    /**
+     * @brief The channel of a single client: the layout of the shared memory segment
+     */
+    struct Channel
+    {
+        /** Set last, when the channel is initialized **/
+        static constexpr uint32_t magic { 0x424B4950 };
+
+        std::atomic<uint32_t> ready { 0 };
+
+        /** Client -> Server **/
+        SpscRing requests;
+
+        /** Server -> Client **/
+        SpscRing responses;
+    };
+
+    /**
+     * Executes the request
+     * @return the response to the request
+     * @note Looks up through the BookingService under its catalog lock: safe against the concurrent catalog changes
+     */
+    [[nodiscard]]
+    Message handle(Booking::BookingService& service, const Message& request);
+
+    /**
+     * @brief The server: a single thread serves the channels of all the clients, busy polling the request rings.
+     * <br> The server never waits for a client: the response, which does not fit into the full ring, is parked and
+     * the channel is skipped until the client reads its responses
+     * <br> The channels are created by the server (see addClient()), the clients only map them
+     */
+    class Server
+    {
+    public:
+
+        static constexpr size_t clientsMax { 64 };
+
+        explicit Server(Booking::BookingService& service);
+
+        Server(const Server&) = delete;
+        Server& operator=(const Server&) = delete;
+
+        /**
+         * Stops serving and removes the shared memory segments created
+         */
+        ~Server();
+
+        /**
+         * Creates the shared memory segment of the new client and starts serving it
+         * @param name the segment name: the same shall be passed to the Client
+         * @return False if the segment can not be created or there are too many clients
+         */
+        bool addClient(const std::string& name);
+
+        /**
+         * Starts serving the channel created by the caller (e.g. placed into the private memory of the process)
+         * @param channel shall outlive the server
+         * @return False if there are too many clients
+         */
+        bool attach(Channel& channel);
+
+        /**
+         * Puts the requests under the admission control: each request is executed only if admitted, otherwise it is
+         * answered by Status::RateLimited or Status::Shed at once
+         * @param controller the admission controller shared with the other front ends: shall outlive the server
+         * @param clientIdBase the client ID of the first channel: the channel N is the client clientIdBase + N
+         * @param lane the lane of the clients of the server
+         * @note Shall be called once
+         */
+        void setAdmission(Admission::AdmissionController& controller, uint64_t clientIdBase,
+                          Admission::Lane lane = Admission::Lane::Regular) noexcept;
+
+        /**
+         * Returns the number of the responses parked so far: the response ring of the client was full
+         */
+        [[nodiscard]]
+        uint64_t getResponsesParked() const noexcept {
+            return responsesParked.load(std::memory_order_relaxed);
+        }
+
+    private:
+
+        /** Polls the clients requests until stopped **/
+        void serve(std::stop_token stopToken);
+
+        bool publish(Channel* channel);
+
+        /** Executes the request of the channel, if admitted **/
+        [[nodiscard]]
+        Message execute(size_t channelIdx, const Message& request);
+
+        struct Segment
+        {
+            std::string name;
+            void* address { nullptr };
+        };
+
+        Booking::BookingService& service;
+
+        /** No admission control, if not set. The client ID and the lane are set before it is published **/
+        std::atomic<Admission::AdmissionController*> admission { nullptr };
+        uint64_t clientIdBase { 0 };
+        Admission::Lane lane { Admission::Lane::Regular };
+
+        /** The channels are added while serving: the slots are filled once and published by the count **/
+        std::array<Channel*, clientsMax> channels {};
+        std::atomic<size_t> channelsCount { 0 };
+
+        /** The response of the channel, which did not fit into its full ring: owned by the serving thread **/
+        std::array<std::optional<Message>, clientsMax> parked {};
+        std::atomic<uint64_t> responsesParked { 0 };
+
+        std::mutex mtxSegments;
+        std::vector<Segment> segments;
+
+        std::jthread server;
+    };
+
+    /**
+     * @brief The client of the shared memory channel: a single request is in flight at a time.
+     * <br> Shall be used by a single thread: the channel rings are single-producer single-consumer
+     */
+    class Client
+    {
+    public:
+
+        /**
+         * Constructor: maps the shared memory segment created by the Server::addClient()
+         * @see isConnected()
+         */
+        explicit Client(const std::string& name);
+
+        /**
+         * Constructor: uses the channel served in the same process (see Server::attach())
+         */
+        explicit Client(Channel& channel) noexcept;
+
+        Client(const Client&) = delete;
+        Client& operator=(const Client&) = delete;
+
+        ~Client();
+
+        /**
+         * Returns False, if the segment does not exist or is not initialized yet
+         */
+        [[nodiscard]]
+        bool isConnected() const noexcept {
+            return nullptr != channel;
+        }
+
+        /**
+         * Sends the request and waits for its response
+         * @return std::nullopt if the server does not respond in time
+         */
+        [[nodiscard]]
+        std::optional<Message> call(Message request, Clock::duration timeout = 1s) noexcept;
+
+        [[nodiscard]]
+        std::optional<uint32_t> findMovie(std::string_view movieName) noexcept;
+
+        [[nodiscard]]
+        std::optional<uint32_t> findTheater(std::string_view theaterName) noexcept;
+
+        /**
+         * @return the IDs of the theaters showing the movie or std::nullopt if there is no such movie
+         */
+        [[nodiscard]]
+        std::optional<std::vector<uint32_t>> getTheatersByMovie(uint32_t movieId);
+
+        /**
+         * @return the seats available or std::nullopt if there is no such premiere
+         */
+        [[nodiscard]]
+        std::optional<std::vector<uint16_t>> getSeatsAvailable(uint32_t theaterId, uint32_t movieId);
+
+        /**
+         * Books the seats: all or none
+         * @return Status::Ok if booked, Status::Rejected if any of the seats is not available or
+         *         std::nullopt if the server does not respond in time
+         */
+        [[nodiscard]]
+        std::optional<Status> bookSeats(uint32_t theaterId, uint32_t movieId, std::span<const uint16_t> seats) noexcept;
+
+    private:
+
+        [[nodiscard]]
+        std::optional<uint32_t> findByName(Opcode opcode, std::string_view name) noexcept;
+
+        Channel* channel { nullptr };
+        /** Mapped by this client: unmapped by the destructor **/
+        void* address { nullptr };
+        uint32_t requestId { 0 };
+    };
+}
+
+#endif //BOOKINGSERVICE_SHAREDMEMORYIPC_H
@@ -0,0 +1,146 @@
+/**
+ * @file       Snapshot.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Immutable versioned snapshots of the Table entries (read-copy-update)
+ */
+
+#ifndef BOOKINGSERVICE_SNAPSHOT_H
+#define BOOKINGSERVICE_SNAPSHOT_H
+
+#include <atomic>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include "EpochDomain.h"
+
+namespace DB
+{
+    /**
+     * @brief Immutable list of the entries: once published it is never modified, only replaced as a whole
+     * @tparam T type of the entries
+     */
+    template<typename T>
+    struct Snapshot
+    {
+        uint64_t version { 0 };
+        std::vector<T*> entries;
+    };
+
+    /**
+     * @brief Read access to the published Snapshot.<br>
+     * Holds the epoch guard, so the snapshot stays valid during the whole lifetime of the view even if
+     * the newer version is published meanwhile. Creating a view does not allocate and does not lock
+     * @note Views are meant to be short-lived: a living view delays the reclamation of the old snapshots
+     */
+    template<typename T>
+    class SnapshotView
+    {
+        Concurrency::EpochDomain::Guard guard;
+        const Snapshot<T>* snapshot { nullptr };
+
+    public:
+
+        SnapshotView(Concurrency::EpochDomain::Guard&& guard, const Snapshot<T>* snapshot) noexcept:
+                guard { std::move(guard) }, snapshot { snapshot } {
+        }
+
+        [[nodiscard]]
+        std::span<T* const> entries() const noexcept {
+            return snapshot->entries;
+        }
+
+        [[nodiscard]]
+        uint64_t version() const noexcept {
+            return snapshot->version;
+        }
+
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return snapshot->entries.size();
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return snapshot->entries.empty();
+        }
+
+        [[nodiscard]]
+        auto begin() const noexcept {
+            return snapshot->entries.cbegin();
+        }
+
+        [[nodiscard]]
+        auto end() const noexcept {
+            return snapshot->entries.cend();
+        }
+    };
+
+    /**
+     * @brief Publishes the Snapshot versions via the atomic pointer swap.<br>
+     * Writers only mark the published snapshot as stale. The new version is built by the first reader
+     * noticing that, so the bulk catalog updates cost a single rebuild. The replaced versions are retired
+     * to the epoch domain and deleted once the last reader leaves them
+     * @tparam T type of the entries
+     */
+    template<typename T>
+    class SnapshotPublisher
+    {
+        std::atomic<const Snapshot<T>*> current { nullptr };
+        std::atomic<bool> stale { true };
+        uint64_t version { 0 };
+        std::mutex mtxPublish;
+
+    public:
+
+        SnapshotPublisher() = default;
+        SnapshotPublisher(const SnapshotPublisher&) = delete;
+        SnapshotPublisher& operator=(const SnapshotPublisher&) = delete;
+
+        ~SnapshotPublisher() {
+            delete current.load(std::memory_order_acquire);
+        }
+
+        /**
+         * Marks the published snapshot as outdated: the next view() call shall publish the new version
+         */
+        void invalidate() noexcept {
+            stale.store(true, std::memory_order_release);
+        }
+
+        /**
+         * Returns the view of the actual snapshot (rebuilding it first, if it is stale)
+         * @param build callable <b>std::vector<T*>()</b> collecting the actual entries
+         */
+        template<typename Builder>
+        SnapshotView<T> view(Builder&& build)
+        {
+            // Entered before the staleness check: the entries removed after the check stay alive for this view
+            Concurrency::EpochDomain::Guard guard;
+            if (stale.load(std::memory_order_acquire))
+                publish(std::forward<Builder>(build));
+
+            return SnapshotView<T> { std::move(guard), current.load(std::memory_order_seq_cst) };
+        }
+
+    private:
+
+        template<typename Builder>
+        void publish(Builder&& build)
+        {
+            std::lock_guard<std::mutex> lock { mtxPublish };
+            // Reset the flag before collecting: the updates made during the build shall trigger the next one
+            if (!stale.exchange(false, std::memory_order_acq_rel))
+                return;
+
+            const auto* snapshot = new Snapshot<T> { ++version, build() };
+            if (const Snapshot<T>* previous = current.exchange(snapshot, std::memory_order_seq_cst); previous)
+                Concurrency::EpochDomain::instance().retire(previous);
+        }
+    };
+}
+
+#endif //BOOKINGSERVICE_SNAPSHOT_H
@@ -0,0 +1,175 @@
+/**
+ * @file       Tracing.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Scoped tracing spans of the requests, exported as the Chrome trace events (chrome://tracing, Perfetto)
+ */
+
+#include "Tracing.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <unistd.h>
+
+namespace
+{
+    /** The spans nesting of the calling thread **/
+    struct ThreadState
+    {
+        uint32_t depth { 0 };
+        bool sampled { false };
+        /** The number of the root spans started: the sampling counter **/
+        uint64_t roots { 0 };
+        Tracing::ThreadBuffer* buffer { nullptr };
+
+        ~ThreadState() {
+            if (nullptr != buffer)
+                Tracing::Tracer::instance().release(buffer);
+        }
+    };
+
+    thread_local ThreadState threadState;
+
+    /** The trace event timestamps are in microseconds: written with the nanoseconds precision **/
+    void writeMicroseconds(std::ostream& output, int64_t nanoseconds)
+    {
+        char buffer[32];
+        const int length = std::snprintf(buffer, sizeof(buffer), "%lld.%03lld",
+                                         static_cast<long long>(nanoseconds / 1000),
+                                         static_cast<long long>(nanoseconds % 1000));
+        output.write(buffer, length);
+    }
+}
+
+namespace Tracing
+{
+    ThreadBuffer::ThreadBuffer(uint32_t threadId): threadId { threadId } {
+        // Allocated once: recording the span never allocates
+        events.resize(capacity);
+    }
+
+    void ThreadBuffer::record(const Event& event)
+    {
+        std::lock_guard<std::mutex> lock { mtxEvents };
+        events[recorded++ % capacity] = event;
+    }
+
+    void ThreadBuffer::collect(std::vector<Event>& collected) const
+    {
+        std::lock_guard<std::mutex> lock { mtxEvents };
+        const size_t count = std::min(recorded, capacity);
+        for (size_t idx = recorded - count; idx < recorded; ++idx)
+            collected.push_back(events[idx % capacity]);
+    }
+
+    void ThreadBuffer::clear() noexcept
+    {
+        std::lock_guard<std::mutex> lock { mtxEvents };
+        recorded = 0;
+    }
+
+    Tracer& Tracer::instance()
+    {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    ThreadBuffer& Tracer::threadBuffer()
+    {
+        ThreadState& thread = threadState;
+        if (nullptr == thread.buffer) {
+            std::lock_guard<std::mutex> lock { mtxBuffers };
+            if (!released.empty()) {
+                thread.buffer = released.back();
+                released.pop_back();
+            } else {
+                thread.buffer = buffers.emplace_back(
+                        std::make_shared<ThreadBuffer>(static_cast<uint32_t>(buffers.size() + 1))).get();
+            }
+        }
+        return *thread.buffer;
+    }
+
+    void Tracer::release(ThreadBuffer* buffer)
+    {
+        std::lock_guard<std::mutex> lock { mtxBuffers };
+        released.push_back(buffer);
+    }
+
+    size_t Tracer::writeChromeTrace(std::ostream& output)
+    {
+        std::vector<std::shared_ptr<ThreadBuffer>> traced;
+        {
+            std::lock_guard<std::mutex> lock { mtxBuffers };
+            traced = buffers;
+        }
+
+        const pid_t pid = ::getpid();
+        size_t written = 0;
+        std::vector<Event> events;
+        events.reserve(ThreadBuffer::capacity);
+
+        output << "{\"traceEvents\":[";
+        for (const std::shared_ptr<ThreadBuffer>& buffer: traced)
+        {
+            events.clear();
+            buffer->collect(events);
+            if (events.empty())
+                continue;
+
+            const uint32_t tid = buffer->getThreadId();
+            output << (0 == written ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+                   << ",\"tid\":" << tid << ",\"args\":{\"name\":\"thread " << tid << "\"}}";
+            for (const Event& event: events) {
+                output << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"booking\",\"ph\":\"X\",\"pid\":" << pid
+                       << ",\"tid\":" << tid << ",\"ts\":";
+                writeMicroseconds(output, event.start);
+                output << ",\"dur\":";
+                writeMicroseconds(output, event.duration);
+                output << '}';
+            }
+            written += events.size();
+        }
+        output << "\n],\"displayTimeUnit\":\"ns\"}\n";
+        return written;
+    }
+
+    void Tracer::clear()
+    {
+        std::lock_guard<std::mutex> lock { mtxBuffers };
+        for (const std::shared_ptr<ThreadBuffer>& buffer: buffers)
+            buffer->clear();
+    }
+
+    void Span::begin(const char* spanName) noexcept
+    {
+        ThreadState& thread = threadState;
+        if (0 == thread.depth) {
+            const uint32_t every = Tracer::getSampling();
+            thread.sampled = 0 != every && 0 == thread.roots++ % every;
+        }
+        ++thread.depth;
+
+        name = spanName;
+        state = thread.sampled ? State::Recording : State::Skipped;
+        if (State::Recording == state)
+            start = Tracer::instance().now();
+    }
+
+    void Span::end() noexcept
+    {
+        --threadState.depth;
+        if (State::Recording != state)
+            return;
+
+        Tracer& tracer = Tracer::instance();
+        const Event event { name, start, tracer.now() - start };
+        try {
+            tracer.threadBuffer().record(event);
+        } catch (...) {
+            // The buffer of the thread can not be registered: the event is dropped
+        }
+    }
+}
@@ -0,0 +1,199 @@
+/**
+ * @file       Tracing.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Scoped tracing spans of the requests, exported as the Chrome trace events (chrome://tracing, Perfetto)
+ */
+
+#ifndef BOOKINGSERVICE_TRACING_H
+#define BOOKINGSERVICE_TRACING_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+//! Request tracing: where the time of the single request goes
+namespace Tracing
+{
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief The completed span: recorded by the thread into its own buffer
+     */
+    struct Event
+    {
+        /** The string literal passed to the Span **/
+        const char* name { nullptr };
+        /** Nanoseconds since the tracer creation **/
+        int64_t start { 0 };
+        int64_t duration { 0 };
+    };
+
+    /**
+     * @brief The spans of a single thread: the ring keeping the latest events.<br>
+     * Written by the owner thread only; the lock is contended only when the trace is being exported
+     */
+    class ThreadBuffer
+    {
+    public:
+
+        /** The number of the latest events kept **/
+        static constexpr size_t capacity { 8192 };
+
+        explicit ThreadBuffer(uint32_t threadId);
+
+        void record(const Event& event);
+
+        /** Appends the events kept, the oldest first **/
+        void collect(std::vector<Event>& events) const;
+
+        void clear() noexcept;
+
+        [[nodiscard]]
+        uint32_t getThreadId() const noexcept {
+            return threadId;
+        }
+
+    private:
+
+        mutable std::mutex mtxEvents;
+        std::vector<Event> events;
+        /** The total number of the events recorded: the next slot is (recorded % capacity) **/
+        size_t recorded { 0 };
+        const uint32_t threadId;
+    };
+
+    /**
+     * @brief The process-wide tracer: the sampling switch and the buffers of all the threads ever traced.<br>
+     * Sampling applies to the root spans (the requests): the nested spans are recorded together with their root,
+     * so the sampled request is always traced completely
+     */
+    class Tracer
+    {
+        /** Every N-th root span of each thread is traced; zero - tracing is disabled **/
+        static inline std::atomic<uint32_t> sampling { 0 };
+
+        const Clock::time_point started { Clock::now() };
+
+        std::mutex mtxBuffers;
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+        /** The buffers of the exited threads: taken by the new threads together with the events kept **/
+        std::vector<ThreadBuffer*> released;
+
+        Tracer() = default;
+
+    public:
+
+        Tracer(const Tracer&) = delete;
+        Tracer& operator=(const Tracer&) = delete;
+
+        /**
+         * Returns the process-wide tracer instance
+         */
+        static Tracer& instance();
+
+        /**
+         * Checks the sampling switch: the only cost of the Span while the tracing is disabled
+         */
+        [[nodiscard]]
+        static bool isEnabled() noexcept {
+            return 0 != sampling.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Switches the tracing at runtime
+         * @param every trace every N-th request of each thread (1 - all of them, 0 - disable the tracing)
+         */
+        static void setSampling(uint32_t every) noexcept {
+            sampling.store(every, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]]
+        static uint32_t getSampling() noexcept {
+            return sampling.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Returns the nanoseconds since the tracer creation: the timestamp of the events
+         */
+        [[nodiscard]]
+        int64_t now() const noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - started).count();
+        }
+
+        /**
+         * Returns the buffer of the calling thread: registered on the first use, outlives the thread
+         */
+        ThreadBuffer& threadBuffer();
+
+        /**
+         * Called on the thread exit: the buffer is reused by the next thread traced, so the thread-per-request
+         * clients do not grow the buffers list (the reusing threads share the same <i>tid</i> in the trace)
+         */
+        void release(ThreadBuffer* buffer);
+
+        /**
+         * Writes the events of all the threads in the Chrome trace event format (JSON object format)
+         * @return the number of the events written
+         * @note The spans may be recorded meanwhile: those completed after the buffer is copied are not written
+         */
+        size_t writeChromeTrace(std::ostream& output);
+
+        /**
+         * Drops the events recorded so far
+         */
+        void clear();
+    };
+
+    /**
+     * @brief The scoped span: records the time from its construction till its destruction.<br>
+     * The outermost span of the thread is the root (the request): the sampling decision is made by it.
+     * While the tracing is disabled the span costs a single relaxed load and a branch
+     * @note The name is stored by the pointer: shall be a string literal
+     */
+    class Span
+    {
+    public:
+
+        explicit Span(const char* name) noexcept
+        {
+            if (Tracer::isEnabled()) [[unlikely]]
+                begin(name);
+        }
+
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+
+        ~Span()
+        {
+            if (State::Off != state) [[unlikely]]
+                end();
+        }
+
+    private:
+
+        enum class State : uint8_t
+        {
+            /** Tracing was disabled when the span started **/
+            Off,
+            /** Not sampled: only keeps the nested spans from being recorded **/
+            Skipped,
+            Recording
+        };
+
+        void begin(const char* spanName) noexcept;
+        void end() noexcept;
+
+        const char* name { nullptr };
+        int64_t start { 0 };
+        State state { State::Off };
+    };
+}
+
+#endif //BOOKINGSERVICE_TRACING_H
@@ -0,0 +1,257 @@
+/**
+ * @file       Trending.cpp
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Trending movies and theaters: the streaming heavy hitters over the recent bookings
+ */
+
+#include "Trending.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <optional>
+#include <unordered_set>
+#include <utility>
+
+namespace
+{
+    /** The multiply-add hash parameters of the sketch rows: odd multipliers (the rows hash independently) **/
+    constexpr std::array<std::pair<uint64_t, uint64_t>, 8> rowHashes {{
+        { 0x9E3779B97F4A7C15ull, 0x7F4A7C159E3779B9ull }, { 0xBF58476D1CE4E5B9ull, 0x94D049BB133111EBull },
+        { 0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull }, { 0xD6E8FEB86659FD93ull, 0xA0761D6478BD642Full },
+        { 0xE7037ED1A0B428DBull, 0x8EBC6AF09C88C6E3ull }, { 0x589965CC75374CC3ull, 0x1D8E4E27C47D124Full },
+        { 0xF1357AEA2E62A9C5ull, 0x2545F4914F6CDD1Dull }, { 0xAEF17502108EF2D9ull, 0x3C6EF372FE94F82Bull }
+    }};
+
+    std::atomic<size_t> threadsCount { 0 };
+}
+
+namespace Booking
+{
+    CountMinSketch::CountMinSketch(size_t width, size_t depth):
+            width { std::bit_ceil(std::max<size_t>(width, 2)) },
+            depth { std::clamp<size_t>(depth, 1, rowHashes.size()) },
+            shift { 64 - static_cast<size_t>(std::countr_zero(this->width)) },
+            counters(this->width * this->depth, 0) {
+    }
+
+    size_t CountMinSketch::column(size_t row, uint64_t key) const noexcept
+    {
+        const auto& [multiplier, increment] = rowHashes[row];
+        return static_cast<size_t>((key * multiplier + increment) >> shift);
+    }
+
+    void CountMinSketch::add(uint64_t key, uint32_t count) noexcept
+    {
+        for (size_t row = 0; row < depth; ++row)
+            counters[row * width + column(row, key)] += count;
+    }
+
+    uint64_t CountMinSketch::estimate(uint64_t key) const noexcept
+    {
+        uint64_t minimum = std::numeric_limits<uint64_t>::max();
+        for (size_t row = 0; row < depth; ++row)
+            minimum = std::min<uint64_t>(minimum, counters[row * width + column(row, key)]);
+        return minimum;
+    }
+
+    uint64_t CountMinSketch::estimate(std::span<const CountMinSketch* const> sketches, uint64_t key) noexcept
+    {
+        if (sketches.empty())
+            return 0;
+
+        const CountMinSketch& first = *sketches.front();
+        uint64_t minimum = std::numeric_limits<uint64_t>::max();
+        for (size_t row = 0; row < first.depth; ++row)
+        {
+            const size_t counterIdx = row * first.width + first.column(row, key);
+            uint64_t sum = 0;
+            for (const CountMinSketch* sketch: sketches)
+                sum += sketch->counters[counterIdx];
+            minimum = std::min(minimum, sum);
+        }
+        return minimum;
+    }
+
+    void CountMinSketch::clear() noexcept
+    {
+        std::fill(counters.begin(), counters.end(), 0);
+    }
+
+    SpaceSaving::SpaceSaving(size_t capacity): capacity { std::max<size_t>(capacity, 1) }
+    {
+        keys.reserve(this->capacity);
+        counts.reserve(this->capacity);
+        errors.reserve(this->capacity);
+    }
+
+    void SpaceSaving::add(uint64_t key, uint32_t count) noexcept
+    {
+        if (const auto position = std::find(keys.begin(), keys.end(), key); keys.end() != position) {
+            counts[static_cast<size_t>(position - keys.begin())] += count;
+            return;
+        }
+
+        if (keys.size() < capacity) {
+            keys.push_back(key);
+            counts.push_back(count);
+            errors.push_back(0);
+            return;
+        }
+
+        // The least counted key is evicted: the new one might have been counted that many times before
+        const size_t idx = static_cast<size_t>(std::min_element(counts.begin(), counts.end()) - counts.begin());
+        keys[idx] = key;
+        errors[idx] = counts[idx];
+        counts[idx] += count;
+    }
+
+    std::vector<SpaceSaving::Counter> SpaceSaving::getCounters() const
+    {
+        std::vector<Counter> counters;
+        counters.reserve(keys.size());
+        for (size_t idx = 0; idx < keys.size(); ++idx)
+            counters.push_back(Counter { keys[idx], counts[idx], errors[idx] });
+        return counters;
+    }
+
+    void SpaceSaving::clear() noexcept
+    {
+        keys.clear();
+        counts.clear();
+        errors.clear();
+    }
+
+    TrendingTracker::Bucket::Bucket(const Config& config):
+            sketches { CountMinSketch { config.sketchWidth, config.sketchDepth },
+                       CountMinSketch { config.sketchWidth, config.sketchDepth } },
+            candidates { SpaceSaving { config.candidatesMax }, SpaceSaving { config.candidatesMax } } {
+    }
+
+    TrendingTracker::TrendingTracker(): TrendingTracker { Config {} } {
+    }
+
+    TrendingTracker::TrendingTracker(const Config& config):
+            config { config },
+            bucketDuration { std::max<Clock::duration>(config.window / std::max<size_t>(config.bucketsCount, 1),
+                                                       Clock::duration { 1 }) }
+    {
+        stripes.reserve(stripesCount);
+        for (size_t idx = 0; idx < stripesCount; ++idx)
+            stripes.push_back(std::make_unique<Stripe>(config.stripeCapacity));
+        buckets.reserve(std::max<size_t>(config.bucketsCount, 1));
+        for (size_t idx = 0; idx < buckets.capacity(); ++idx)
+            buckets.emplace_back(config);
+    }
+
+    void TrendingTracker::recordBooking(size_t movieId, size_t theaterId, Clock::time_point now) noexcept
+    {
+        thread_local const size_t threadIdx = threadsCount.fetch_add(1, std::memory_order_relaxed);
+        Stripe& stripe = *stripes[threadIdx % stripesCount];
+        const Event event { movieId, theaterId, now.time_since_epoch().count() };
+        if (stripe.events.tryPush(Event { event }))
+            return;
+
+        // The stripe is full: drained by the booking thread itself, unless someone is draining already
+        if (std::unique_lock<std::mutex> lock { mtxWindow, std::try_to_lock }; lock.owns_lock())
+            drain();
+        if (!stripe.events.tryPush(Event { event }))
+            dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void TrendingTracker::drain() noexcept
+    {
+        for (const std::unique_ptr<Stripe>& stripe: stripes)
+        {
+            while (const std::optional<Event> event = stripe->events.tryPop())
+            {
+                const int64_t epoch = epochOf(event->time);
+                Bucket& bucket = buckets[static_cast<size_t>(epoch) % buckets.size()];
+                if (bucket.epoch > epoch)
+                    continue;   // Older than the window already
+                if (bucket.epoch < epoch) {
+                    bucket.epoch = epoch;
+                    bucket.total = 0;
+                    for (CountMinSketch& sketch: bucket.sketches)
+                        sketch.clear();
+                    for (SpaceSaving& candidates: bucket.candidates)
+                        candidates.clear();
+                }
+
+                const uint64_t movieKey = makeKey(Kind::Movie, event->movieId);
+                const uint64_t theaterKey = makeKey(Kind::Theater, event->theaterId);
+                ++bucket.total;
+                bucket.sketches[static_cast<size_t>(Kind::Movie)].add(movieKey);
+                bucket.sketches[static_cast<size_t>(Kind::Theater)].add(theaterKey);
+                bucket.candidates[static_cast<size_t>(Kind::Movie)].add(movieKey);
+                bucket.candidates[static_cast<size_t>(Kind::Theater)].add(theaterKey);
+            }
+        }
+    }
+
+    std::vector<const TrendingTracker::Bucket*> TrendingTracker::windowBuckets(Clock::time_point now) const
+    {
+        const int64_t epochNow = epochOf(now.time_since_epoch().count());
+        std::vector<const Bucket*> window;
+        for (const Bucket& bucket: buckets)
+            if (bucket.epoch >= 0 && bucket.epoch <= epochNow &&
+                epochNow - bucket.epoch < static_cast<int64_t>(buckets.size()))
+                window.push_back(&bucket);
+        return window;
+    }
+
+    std::vector<TrendingEntry> TrendingTracker::top(Kind kind, size_t limit, Clock::time_point now)
+    {
+        std::lock_guard<std::mutex> lock { mtxWindow };
+        drain();
+
+        const std::vector<const Bucket*> window = windowBuckets(now);
+        std::vector<const CountMinSketch*> sketches;
+        std::unordered_set<uint64_t> keys;
+        for (const Bucket* bucket: window) {
+            sketches.push_back(&bucket->sketches[static_cast<size_t>(kind)]);
+            for (const SpaceSaving::Counter& counter: bucket->candidates[static_cast<size_t>(kind)].getCounters())
+                keys.insert(counter.key);
+        }
+
+        const uint64_t kindKey = makeKey(kind, 0);
+        std::vector<TrendingEntry> entries;
+        entries.reserve(keys.size());
+        for (const uint64_t key: keys)
+            entries.push_back(TrendingEntry { static_cast<size_t>(key - kindKey),
+                                              CountMinSketch::estimate(sketches, key) });
+
+        const size_t count = std::min(limit, entries.size());
+        std::partial_sort(entries.begin(), entries.begin() + static_cast<std::ptrdiff_t>(count), entries.end(),
+                          [](const TrendingEntry& left, const TrendingEntry& right) {
+            return left.bookings > right.bookings || (left.bookings == right.bookings && left.id < right.id);
+        });
+        entries.resize(count);
+        return entries;
+    }
+
+    uint64_t TrendingTracker::estimate(Kind kind, size_t id, Clock::time_point now)
+    {
+        std::lock_guard<std::mutex> lock { mtxWindow };
+        drain();
+
+        std::vector<const CountMinSketch*> sketches;
+        for (const Bucket* bucket: windowBuckets(now))
+            sketches.push_back(&bucket->sketches[static_cast<size_t>(kind)]);
+        return CountMinSketch::estimate(sketches, makeKey(kind, id));
+    }
+
+    uint64_t TrendingTracker::getWindowTotal(Clock::time_point now)
+    {
+        std::lock_guard<std::mutex> lock { mtxWindow };
+        drain();
+
+        uint64_t total = 0;
+        for (const Bucket* bucket: windowBuckets(now))
+            total += bucket->total;
+        return total;
+    }
+}
@@ -0,0 +1,280 @@
+/**
+ * @file       Trending.h
+ * @date       18.10.2026
+ * @author     Andrei Tokmakov
+ * @version    1.0
+ * @copyright  Your copyright notice
+ * @brief      Trending movies and theaters: the streaming heavy hitters over the recent bookings
+ */
+
+#ifndef BOOKINGSERVICE_TRENDING_H
+#define BOOKINGSERVICE_TRENDING_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include "Concurrency.h"
+#include "MpscQueue.h"
+
+namespace Booking
+{
+    /**
+     * @brief Count-min sketch: the approximate counts of the keys in the fixed memory (depth rows of width counters).
+     * <br> The estimate is never less than the true count and, with the probability of at least 1 - e^(-depth),
+     * exceeds it by not more than e / width * N, where N is the total count added
+     */
+    class CountMinSketch
+    {
+        size_t width;
+        size_t depth;
+        /** The width is the power of two: the hash is the top bits of the multiply-add **/
+        size_t shift;
+        std::vector<uint32_t> counters;
+
+    public:
+
+        /**
+         * Constructor
+         * @param width the counters per row (rounded up to the power of two): the error bound
+         * @param depth the number of rows (up to 8): the confidence of the bound
+         */
+        CountMinSketch(size_t width, size_t depth);
+
+        void add(uint64_t key, uint32_t count = 1) noexcept;
+
+        [[nodiscard]]
+        uint64_t estimate(uint64_t key) const noexcept;
+
+        /**
+         * Returns the estimate of the key in the union of the sketches (of the same dimensions): the rows are summed
+         * before taking the minimum, so the bound is e / width * (the total of all the sketches)
+         */
+        [[nodiscard]]
+        static uint64_t estimate(std::span<const CountMinSketch* const> sketches, uint64_t key) noexcept;
+
+        void clear() noexcept;
+
+        [[nodiscard]]
+        size_t getWidth() const noexcept {
+            return width;
+        }
+
+        [[nodiscard]]
+        size_t getDepth() const noexcept {
+            return depth;
+        }
+
+    private:
+
+        [[nodiscard]]
+        size_t column(size_t row, uint64_t key) const noexcept;
+    };
+
+    /**
+     * @brief Space-saving summary: the capacity most frequent keys (Metwally et al).<br>
+     * When full, the new key replaces the least counted one and inherits its count as the error: every key counted
+     * more than N / capacity times is in the summary, and its count exceeds the true one by not more than N / capacity.
+     * The counters are scanned linearly: for the tens of keys it beats the hash map and never allocates
+     */
+    class SpaceSaving
+    {
+    public:
+
+        struct Counter
+        {
+            uint64_t key { 0 };
+            uint64_t count { 0 };
+            /** The count inherited from the replaced key: the true count is within [count - error, count] **/
+            uint64_t error { 0 };
+        };
+
+        explicit SpaceSaving(size_t capacity);
+
+        void add(uint64_t key, uint32_t count = 1) noexcept;
+
+        /**
+         * Returns the counters of the keys monitored (not more than the capacity), in no particular order
+         */
+        [[nodiscard]]
+        std::vector<Counter> getCounters() const;
+
+        [[nodiscard]]
+        size_t size() const noexcept {
+            return keys.size();
+        }
+
+        void clear() noexcept;
+
+    private:
+
+        size_t capacity;
+
+        /** Struct-of-arrays: the key and the minimum searches scan the dense arrays (vectorized) **/
+        std::vector<uint64_t> keys;
+        std::vector<uint64_t> counts;
+        std::vector<uint64_t> errors;
+    };
+
+    /**
+     * @brief The entry of the trending list
+     */
+    struct TrendingEntry
+    {
+        /** The Movie or Theater ID **/
+        size_t id { 0 };
+
+        /** The estimated number of the bookings in the window: never less than the true one **/
+        uint64_t bookings { 0 };
+    };
+
+    /**
+     * @brief The trending movies and theaters: the top-k by the bookings in the sliding window.<br>
+     * The window is split into the buckets of the equal duration, each with the count-min sketch and the
+     * space-saving summary per kind: the buckets expire as a whole, so the window spans between (window - bucket) and window.
+     * The top-k candidates are the keys of the summaries of the window buckets, ranked by the sketches estimates.
+     * <br> The booking path never locks: the thread queues the booking to its home stripe (a lock-free queue on its
+     * own cache lines), the stripes are drained into the window by the queries
+     */
+    class TrendingTracker
+    {
+    public:
+
+        using Clock = std::chrono::steady_clock;
+
+        enum class Kind : uint8_t
+        {
+            Movie,
+            Theater
+        };
+
+        struct Config
+        {
+            std::chrono::seconds window { 300 };
+            size_t bucketsCount { 10 };
+
+            /** The sketch error bound: e / sketchWidth of the bookings in the window (~0.13% by default).
+             *  The movies and the theaters have their own sketches of that width **/
+            size_t sketchWidth { 2'048 };
+
+            /** The probability the bound is exceeded: e^(-sketchDepth) (~1.8% by default) **/
+            size_t sketchDepth { 4 };
+
+            /** The keys monitored per bucket: the key with more than 1 / candidatesMax of the bookings of the
+             *  window is never missed **/
+            size_t candidatesMax { 64 };
+
+            /** The bookings queued per stripe before the booking thread drains the stripes itself **/
+            size_t stripeCapacity { 256 };
+        };
+
+        TrendingTracker();
+        explicit TrendingTracker(const Config& config);
+
+        TrendingTracker(const TrendingTracker&) = delete;
+        TrendingTracker& operator=(const TrendingTracker&) = delete;
+
+        /**
+         * Counts the booking of the movie in the theater
+         * @note Lock-free, unless the stripe of the thread is full: then the thread drains the stripes, if no one else
+         * does. The booking is dropped (see getDropped()) only if the stripe is still full after that
+         */
+        void recordBooking(size_t movieId, size_t theaterId, Clock::time_point now = Clock::now()) noexcept;
+
+        /**
+         * Returns the top-k movies or theaters by the bookings in the window
+         * @return the entries ordered by the bookings estimated (descending)
+         */
+        [[nodiscard]]
+        std::vector<TrendingEntry> top(Kind kind, size_t limit, Clock::time_point now = Clock::now());
+
+        /**
+         * Returns the estimated number of the bookings of the movie or theater in the window
+         */
+        [[nodiscard]]
+        uint64_t estimate(Kind kind, size_t id, Clock::time_point now = Clock::now());
+
+        /**
+         * Returns the number of the bookings in the window: the error bounds are relative to it
+         */
+        [[nodiscard]]
+        uint64_t getWindowTotal(Clock::time_point now = Clock::now());
+
+        /**
+         * Returns the number of the bookings not counted: the stripes were full
+         */
+        [[nodiscard]]
+        uint64_t getDropped() const noexcept {
+            return dropped.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]]
+        const Config& getConfig() const noexcept {
+            return config;
+        }
+
+    private:
+
+        struct Event
+        {
+            size_t movieId { 0 };
+            size_t theaterId { 0 };
+            Clock::rep time { 0 };
+        };
+
+        struct alignas(Concurrency::cacheLineSize) Stripe
+        {
+            explicit Stripe(size_t capacity): events { capacity } {
+            }
+
+            Concurrency::MpscQueue<Event> events;
+        };
+
+        struct Bucket
+        {
+            explicit Bucket(const Config& config);
+
+            /** The bucket number since the Clock epoch: the bucket is reused for the newer one **/
+            int64_t epoch { -1 };
+            uint64_t total { 0 };
+            /** Per kind: each booking adds a key of both kinds, the bound of the kind is relative to the bookings **/
+            std::array<CountMinSketch, 2> sketches;
+            std::array<SpaceSaving, 2> candidates;
+        };
+
+        static constexpr size_t stripesCount { 16 };
+
+        [[nodiscard]]
+        static uint64_t makeKey(Kind kind, size_t id) noexcept {
+            return (static_cast<uint64_t>(kind) << 56) | id;
+        }
+
+        [[nodiscard]]
+        int64_t epochOf(Clock::rep time) const noexcept {
+            return static_cast<int64_t>(time / bucketDuration.count());
+        }
+
+        /** Moves the queued bookings into the window buckets. Shall be called under the mtxWindow lock **/
+        void drain() noexcept;
+
+        /** The buckets of the window ending at the time. Shall be called under the mtxWindow lock **/
+        [[nodiscard]]
+        std::vector<const Bucket*> windowBuckets(Clock::time_point now) const;
+
+        const Config config;
+        const Clock::duration bucketDuration;
+
+        std::vector<std::unique_ptr<Stripe>> stripes;
+        std::atomic<uint64_t> dropped { 0 };
+
+        std::mutex mtxWindow;
+        std::vector<Bucket> buckets;
+    };
+}
+
+#endif //BOOKINGSERVICE_TRENDING_H
@@ -26,6 +26,7 @@ int main([[maybe_unused]] int argc,
 {
     Booking::BookingService service;
     service.initialize();
+    service.startRepricing();
 
     CLI::SimpleCLI cli (service);
     cli.start();
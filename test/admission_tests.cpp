@@ -0,0 +1,179 @@
+/**============================================================================
+Name        : admission_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Admission control tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <vector>
+
+#include "Admission.h"
+#include "CLI.h"
+
+#define CHECK_CONTAINS(str, txt)   BOOST_CHECK_NE(str.find(txt), std::string::npos);
+
+using namespace Admission;
+using namespace std::chrono_literals;
+
+namespace
+{
+    Config testConfig()
+    {
+        Config config;
+        config.regular = RateLimit { 10, 5 };
+        config.priority = RateLimit { 100, 50 };
+        config.concurrencyLimit = 16 * ConcurrencyLimiter::stripesCount;
+        config.regularShare = 0.5;
+        config.clientsCapacity = 1024;
+        return config;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(AdmissionTests)
+
+    BOOST_AUTO_TEST_CASE(RateLimit_Burst_ThenRefill)
+    {
+        AdmissionController admission { testConfig() };
+        const Clock::time_point now = Clock::now();
+        for (size_t idx = 0; idx < 5; ++idx)
+            BOOST_CHECK(admission.admit(1, Lane::Regular, now));
+        BOOST_CHECK(Verdict::RateLimited == admission.admit(1, Lane::Regular, now).getVerdict());
+
+        // 10 requests per second: the single token is back in 100ms
+        BOOST_CHECK(admission.admit(1, Lane::Regular, now + 100ms));
+        BOOST_CHECK(!admission.admit(1, Lane::Regular, now + 100ms));
+    }
+
+    BOOST_AUTO_TEST_CASE(RateLimit_ClientsAreIndependent)
+    {
+        AdmissionController admission { testConfig() };
+        const Clock::time_point now = Clock::now();
+        for (size_t idx = 0; idx < 5; ++idx)
+            BOOST_REQUIRE(admission.admit(1, Lane::Regular, now));
+        BOOST_CHECK(!admission.admit(1, Lane::Regular, now));
+
+        for (uint64_t clientId = 2; clientId < 2'000; ++clientId)
+            BOOST_REQUIRE(admission.admit(clientId, Lane::Regular, now));
+    }
+
+    BOOST_AUTO_TEST_CASE(RateLimit_PriorityLane)
+    {
+        AdmissionController admission { testConfig() };
+        const Clock::time_point now = Clock::now();
+        for (size_t idx = 0; idx < 50; ++idx)
+            BOOST_CHECK(admission.admit(7, Lane::Priority, now));
+        BOOST_CHECK(!admission.admit(7, Lane::Priority, now));
+
+        const Statistics statistics = admission.getStatistics();
+        BOOST_CHECK_EQUAL(statistics.admitted, 50);
+        BOOST_CHECK_EQUAL(statistics.rateLimited, 1);
+        BOOST_CHECK_EQUAL(statistics.inFlight, 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(ConcurrencyLimit_ShedsRegularFirst)
+    {
+        const Config config = testConfig();
+        AdmissionController admission { config };
+        const Clock::time_point now = Clock::now();
+
+        // Hold the permits: the regular lane gets only its share of the limit
+        std::vector<Permit> permits;
+        for (uint64_t clientId = 0; ; ++clientId) {
+            Permit permit = admission.admit(clientId, Lane::Regular, now);
+            if (!permit) {
+                BOOST_CHECK(Verdict::Shed == permit.getVerdict());
+                break;
+            }
+            permits.push_back(std::move(permit));
+        }
+        BOOST_CHECK_EQUAL(permits.size(), config.concurrencyLimit / 2);
+
+        // The rest is reserved for the confirmed customers
+        for (uint64_t clientId = 10'000; ; ++clientId) {
+            Permit permit = admission.admit(clientId, Lane::Priority, now);
+            if (!permit)
+                break;
+            permits.push_back(std::move(permit));
+        }
+        BOOST_CHECK_EQUAL(permits.size(), config.concurrencyLimit);
+        BOOST_CHECK_EQUAL(admission.getStatistics().inFlight, config.concurrencyLimit);
+
+        // The completed requests return their permits
+        permits.clear();
+        BOOST_CHECK_EQUAL(admission.getStatistics().inFlight, 0);
+        BOOST_CHECK(admission.admit(20'000, Lane::Regular, now));
+    }
+
+    BOOST_AUTO_TEST_CASE(ConcurrencyLimit_Exact)
+    {
+        // Not a multiple of the stripes: the quotas of the stripes add up to the limit
+        for (const size_t limit: {size_t { 10 }, size_t { 37 }}) {
+            ConcurrencyLimiter limiter { limit, 0.8 };
+            std::vector<size_t> permits;
+            for (size_t stripeIdx = limiter.tryAcquire(Lane::Priority); ConcurrencyLimiter::stripesCount != stripeIdx;
+                 stripeIdx = limiter.tryAcquire(Lane::Priority))
+                permits.push_back(stripeIdx);
+            BOOST_CHECK_EQUAL(permits.size(), limit);
+            for (const size_t stripeIdx: permits)
+                limiter.release(stripeIdx);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(ConcurrencyLimit_SmallLimit_PriorityReserved)
+    {
+        Config config = testConfig();
+        config.concurrencyLimit = 10;
+        config.regularShare = 0.8;
+        AdmissionController admission { config };
+        const Clock::time_point now = Clock::now();
+
+        std::vector<Permit> permits;
+        for (uint64_t clientId = 0; ; ++clientId) {
+            Permit permit = admission.admit(clientId, Lane::Regular, now);
+            if (!permit)
+                break;
+            permits.push_back(std::move(permit));
+        }
+        BOOST_CHECK_EQUAL(permits.size(), 8);
+
+        for (uint64_t clientId = 10'000; ; ++clientId) {
+            Permit permit = admission.admit(clientId, Lane::Priority, now);
+            if (!permit)
+                break;
+            permits.push_back(std::move(permit));
+        }
+        BOOST_CHECK_EQUAL(permits.size(), 10);
+        BOOST_CHECK_EQUAL(admission.getStatistics().inFlight, 10);
+    }
+
+    BOOST_AUTO_TEST_CASE(CLI_RateLimited)
+    {
+        Booking::BookingService service;
+        service.initialize();
+        std::stringstream output;
+        CLI::SimpleCLI cli { service, output };
+
+        Config config = testConfig();
+        config.regular = RateLimit { 0.001, 2 };
+        AdmissionController admission { config };
+        cli.setAdmission(admission, 42);
+
+        BOOST_CHECK(CLI::SimpleCLI::Status::Continue == cli.processCommand("list_movies"));
+        BOOST_CHECK(CLI::SimpleCLI::Status::Continue == cli.processCommand("list_theaters"));
+        CHECK_CONTAINS(output.str(), "4DX");
+
+        output.str("");
+        BOOST_CHECK(CLI::SimpleCLI::Status::Continue == cli.processCommand("select_theater 4DX"));
+        CHECK_CONTAINS(output.str(), "Too many requests: please retry later");
+        BOOST_CHECK_EQUAL(output.str().find("theater is chosen"), std::string::npos);
+
+        // The session control commands are never limited
+        BOOST_CHECK(CLI::SimpleCLI::Status::Stop == cli.processCommand("q"));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
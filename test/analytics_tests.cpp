@@ -0,0 +1,158 @@
+/**============================================================================
+Name        : analytics_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Occupancy analytics tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+
+#include "BookingService.h"
+#include "OccupancyAnalytics.h"
+#include "CLI.h"
+
+#define CHECK_CONTAINS(str, txt)   BOOST_CHECK_NE(str.find(txt), std::string::npos);
+
+using namespace Booking;
+
+namespace
+{
+    struct AnalyticsFixture
+    {
+        BookingService service;
+        OccupancyAnalytics analytics { service };
+
+        AnalyticsFixture()
+        {
+            service.initialize();
+            BOOST_REQUIRE(service.getPremiere("4DX", "Fight Club").value()->bookSeats({1, 2, 3}));
+            BOOST_REQUIRE(service.getPremiere("4DX", "Terminator").value()->bookSeatsCombined({4, 5}));
+            BOOST_REQUIRE(service.getPremiere("Odeon", "Inception").value()->bookSeats({20}));
+        }
+
+        [[nodiscard]]
+        static const OccupancyRow& find(const std::vector<OccupancyRow>& rows, size_t id)
+        {
+            const auto iter = std::find_if(rows.cbegin(), rows.cend(), [id](const auto& row) { return row.id == id; });
+            BOOST_REQUIRE(rows.cend() != iter);
+            return *iter;
+        }
+    };
+}
+
+BOOST_FIXTURE_TEST_SUITE(OccupancyAnalyticsTests, AnalyticsFixture)
+
+    BOOST_AUTO_TEST_CASE(SeatsBitmap_MirrorsSeats)
+    {
+        const Premiere* premiere = service.getPremiere("4DX", "Fight Club").value();
+        BOOST_CHECK_EQUAL(premiere->seatsBooked.load(), 0b111u);
+
+        // The failed booking is rolled back: the bitmap does not change
+        Premiere* terminator = service.getPremiere("4DX", "Terminator").value();
+        BOOST_CHECK_EQUAL(terminator->bookSeatsCombined({6, 5}), false);
+        BOOST_CHECK_EQUAL(terminator->seatsBooked.load(), 0b11000u);
+    }
+
+    BOOST_AUTO_TEST_CASE(Aggregate_ByTheater)
+    {
+        const OccupancySnapshot snapshot = analytics.capture();
+        const std::vector<OccupancyRow> rows = OccupancyAnalytics::aggregate(snapshot,
+                                                                             OccupancyAnalytics::GroupBy::Theater);
+
+        BOOST_CHECK_EQUAL(rows.size(), 3);
+        const OccupancyRow& fourDX = find(rows, service.findTheater("4DX").value()->id);
+        BOOST_CHECK_EQUAL(fourDX.premieres, 3);
+        BOOST_CHECK_EQUAL(fourDX.seatsBooked, 5);
+        BOOST_CHECK_EQUAL(fourDX.seatsTotal, 3 * Theater::seatsCapacityMax);
+
+        const OccupancyRow& electric = find(rows, service.findTheater("Electric Cinema").value()->id);
+        BOOST_CHECK_EQUAL(electric.seatsBooked, 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(Aggregate_ByMovie)
+    {
+        const OccupancySnapshot snapshot = analytics.capture();
+        const std::vector<OccupancyRow> rows = OccupancyAnalytics::aggregate(snapshot,
+                                                                             OccupancyAnalytics::GroupBy::Movie);
+
+        BOOST_CHECK_EQUAL(rows.size(), 4);
+        const OccupancyRow& fightClub = find(rows, service.findMovie("Fight Club").value()->id);
+        BOOST_CHECK_EQUAL(fightClub.premieres, 2);
+        BOOST_CHECK_EQUAL(fightClub.seatsBooked, 3);
+        BOOST_CHECK_CLOSE(fightClub.ratio(), 3.0 / (2 * Theater::seatsCapacityMax), 0.001);
+    }
+
+    BOOST_AUTO_TEST_CASE(Total_AndTimeline)
+    {
+        const OccupancyRow before = OccupancyAnalytics::total(analytics.capture());
+        BOOST_CHECK_EQUAL(before.premieres, 5);
+        BOOST_CHECK_EQUAL(before.seatsBooked, 6);
+
+        BOOST_REQUIRE(service.getPremiere("Electric Cinema", "Fight Club").value()->bookSeats({7, 8}));
+        [[maybe_unused]] const OccupancySnapshot after = analytics.capture();
+
+        BOOST_REQUIRE_EQUAL(analytics.timeline().size(), 2);
+        BOOST_CHECK_EQUAL(analytics.timeline().front().total.seatsBooked, 6);
+        BOOST_CHECK_EQUAL(analytics.timeline().back().total.seatsBooked, 8);
+    }
+
+    BOOST_AUTO_TEST_CASE(Capture_DoesNotWaitForBookings)
+    {
+        // The booking in progress holds the premiere lock: the capture shall not need it
+        const Premiere* premiere = service.getPremiere("4DX", "Fight Club").value();
+        std::lock_guard<std::mutex> lock { premiere->mtxBooking };
+        BOOST_CHECK_EQUAL(OccupancyAnalytics::total(analytics.capture()).seatsBooked, 6);
+    }
+
+    BOOST_AUTO_TEST_CASE(Aggregate_LargeSchedule_Parallel)
+    {
+        BookingService large;
+        large.addMovie("Movie");
+        for (size_t idx = 0; idx < 100; ++idx) {
+            large.addTheater("Theater " + std::to_string(idx));
+            for (size_t show = 0; show < 500; ++show)
+                large.scheduleMovie("Movie", "Theater " + std::to_string(idx));
+        }
+        for (size_t idx = 0; idx < large.bookingSchedule.size(); idx += 2)
+            BOOST_REQUIRE(large.bookingSchedule[idx].bookSeats({1}));
+
+        OccupancyAnalytics largeAnalytics { large };
+        const OccupancySnapshot snapshot = largeAnalytics.capture();
+        const std::vector<OccupancyRow> rows = OccupancyAnalytics::aggregate(snapshot,
+                                                                             OccupancyAnalytics::GroupBy::Theater);
+        BOOST_CHECK_EQUAL(rows.size(), 100);
+        for (const OccupancyRow& row: rows) {
+            BOOST_CHECK_EQUAL(row.premieres, 500);
+            BOOST_CHECK_EQUAL(row.seatsBooked, 250);
+        }
+        BOOST_CHECK_EQUAL(OccupancyAnalytics::total(snapshot).seatsBooked, 25'000);
+    }
+
+    BOOST_AUTO_TEST_CASE(CLI_OccupancyReport)
+    {
+        std::stringstream output;
+        CLI::SimpleCLI cli { service, output };
+
+        BOOST_CHECK(CLI::SimpleCLI::Status::Continue == cli.processCommand("occupancy_report"));
+        CHECK_CONTAINS(output.str(), "Occupancy by theater:");
+        CHECK_CONTAINS(output.str(), "4DX: 5/60 seats booked (8.3%)");
+        CHECK_CONTAINS(output.str(), "Total: 6/100 seats booked (6.0%)");
+
+        BOOST_REQUIRE(service.getPremiere("Electric Cinema", "Fight Club").value()->bookSeats({7, 8}));
+        output.str("");
+        BOOST_CHECK(CLI::SimpleCLI::Status::Continue == cli.processCommand("occupancy_report movie"));
+        CHECK_CONTAINS(output.str(), "Occupancy by movie:");
+        CHECK_CONTAINS(output.str(), "Fight Club: 5/40 seats booked (12.5%)");
+        CHECK_CONTAINS(output.str(), "+2 seats since the previous report");
+
+        output.str("");
+        BOOST_CHECK(CLI::SimpleCLI::Status::Continue == cli.processCommand("occupancy_report seats"));
+        CHECK_CONTAINS(output.str(), "Incorrect grouping");
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,129 @@
+/**============================================================================
+Name        : async_service_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : AsyncBookingService (coroutines API) tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+#include <future>
+
+#include "AsyncBookingService.h"
+
+using namespace Booking;
+
+namespace
+{
+    struct AsyncFixture
+    {
+        BookingService service;
+        Async::Executor executor;
+        AsyncBookingService asyncService { service, executor };
+
+        AsyncFixture()
+        {
+            service.addMovie("Fight Club");
+            service.addMovie("Inception");
+            service.addTheater("4DX");
+            service.addTheater("Odeon");
+            service.scheduleMovie("Fight Club", "4DX");
+            service.scheduleMovie("Inception", "Odeon");
+        }
+    };
+}
+
+BOOST_FIXTURE_TEST_SUITE(AsyncServiceTests, AsyncFixture)
+
+    BOOST_AUTO_TEST_CASE(CatalogQueries)
+    {
+        size_t moviesCount = 0, theatersCount = 0;
+        executor.spawn(asyncService.getMovies(), [&](const auto& movies) { moviesCount = movies.size(); });
+        executor.spawn(asyncService.getTheatersByMovie("Inception"), [&](const auto& theaters) {
+            theatersCount = theaters.size();
+        });
+        executor.run();
+
+        BOOST_CHECK_EQUAL(moviesCount, 2);
+        BOOST_CHECK_EQUAL(theatersCount, 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(BookSeats_ThenSeatsAvailable)
+    {
+        std::vector<bool> results;
+        for (const std::vector<uint16_t>& seats: std::vector<std::vector<uint16_t>>{{1, 2}, {2, 3}, {3, 4}}) {
+            executor.spawn(asyncService.bookSeats("4DX", "Fight Club", seats), [&](const PricedBooking& booking) {
+                results.push_back(booking.booked);
+            });
+        }
+        executor.run();
+        BOOST_CHECK((results == std::vector<bool>{true, false, true}));
+
+        std::vector<uint16_t> available;
+        executor.spawn(asyncService.getSeatsAvailable("4DX", "Fight Club"), [&](auto seats) {
+            available = std::move(seats);
+        });
+        executor.run();
+        BOOST_CHECK_EQUAL(available.size(), Theater::seatsCapacityMax - 4);
+    }
+
+    BOOST_AUTO_TEST_CASE(BookSeats_UnknownPremiere)
+    {
+        std::optional<bool> booked;
+        executor.spawn(asyncService.bookSeats("Odeon", "Fight Club", {1}), [&](const PricedBooking& booking) {
+            booked = booking.booked;
+        });
+        executor.spawn(asyncService.bookSeats("No Such Theater", "Fight Club", {1}), [&](const PricedBooking& booking) {
+            booked = booked.value() || booking.booked;
+        });
+        executor.run();
+        BOOST_CHECK_EQUAL(booked.value(), false);
+    }
+
+    BOOST_AUTO_TEST_CASE(BookSeats_Contended_SuspendsInsteadOfBlocking)
+    {
+        const BookingService::PremierePtr premiere = service.getPremiere("4DX", "Fight Club").value();
+        std::unique_lock<std::mutex> lock { premiere->mtxBooking };
+
+        std::optional<bool> booked;
+        executor.spawn(asyncService.bookSeats(premiere, {7}), [&](const PricedBooking& booking) {
+            booked = booking.booked;
+        });
+        executor.spawn(asyncService.getSeatsAvailable("Odeon", "Inception"), [](const auto&) {});
+
+        // The booking coroutine keeps yielding while the lock is held, the other one completes
+        for (size_t round = 0; round < 16; ++round)
+            executor.poll();
+        BOOST_CHECK_EQUAL(executor.pending(), 1);
+        BOOST_CHECK_EQUAL(booked.has_value(), false);
+
+        lock.unlock();
+        executor.run();
+        BOOST_CHECK_EQUAL(booked.value_or(false), true);
+    }
+
+    BOOST_AUTO_TEST_CASE(Admission_RateLimited_NotBooked)
+    {
+        Admission::Config config;
+        config.regular = Admission::RateLimit { 1, 1 };
+        Admission::AdmissionController admission { config };
+        asyncService.setAdmission(admission, 42);
+
+        std::vector<bool> results;
+        for (const uint16_t seat: {1, 2}) {
+            executor.spawn(asyncService.bookSeats("4DX", "Fight Club", {seat}), [&](const PricedBooking& booking) {
+                results.push_back(booking.booked);
+            });
+        }
+        executor.run();
+
+        BOOST_CHECK((results == std::vector<bool>{true, false}));
+        BOOST_CHECK_EQUAL(service.getSeatsAvailable("4DX", "Fight Club").size(), Theater::seatsCapacityMax - 1);
+        BOOST_CHECK_EQUAL(admission.getStatistics().rateLimited, 1);
+        BOOST_CHECK_EQUAL(admission.getStatistics().inFlight, 0);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
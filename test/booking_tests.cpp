@@ -0,0 +1,469 @@
+/**============================================================================
+Name        : booking_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Premiere booking tests (concurrent booking modes)
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "BookingService.h"
+
+using namespace Booking;
+
+namespace
+{
+    struct PremiereFixture
+    {
+        Movie movie { "TestMovie" };
+        Theater theater { "TestTheater" };
+        Premiere premiere { theater, movie };
+    };
+}
+
+BOOST_FIXTURE_TEST_SUITE(CombinedBookingTests, PremiereFixture)
+
+    BOOST_AUTO_TEST_CASE(BookSeats_Ok)
+    {
+        BOOST_CHECK_EQUAL(premiere.bookSeatsCombined({1, 2, 3}), true);
+        BOOST_CHECK_EQUAL(premiere.getSeatsAvailable().size(), Theater::seatsCapacityMax - 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(BookSeats_AllOrNothing)
+    {
+        BOOST_REQUIRE(premiere.bookSeatsCombined({5}));
+
+        BOOST_CHECK_EQUAL(premiere.bookSeatsCombined({3, 4, 5, 6}), false);
+        BOOST_CHECK_EQUAL(premiere.bookSeatsCombined({7, 7}), false);
+        BOOST_CHECK_EQUAL(premiere.bookSeatsCombined({8, 0}), false);
+
+        // Only the seat 5 shall be booked: all failed requests shall be rolled back
+        BOOST_CHECK_EQUAL(premiere.getSeatsAvailable().size(), Theater::seatsCapacityMax - 1);
+        BOOST_CHECK_EQUAL(premiere.bookSeatsCombined({3, 4, 6, 7, 8}), true);
+    }
+
+    BOOST_AUTO_TEST_CASE(BookSeats_Concurrent_NoOverbooking)
+    {
+        constexpr size_t threadsCount { 8 };
+        std::atomic<size_t> seatsBooked { 0 };
+        std::vector<std::jthread> threads;
+        for (size_t i = 0; i < threadsCount; ++i) {
+            threads.emplace_back([&] {
+                for (uint16_t seat = 1; seat <= Theater::seatsCapacityMax; ++seat)
+                    if (premiere.bookSeatsCombined({seat}))
+                        seatsBooked.fetch_add(1);
+            });
+        }
+        threads.clear();
+
+        BOOST_CHECK_EQUAL(seatsBooked.load(), Theater::seatsCapacityMax);
+        BOOST_CHECK_EQUAL(premiere.getSeatsAvailable().empty(), true);
+    }
+
+    BOOST_AUTO_TEST_CASE(BookSeats_MixedModes_NoOverbooking)
+    {
+        std::atomic<size_t> seatsBooked { 0 };
+        {
+            std::jthread combined([&] {
+                for (uint16_t seat = 1; seat <= Theater::seatsCapacityMax; ++seat)
+                    if (premiere.bookSeatsCombined({seat}))
+                        seatsBooked.fetch_add(1);
+            });
+            std::jthread locked([&] {
+                for (uint16_t seat = Theater::seatsCapacityMax; seat >= 1; --seat)
+                    if (premiere.bookSeats({seat}))
+                        seatsBooked.fetch_add(1);
+            });
+        }
+        BOOST_CHECK_EQUAL(seatsBooked.load(), Theater::seatsCapacityMax);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+
+BOOST_FIXTURE_TEST_SUITE(DeadlineBookingTests, PremiereFixture)
+
+    using namespace std::chrono_literals;
+    using Clock = std::chrono::steady_clock;
+
+    BOOST_AUTO_TEST_CASE(TryBookSeats_Results)
+    {
+        BookingMetrics metrics;
+        premiere.bookingMetrics = &metrics;
+
+        BOOST_CHECK(BookingResult::Booked == premiere.tryBookSeats({1, 2}, Clock::now() + 1s));
+        BOOST_CHECK(BookingResult::SeatsTaken == premiere.tryBookSeats({2, 3}, Clock::now() + 1s));
+        // The late request is not served even if the premiere is not contended
+        BOOST_CHECK(BookingResult::TimedOut == premiere.tryBookSeats({3}, Clock::now() - 1ms));
+        {
+            std::lock_guard<std::mutex> lock { premiere.mtxBooking };
+            BOOST_CHECK(BookingResult::TimedOut == premiere.tryBookSeats({3}, Clock::now() + 2ms));
+        }
+        BOOST_CHECK_EQUAL(premiere.getSeatsAvailable().size(), Theater::seatsCapacityMax - 2);
+
+        const BookingStatistics statistics = metrics.getStatistics();
+        BOOST_CHECK_EQUAL(statistics.booked, 1);
+        BOOST_CHECK_EQUAL(statistics.seatsTaken, 1);
+        BOOST_CHECK_EQUAL(statistics.timedOut, 2);
+        BOOST_CHECK_CLOSE(statistics.shedRate(), 0.5, 1e-9);
+        BOOST_CHECK_EQUAL(BookingStatistics {}.shedRate(), 0.0);
+    }
+
+    BOOST_AUTO_TEST_CASE(TryBookSeats_Overload_GivesUpByDeadline)
+    {
+        // The synthetic overload: the premiere is held by the slow requests, while the clients wait 1 ms at most
+        constexpr size_t threadsCount { 8 };
+        constexpr size_t requestsCount { 200 };
+        constexpr auto holdTime { 50ms };
+        constexpr auto timeout { 1ms };
+
+        BookingMetrics metrics;
+        premiere.bookingMetrics = &metrics;
+        std::atomic<bool> stop { false };
+        std::atomic<size_t> seatsBooked { 0 };
+        std::atomic<int64_t> waitMax { 0 };
+        {
+            std::jthread slowRequests([&] {
+                while (!stop.load()) {
+                    {
+                        std::lock_guard<std::mutex> lock { premiere.mtxBooking };
+                        std::this_thread::sleep_for(holdTime);
+                    }
+                    std::this_thread::sleep_for(1ms);
+                }
+            });
+
+            std::vector<std::jthread> clients;
+            for (size_t idx = 0; idx < threadsCount; ++idx) {
+                clients.emplace_back([&, idx] {
+                    for (size_t request = 0; request < requestsCount; ++request)
+                    {
+                        const uint16_t seat = static_cast<uint16_t>((idx + request) % Theater::seatsCapacityMax + 1);
+                        const Clock::time_point start = Clock::now();
+                        if (BookingResult::Booked == premiere.tryBookSeats({seat}, start + timeout))
+                            seatsBooked.fetch_add(1);
+                        const int64_t waited = (Clock::now() - start).count();
+                        for (int64_t max = waitMax.load(); waited > max && !waitMax.compare_exchange_weak(max, waited);)
+                            ;
+                    }
+                });
+            }
+            clients.clear();
+            stop.store(true);
+        }
+
+        // Nobody waited for the slow request to complete
+        BOOST_CHECK_LT(waitMax.load(), Clock::duration { holdTime }.count());
+
+        const BookingStatistics statistics = metrics.getStatistics();
+        BOOST_CHECK_EQUAL(statistics.booked + statistics.seatsTaken + statistics.timedOut, threadsCount * requestsCount);
+        BOOST_CHECK_EQUAL(statistics.booked, seatsBooked.load());
+        BOOST_CHECK_LE(statistics.booked, Theater::seatsCapacityMax);
+        BOOST_CHECK_GT(statistics.timedOut, 0);
+        BOOST_CHECK_GT(statistics.shedRate(), 0.0);
+        BOOST_CHECK_EQUAL(premiere.getSeatsAvailable().size(), Theater::seatsCapacityMax - seatsBooked.load());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+
+BOOST_AUTO_TEST_SUITE(PremiereScheduleTests)
+
+    BOOST_AUTO_TEST_CASE(Premieres_CacheLineAligned_StableAddresses)
+    {
+        const Movie movie { "TestMovie" };
+        const Theater theater { "TestTheater" };
+        PremiereSchedule schedule;
+
+        const Premiere* first = schedule.add(theater, movie);
+        std::vector<const Premiere*> added { first };
+        for (size_t idx = 1; idx < 1000; ++idx)
+            added.push_back(schedule.add(theater, movie));
+
+        BOOST_CHECK_EQUAL(schedule.size(), added.size());
+        for (size_t idx = 0; idx < added.size(); ++idx)
+        {
+            // Adding premieres never relocates the existing ones
+            BOOST_CHECK_EQUAL(&schedule[idx], added[idx]);
+            BOOST_CHECK_EQUAL(0, reinterpret_cast<uintptr_t>(added[idx]) % Concurrency::cacheLineSize);
+        }
+        // The neighbouring premieres are adjacent and do not share the cache lines
+        BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(added[1]) - reinterpret_cast<uintptr_t>(added[0]),
+                          sizeof(Premiere));
+    }
+
+    BOOST_AUTO_TEST_CASE(Find_ByIds)
+    {
+        const Movie movie1 { "Movie1" }, movie2 { "Movie2" };
+        const Theater theater1 { "Theater1" }, theater2 { "Theater2" };
+        PremiereSchedule schedule;
+
+        const Premiere* premiere1 = schedule.add(theater1, movie1);
+        const Premiere* premiere2 = schedule.add(theater2, movie1);
+        const Premiere* premiere3 = schedule.add(theater2, movie2);
+
+        BOOST_CHECK_EQUAL(schedule.find(theater1.id, movie1.id), premiere1);
+        BOOST_CHECK_EQUAL(schedule.find(theater2.id, movie1.id), premiere2);
+        BOOST_CHECK_EQUAL(schedule.find(theater2.id, movie2.id), premiere3);
+        BOOST_CHECK(nullptr == schedule.find(theater1.id, movie2.id));
+
+        const std::vector<size_t> expectedMovieIds { movie1.id, movie1.id, movie2.id };
+        BOOST_CHECK_EQUAL_COLLECTIONS(schedule.getMovieIds().begin(), schedule.getMovieIds().end(),
+                                      expectedMovieIds.begin(), expectedMovieIds.end());
+        BOOST_CHECK_EQUAL(premiere3->theaterId, theater2.id);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_FIXTURE_TEST_SUITE(SeatsSubscriptionTests, PremiereFixture)
+
+    BOOST_AUTO_TEST_CASE(GetSeatsChanges_Delta)
+    {
+        BOOST_REQUIRE(premiere.bookSeats({1, 2}));
+        const SeatsUpdate first = premiere.getSeatsChanges(0);
+        BOOST_CHECK_EQUAL(first.version, 1);
+        BOOST_CHECK_EQUAL(first.seatsDelta, 0b11u);
+        BOOST_CHECK_EQUAL(first.full, false);
+
+        BOOST_REQUIRE(premiere.bookSeats({5}));
+        BOOST_REQUIRE(premiere.bookSeatsCombined({7}));
+        const SeatsUpdate second = premiere.getSeatsChanges(first.version);
+        BOOST_CHECK_EQUAL(second.version, 3);
+        BOOST_CHECK_EQUAL(second.seatsDelta, 0b1010000u);
+        BOOST_CHECK_EQUAL(second.seatsBooked, 0b1010011u);
+
+        const SeatsUpdate none = premiere.getSeatsChanges(second.version);
+        BOOST_CHECK_EQUAL(none.version, 3);
+        BOOST_CHECK_EQUAL(none.seatsDelta, 0u);
+    }
+
+    BOOST_AUTO_TEST_CASE(GetSeatsChanges_FallenBehind_Full)
+    {
+        for (uint16_t seat = 1; seat <= Premiere::seatsHistorySize + 1; ++seat)
+            BOOST_REQUIRE(premiere.bookSeats({seat}));
+
+        const SeatsUpdate update = premiere.getSeatsChanges(1);
+        BOOST_CHECK_EQUAL(update.full, true);
+        BOOST_CHECK_EQUAL(update.version, Premiere::seatsHistorySize + 1);
+        BOOST_CHECK_EQUAL(update.seatsDelta, update.seatsBooked);
+
+        // The unknown (future) version is resynchronized as well
+        BOOST_CHECK_EQUAL(premiere.getSeatsChanges(1'000).full, true);
+    }
+
+    BOOST_AUTO_TEST_CASE(GetSeatsChanges_OldestVersion_Full)
+    {
+        // The slot of the oldest version kept is the one the next version overwrites: it is never diffed against
+        for (uint16_t seat = 1; seat < Premiere::seatsHistorySize; ++seat)
+            BOOST_REQUIRE(premiere.bookSeats({seat}));
+
+        const SeatsUpdate oldest = premiere.getSeatsChanges(0);
+        BOOST_CHECK_EQUAL(oldest.version, Premiere::seatsHistorySize - 1);
+        BOOST_CHECK_EQUAL(oldest.full, true);
+
+        const SeatsUpdate delta = premiere.getSeatsChanges(1);
+        BOOST_CHECK_EQUAL(delta.full, false);
+        BOOST_CHECK_EQUAL(delta.seatsDelta, delta.seatsBooked & ~1u);
+    }
+
+    BOOST_AUTO_TEST_CASE(Subscription_Poll)
+    {
+        SeatsSubscription subscription { premiere };
+        BOOST_CHECK(!subscription.poll());
+
+        BOOST_REQUIRE(premiere.bookSeats({3}));
+        BOOST_REQUIRE(!premiere.bookSeats({3}));
+        const std::optional<SeatsUpdate> update = subscription.poll();
+        BOOST_REQUIRE(update);
+        BOOST_CHECK_EQUAL(update->seatsDelta, 0b100u);
+        BOOST_CHECK_EQUAL(subscription.getVersion(), 1);
+        BOOST_CHECK(!subscription.poll());
+    }
+
+    BOOST_AUTO_TEST_CASE(Subscription_ConcurrentBookings)
+    {
+        // The watcher applying the deltas always ends up with the actual seat map
+        std::atomic<bool> done { false };
+        std::jthread booking { [&] {
+            for (uint16_t seat = 1; seat <= Theater::seatsCapacityMax; ++seat)
+                [[maybe_unused]] const bool booked = premiere.bookSeats({seat});
+            done = true;
+        }};
+
+        SeatsSubscription subscription { premiere };
+        uint32_t seatMap = 0;
+        for (bool finished = false; !finished; ) {
+            finished = done.load();
+            if (const std::optional<SeatsUpdate> update = subscription.poll())
+                seatMap = update->full ? update->seatsDelta : seatMap ^ update->seatsDelta;
+        }
+        BOOST_CHECK_EQUAL(seatMap, (1u << Theater::seatsCapacityMax) - 1);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(CatalogRemovalTests)
+
+    BOOST_AUTO_TEST_CASE(Unschedule_SlotReusedAfterReclaim)
+    {
+        const Movie movie1 { "Movie1" }, movie2 { "Movie2" };
+        const Theater theater { "Theater" };
+        PremiereSchedule schedule;
+
+        Premiere* premiere1 = schedule.add(theater, movie1);
+        BOOST_REQUIRE(premiere1->bookSeats(std::vector<uint16_t> {1, 2}));
+        {
+            // The reader which has found the premiere keeps the slot from the reuse
+            const Concurrency::EpochDomain::Guard guard;
+            BOOST_REQUIRE(schedule.remove(theater.id, movie1.id));
+            BOOST_CHECK(!schedule.remove(theater.id, movie1.id));
+            BOOST_CHECK(nullptr == schedule.find(theater.id, movie1.id));
+            BOOST_CHECK(schedule.isVacant(premiere1->id));
+            BOOST_CHECK_EQUAL(schedule.reclaim(), 0);
+            BOOST_CHECK_NE(schedule.add(theater, movie2), premiere1);
+        }
+
+        BOOST_CHECK_EQUAL(schedule.reclaim(), 1);
+        const Premiere* premiere3 = schedule.add(theater, movie2);
+        BOOST_CHECK_EQUAL(premiere3, premiere1);
+        BOOST_CHECK_EQUAL(schedule.size(), 2);
+        BOOST_CHECK_EQUAL(schedule.vacantCount(), 0);
+        BOOST_CHECK_EQUAL(premiere3->getSeatsAvailable().size(), Theater::seatsCapacityMax);
+    }
+
+    BOOST_AUTO_TEST_CASE(AddToSlot_Replica)
+    {
+        const Movie movie { "Movie" };
+        const Theater theater1 { "Theater1" }, theater2 { "Theater2" };
+        PremiereSchedule schedule;
+
+        const Premiere* premiere = schedule.add(2, theater1, movie);
+        BOOST_REQUIRE(nullptr != premiere);
+        BOOST_CHECK_EQUAL(premiere->id, 2);
+        BOOST_CHECK(schedule.isVacant(0) && schedule.isVacant(1));
+        BOOST_CHECK(nullptr == schedule.add(2, theater2, movie));
+        BOOST_CHECK_EQUAL(schedule.add(0, theater2, movie)->id, 0);
+        BOOST_CHECK_EQUAL(schedule.find(theater2.id, movie.id)->id, 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(RemoveMovie_Theater)
+    {
+        BookingService service;
+        service.initialize();
+
+        const Movie* movie = service.movies.findEntryName("Terminator").value();
+        const size_t theatersCount = service.getTheatersByMovie("Terminator").size();
+        BOOST_REQUIRE_GT(theatersCount, 0);
+        {
+            const Concurrency::EpochDomain::Guard guard;
+            BOOST_REQUIRE(service.removeMovie("Terminator"));
+            BOOST_CHECK(!service.removeMovie("Terminator"));
+
+            // Removed from the catalog, still alive for the reader
+            BOOST_CHECK(!service.movies.findEntryName("Terminator"));
+            BOOST_CHECK_EQUAL(movie->name, "Terminator");
+            BOOST_CHECK(service.getTheatersByMovie("Terminator").empty());
+            const std::vector<Movie*> found = service.searchMovies("Terminator", 10);
+            BOOST_CHECK(std::ranges::find(found, movie) == found.end());
+            const std::vector<Movie*> playing = service.getPlayingMovies();
+            BOOST_CHECK(std::ranges::find(playing, movie) == playing.end());
+            BOOST_CHECK_EQUAL(service.getPlayingMoviesView().size(), playing.size());
+            BOOST_CHECK_EQUAL(service.reclaim(), 0);
+        }
+        BOOST_CHECK_EQUAL(service.reclaim(), theatersCount + 1);
+
+        const Theater* theater = service.theaters.findEntryName("4DX").value();
+        BOOST_REQUIRE(service.removeTheater("4DX"));
+        BOOST_CHECK(!service.theaters.findEntryByID(theater->id));
+        const std::vector<Theater*> theaters = service.getTheatersByMovie("Fight Club");
+        BOOST_CHECK(std::ranges::find(theaters, theater) == theaters.end());
+        BOOST_CHECK(!service.getPremiere("4DX", "Fight Club"));
+
+        // The removed selection is looked up by the ID as nullptr: no premiere, no seats
+        const Movie* fightClub = service.movies.findEntryName("Fight Club").value();
+        BOOST_CHECK(!service.getPremiere(nullptr, fightClub));
+        BOOST_CHECK(!service.getPremiere(service.theaters.findEntryName("Electric Cinema").value(), nullptr));
+        BOOST_CHECK(service.getSeatsAvailable(nullptr, fightClub).empty());
+
+        BOOST_REQUIRE(service.unscheduleMovie("Fight Club", "Electric Cinema"));
+        BOOST_CHECK(!service.getPremiere("Electric Cinema", "Fight Club"));
+        BOOST_CHECK(!service.unscheduleMovie("Fight Club", "Electric Cinema"));
+    }
+
+    BOOST_AUTO_TEST_CASE(RemoveMovies_ConcurrentLookups)
+    {
+        constexpr size_t moviesCount { 512 }, readersCount { 4 };
+        BookingService service;
+        service.addTheater("Theater", GeoPoint { 52.52, 13.40 });
+        for (size_t idx = 0; idx < moviesCount; ++idx) {
+            service.addMovie("Movie " + std::to_string(idx));
+            BOOST_REQUIRE(service.scheduleMovie("Movie " + std::to_string(idx), "Theater"));
+        }
+
+        // The readers look the movies up by the name, by the ID and through the catalog indexes (the schedule,
+        // the search, the attributes and the geo index), while the movies are removed and the new ones are scheduled
+        std::atomic<bool> done { false };
+        std::atomic<size_t> mismatches { 0 };
+        std::vector<std::jthread> readers;
+        for (size_t reader = 0; reader < readersCount; ++reader) {
+            readers.emplace_back([&, reader] {
+                for (size_t idx = reader; !done.load(); idx = (idx + 1) % moviesCount) {
+                    const Concurrency::EpochDomain::Guard guard;
+                    const std::string name = "Movie " + std::to_string(idx);
+                    if (const std::optional<Movie*> movie = service.findMovie(name); movie) {
+                        if (movie.value()->name != name)
+                            mismatches.fetch_add(1);
+                        if (const std::optional<Movie*> byId = service.movies.findEntryByID(movie.value()->id);
+                                byId && byId.value() != movie.value())
+                            mismatches.fetch_add(1);
+                    }
+                    if (const std::optional<Premiere*> premiere = service.getPremiere("Theater", name); premiere)
+                        if (premiere.value()->theaterId != service.findTheater("Theater").value()->id)
+                            mismatches.fetch_add(1);
+                    for (const Theater* theater: service.getTheatersByMovie(name))
+                        if (theater->name != "Theater")
+                            mismatches.fetch_add(1);
+                    for (const NearbyPremiere& nearby: service.findNearestPremieres(name, GeoPoint { 52.5, 13.4 }, 1, 1))
+                        if (nearby.theater->name != "Theater")
+                            mismatches.fetch_add(1);
+                    for (const Movie* found: service.searchMovies(name, 4))
+                        if (std::string::npos == found->name.find("Movie "))
+                            mismatches.fetch_add(1);
+                    if (service.getPlayingMovies().size() > 2 * moviesCount ||
+                        service.getMovies(MovieFilter { .playingOnly = true }).size() > 2 * moviesCount)
+                        mismatches.fetch_add(1);
+                }
+            });
+        }
+
+        for (size_t idx = 0; idx < moviesCount; ++idx) {
+            BOOST_REQUIRE(service.removeMovie("Movie " + std::to_string(idx)));
+            service.addMovie("New Movie " + std::to_string(idx));
+            BOOST_REQUIRE(service.scheduleMovie("New Movie " + std::to_string(idx), "Theater"));
+        }
+        done.store(true);
+        readers.clear();
+
+        BOOST_CHECK_EQUAL(mismatches.load(), 0);
+        BOOST_CHECK_EQUAL(service.getPlayingMovies().size(), moviesCount);
+        for (size_t idx = 0; idx < moviesCount; ++idx)
+            BOOST_REQUIRE(service.removeMovie("New Movie " + std::to_string(idx)));
+        BOOST_CHECK(service.getMovies().empty());
+        service.reclaim();
+        BOOST_CHECK_EQUAL(service.bookingSchedule.vacantCount(), service.bookingSchedule.size());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,147 @@
+/**============================================================================
+Name        : change_stream_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Change-data-capture stream tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <thread>
+#include <vector>
+
+#include "BookingService.h"
+#include "ChangeStream.h"
+
+using namespace Booking;
+
+BOOST_AUTO_TEST_SUITE(ChangeStreamTests)
+
+    BOOST_AUTO_TEST_CASE(Poll_ReturnsEventsInOrder)
+    {
+        ChangeStream stream { 16 };
+        std::optional<ChangeStream::Consumer> consumer = stream.subscribe();
+        BOOST_REQUIRE(consumer);
+
+        stream.publish(1, 0b1);
+        stream.publish(2, 0b110);
+
+        std::array<SeatChange, 8> events {};
+        const ChangeStream::PollResult result = consumer->poll(events);
+        BOOST_REQUIRE_EQUAL(result.count, 2);
+        BOOST_CHECK_EQUAL(result.lost, 0);
+        BOOST_CHECK_EQUAL(events[0].sequence, 0);
+        BOOST_CHECK_EQUAL(events[0].premiereId, 1);
+        BOOST_CHECK_EQUAL(events[0].seatsDelta, 0b1u);
+        BOOST_CHECK_EQUAL(events[1].sequence, 1);
+        BOOST_CHECK_EQUAL(events[1].premiereId, 2);
+        BOOST_CHECK_EQUAL(events[1].seatsDelta, 0b110u);
+
+        BOOST_CHECK_EQUAL(consumer->poll(events).count, 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(Consumers_AreIndependent)
+    {
+        ChangeStream stream { 16 };
+        std::optional<ChangeStream::Consumer> first = stream.subscribe();
+        stream.publish(1, 0b1);
+        std::optional<ChangeStream::Consumer> second = stream.subscribe();
+        stream.publish(2, 0b10);
+
+        std::array<SeatChange, 8> events {};
+        BOOST_CHECK_EQUAL(first->poll(events).count, 2);
+        // The consumer receives only the events published after the subscription
+        BOOST_CHECK_EQUAL(second->poll(events).count, 1);
+        BOOST_CHECK_EQUAL(events[0].premiereId, 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(Subscribe_ConsumersMax)
+    {
+        ChangeStream stream { 16 };
+        std::vector<ChangeStream::Consumer> consumers;
+        for (size_t idx = 0; idx < ChangeStream::consumersMax; ++idx)
+            consumers.push_back(std::move(stream.subscribe().value()));
+        BOOST_CHECK(!stream.subscribe());
+
+        // The slot is released by the destroyed consumer
+        consumers.pop_back();
+        BOOST_CHECK(stream.subscribe());
+    }
+
+    BOOST_AUTO_TEST_CASE(Overwrite_ReportsLostEvents)
+    {
+        ChangeStream stream { 4, ChangeStream::BackPressure::Overwrite };
+        std::optional<ChangeStream::Consumer> consumer = stream.subscribe();
+        for (uint32_t idx = 0; idx < 10; ++idx)
+            stream.publish(idx, 1);
+
+        std::array<SeatChange, 16> events {};
+        const ChangeStream::PollResult result = consumer->poll(events);
+        BOOST_CHECK_EQUAL(result.count, 0);
+        BOOST_CHECK_EQUAL(result.lost, 10);
+
+        stream.publish(42, 1);
+        BOOST_REQUIRE_EQUAL(consumer->poll(events).count, 1);
+        BOOST_CHECK_EQUAL(events[0].sequence, 10);
+        BOOST_CHECK_EQUAL(events[0].premiereId, 42);
+    }
+
+    BOOST_AUTO_TEST_CASE(Block_DeliversAllEvents)
+    {
+        constexpr size_t producersCount { 4 };
+        constexpr uint32_t eventsPerProducer { 20'000 };
+
+        ChangeStream stream { 64, ChangeStream::BackPressure::Block };
+        std::optional<ChangeStream::Consumer> consumer = stream.subscribe();
+        {
+            std::vector<std::jthread> producers;
+            for (uint32_t producerIdx = 0; producerIdx < producersCount; ++producerIdx)
+                producers.emplace_back([&stream, producerIdx] {
+                    for (uint32_t idx = 1; idx <= eventsPerProducer; ++idx)
+                        stream.publish(producerIdx, idx);
+                });
+
+            // Every producer's events arrive in the order they were published
+            std::array<uint32_t, producersCount> lastDelta {};
+            std::array<SeatChange, 32> events {};
+            uint64_t received = 0;
+            while (received < producersCount * eventsPerProducer)
+            {
+                const ChangeStream::PollResult result = consumer->poll(events);
+                BOOST_REQUIRE_EQUAL(result.lost, 0);
+                for (size_t idx = 0; idx < result.count; ++idx) {
+                    BOOST_REQUIRE_EQUAL(events[idx].sequence, received++);
+                    BOOST_REQUIRE_EQUAL(events[idx].seatsDelta, lastDelta[events[idx].premiereId] + 1);
+                    lastDelta[events[idx].premiereId] = events[idx].seatsDelta;
+                }
+                if (0 == result.count)
+                    std::this_thread::yield();
+            }
+        }
+        BOOST_CHECK_EQUAL(stream.sequence(), producersCount * eventsPerProducer);
+    }
+
+    BOOST_AUTO_TEST_CASE(BookSeats_PublishesSeatsDelta)
+    {
+        BookingService service;
+        service.initialize();
+        std::optional<ChangeStream::Consumer> consumer = service.changeStream.subscribe();
+
+        Premiere* premiere = service.getPremiere("Odeon", "Inception").value();
+        BOOST_REQUIRE(premiere->bookSeats({1, 3}));
+        BOOST_REQUIRE(premiere->bookSeatsCombined({2}));
+        BOOST_REQUIRE(!premiere->bookSeats({4, 1}));  // Failed: nothing is published
+
+        std::array<SeatChange, 8> events {};
+        const ChangeStream::PollResult result = consumer->poll(events);
+        BOOST_REQUIRE_EQUAL(result.count, 2);
+        BOOST_CHECK_EQUAL(events[0].premiereId, premiere->id);
+        BOOST_CHECK_EQUAL(events[0].seatsDelta, 0b101u);
+        BOOST_CHECK_EQUAL(events[1].seatsDelta, 0b10u);
+        BOOST_CHECK_EQUAL(&service.bookingSchedule[events[0].premiereId], premiere);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
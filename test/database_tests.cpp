@@ -8,6 +8,9 @@ Description :
 ============================================================================ **/
 
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <thread>
+
 #include "Database.h"
 
 namespace
@@ -24,10 +27,19 @@ namespace
         }
     };
 
+    /** The IDs sequences restart for each test: the IDs expected do not depend on the tests order **/
+    struct IdsResetFixture
+    {
+        IdsResetFixture()
+        {
+            DB::IdAllocator<TestMovie>::reset();
+            DB::IdAllocator<TestTheater>::reset();
+        }
+    };
 }
 
 
-BOOST_AUTO_TEST_SUITE(TableEntryTests)
+BOOST_FIXTURE_TEST_SUITE(TableEntryTests, IdsResetFixture)
 
     BOOST_AUTO_TEST_CASE(CreateBasicEntry)
     {
@@ -37,10 +49,12 @@ BOOST_AUTO_TEST_SUITE(TableEntryTests)
 
     BOOST_AUTO_TEST_CASE(ValidateIDCounter_1)
     {
-        const TestMovie movie {"TestMovie"};
+        const TestMovie movie1 {"TestMovie1"}, movie2 {"TestMovie2"};
         const TestTheater theater {"TestTheater"};
 
-        BOOST_CHECK_EQUAL(2, movie.id);
+        // Each entry type has its own sequence
+        BOOST_CHECK_EQUAL(1, movie1.id);
+        BOOST_CHECK_EQUAL(2, movie2.id);
         BOOST_CHECK_EQUAL(1, theater.id);
     }
 
@@ -117,3 +131,83 @@ BOOST_AUTO_TEST_SUITE(TableTests)
     }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+
+
+BOOST_AUTO_TEST_SUITE(IdAllocatorTests)
+
+    struct AllocatorTag {};
+    using Ids = DB::IdAllocator<AllocatorTag>;
+
+    BOOST_AUTO_TEST_CASE(Reset_RestartsSequence)
+    {
+        Ids::reset();
+        BOOST_CHECK_EQUAL(1, Ids::allocate());
+        BOOST_CHECK_EQUAL(2, Ids::allocate());
+
+        Ids::reset();
+        BOOST_CHECK_EQUAL(1, Ids::allocate());
+    }
+
+    BOOST_AUTO_TEST_CASE(ResumeFrom_SkipsRestoredIds)
+    {
+        Ids::reset();
+        Ids::resumeFrom(1000);
+        BOOST_CHECK_EQUAL(1001, Ids::allocate());
+
+        // Resuming from the smaller ID shall never move the sequence back
+        Ids::resumeFrom(10);
+        BOOST_CHECK_GT(Ids::allocate(), 1001);
+    }
+
+    BOOST_AUTO_TEST_CASE(ConcurrentAllocation_UniqueIds)
+    {
+        constexpr size_t threadsCount { 8 }, idsPerThread { 10'000 };
+        Ids::reset();
+
+        std::vector<std::vector<size_t>> allocated(threadsCount);
+        {
+            std::vector<std::jthread> threads;
+            for (size_t idx = 0; idx < threadsCount; ++idx)
+                threads.emplace_back([&ids = allocated[idx]] {
+                    for (size_t n = 0; n < idsPerThread; ++n)
+                        ids.push_back(Ids::allocate());
+                });
+        }
+
+        std::vector<size_t> all;
+        for (const auto& ids: allocated)
+            all.insert(all.end(), ids.cbegin(), ids.cend());
+        std::sort(all.begin(), all.end());
+
+        BOOST_CHECK_EQUAL(all.size(), threadsCount * idsPerThread);
+        BOOST_CHECK(all.end() == std::adjacent_find(all.begin(), all.end()));
+        BOOST_CHECK_NE(0, all.front());
+    }
+
+    BOOST_AUTO_TEST_CASE(ConcurrentEntries_UniqueIds)
+    {
+        struct Entry: DB::TableEntry<Entry> {
+            explicit Entry(std::string name): TableEntry (std::move(name)) {
+            }
+        };
+        constexpr size_t threadsCount { 4 }, entriesPerThread { 1'000 };
+
+        std::vector<std::vector<size_t>> allocated(threadsCount);
+        {
+            std::vector<std::jthread> threads;
+            for (size_t idx = 0; idx < threadsCount; ++idx)
+                threads.emplace_back([&ids = allocated[idx]] {
+                    for (size_t n = 0; n < entriesPerThread; ++n)
+                        ids.push_back(Entry { "Entry" }.id);
+                });
+        }
+
+        std::vector<size_t> all;
+        for (const auto& ids: allocated)
+            all.insert(all.end(), ids.cbegin(), ids.cend());
+        std::sort(all.begin(), all.end());
+        BOOST_CHECK(all.end() == std::adjacent_find(all.begin(), all.end()));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
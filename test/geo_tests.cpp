@@ -0,0 +1,186 @@
+/**============================================================================
+Name        : geo_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Spatial index and nearest theaters search tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+
+#include "GeoIndex.h"
+#include "SeatMap.h"
+#include "BookingService.h"
+#include "CLI.h"
+
+#define CHECK_CONTAINS(str, txt)   BOOST_CHECK_NE(str.find(txt), std::string::npos);
+
+using namespace DB;
+
+namespace
+{
+    constexpr GeoPoint berlin { 52.52, 13.405 }, london { 51.5074, -0.1278 };
+
+    std::vector<std::string> names(const std::vector<Booking::NearbyPremiere>& nearby)
+    {
+        std::vector<std::string> theaters;
+        for (const Booking::NearbyPremiere& premiere: nearby)
+            theaters.push_back(premiere.theater->name);
+        return theaters;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(GeoIndexTests)
+
+    BOOST_AUTO_TEST_CASE(Distance_Haversine)
+    {
+        BOOST_CHECK_CLOSE(distanceKm(berlin, london), 932.0, 0.5);
+        BOOST_CHECK_CLOSE(distanceKm(london, berlin), distanceKm(berlin, london), 1e-9);
+        BOOST_CHECK_EQUAL(distanceKm(berlin, berlin), 0.0);
+    }
+
+    BOOST_AUTO_TEST_CASE(Nearest_MatchesBruteForce)
+    {
+        std::mt19937 generator { 7 };
+        std::uniform_real_distribution<double> latitudeDist { -70.0, 70.0 }, longitudeDist { -170.0, 170.0 };
+        std::vector<GeoPoint> points(2'000);
+        GeoIndex index { 1.0 };
+        for (size_t id = 0; id < points.size(); ++id) {
+            points[id] = GeoPoint { latitudeDist(generator), longitudeDist(generator) };
+            index.add(id, points[id]);
+        }
+        BOOST_CHECK_EQUAL(index.size(), points.size());
+
+        for (size_t query = 0; query < 200; ++query)
+        {
+            const GeoPoint origin { latitudeDist(generator), longitudeDist(generator) };
+            const double radiusKm = query % 2 ? 1'500.0 : std::numeric_limits<double>::infinity();
+
+            // Only the even IDs are accepted
+            std::vector<GeoIndex::Match> expected;
+            for (size_t id = 0; id < points.size(); id += 2)
+                if (const double distance = distanceKm(origin, points[id]); distance <= radiusKm)
+                    expected.push_back(GeoIndex::Match { id, distance });
+            std::sort(expected.begin(), expected.end(), [](const auto& left, const auto& right) {
+                return left.distanceKm < right.distanceKm;
+            });
+            expected.resize(std::min<size_t>(expected.size(), 10));
+
+            const std::vector<GeoIndex::Match> found = index.nearest(origin, 10, radiusKm,
+                    [](const GeoIndex::Match& match) { return 0 == match.id % 2; });
+            BOOST_REQUIRE_EQUAL(found.size(), expected.size());
+            for (size_t idx = 0; idx < found.size(); ++idx)
+                BOOST_CHECK_EQUAL(found[idx].id, expected[idx].id);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(Remove_NotFound)
+    {
+        GeoIndex index;
+        index.add(1, berlin);
+        index.add(2, london);
+        BOOST_CHECK(!index.remove(1, london));
+        BOOST_CHECK(index.remove(1, berlin));
+        BOOST_CHECK(!index.remove(1, berlin));
+
+        const std::vector<GeoIndex::Match> found = index.nearest(berlin, 5, 10'000, [](const auto&) { return true; });
+        BOOST_REQUIRE_EQUAL(found.size(), 1);
+        BOOST_CHECK_EQUAL(found.front().id, 2);
+        BOOST_CHECK(index.nearest(berlin, 5, 100, [](const auto&) { return true; }).empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(SeatBits_FirstRun)
+    {
+        BOOST_CHECK_EQUAL(Booking::SeatBits::firstRun(0, 20, 4).value(), 1);
+        BOOST_CHECK_EQUAL(Booking::SeatBits::firstRun(0b1000100, 20, 4).value(), 8);
+        BOOST_CHECK_EQUAL(Booking::SeatBits::firstRun(0b1111, 6, 2).value(), 5);
+        BOOST_CHECK(!Booking::SeatBits::firstRun(0b1111, 6, 3));
+        BOOST_CHECK(!Booking::SeatBits::firstRun(0, 20, 0));
+        BOOST_CHECK_EQUAL(Booking::SeatBits::firstRun(0, 64, 64).value(), 1);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(NearestTheatersTests)
+
+    BOOST_AUTO_TEST_CASE(Nearest_SeatsTogether)
+    {
+        Booking::BookingService service;
+        service.initialize();
+
+        const auto nearby = service.findNearestPremieres("Fight Club", berlin, 4, 10);
+        BOOST_CHECK((names(nearby) == std::vector<std::string> { "4DX", "Electric Cinema" }));
+        BOOST_CHECK_EQUAL(nearby.front().firstSeat, 1);
+        BOOST_CHECK_LT(nearby.front().distanceKm, 10.0);
+
+        // No four seats in a row left at 4DX
+        BOOST_REQUIRE(service.getPremiere("4DX", "Fight Club").value()->bookSeats({3, 7, 11, 15, 19}));
+        BOOST_CHECK((names(service.findNearestPremieres("Fight Club", berlin, 4, 10)) ==
+                     std::vector<std::string> { "Electric Cinema" }));
+        BOOST_CHECK_EQUAL(service.findNearestPremieres("Fight Club", berlin, 3, 10).front().firstSeat, 4);
+
+        BOOST_CHECK(service.findNearestPremieres("Fight Club", berlin, 4, 10, 100.0).empty());
+        BOOST_CHECK_EQUAL(service.findNearestPremieres("Fight Club", berlin, 1, 1).size(), 1);
+        BOOST_CHECK(service.findNearestPremieres("No Such Movie", berlin, 1, 10).empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(Removed_NotFound)
+    {
+        Booking::BookingService service;
+        service.initialize();
+        service.addTheater("Nowhere");
+        BOOST_REQUIRE(service.scheduleMovie("Fight Club", "Nowhere"));
+        BOOST_CHECK_EQUAL(service.findNearestPremieres("Fight Club", london, 1, 10).size(), 2);
+
+        BOOST_REQUIRE(service.unscheduleMovie("Fight Club", "Electric Cinema"));
+        BOOST_CHECK((names(service.findNearestPremieres("Fight Club", london, 1, 10)) ==
+                     std::vector<std::string> { "4DX" }));
+
+        BOOST_REQUIRE(service.removeTheater("4DX"));
+        BOOST_CHECK(service.findNearestPremieres("Fight Club", london, 1, 10).empty());
+
+        // The premieres placed into the reused slots are indexed again
+        service.reclaim();
+        BOOST_REQUIRE(service.scheduleMovie("Fight Club", "Odeon"));
+        BOOST_CHECK((names(service.findNearestPremieres("Fight Club", berlin, 1, 10)) ==
+                     std::vector<std::string> { "Odeon" }));
+
+        BOOST_REQUIRE(service.removeMovie("Inception"));
+        BOOST_CHECK(service.findNearestPremieres("Inception", london, 1, 10).empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(CLI_NearestTheaters)
+    {
+        Booking::BookingService service;
+        service.initialize();
+        std::stringstream ss;
+        CLI::SimpleCLI cli { service, ss };
+
+        BOOST_CHECK(cli.processCommand("nearest_theaters 52.5,13.4 2 Terminator") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "4DX: ");
+        CHECK_CONTAINS(ss.str(), " km, seats 1-2");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("nearest_theaters 52.5 2 Terminator") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "Expected: <latitude>,<longitude> <seats> <movie name>");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("nearest_theaters 52.5,13.4 0 Terminator") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "Expected: ");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("nearest_theaters 52.5,13.4 30 Terminator") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "No theaters with 30 seats together found");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("nearest_theaters 52.5,13.4 2 Terminator 3") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "No such movie");
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
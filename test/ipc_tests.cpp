@@ -0,0 +1,239 @@
+/**============================================================================
+Name        : ipc_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Shared-memory IPC tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <limits>
+#include <memory>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "SharedMemoryIpc.h"
+
+using namespace Ipc;
+
+BOOST_AUTO_TEST_SUITE(IpcTests)
+
+    BOOST_AUTO_TEST_CASE(SpscRing_Order_And_Capacity)
+    {
+        auto ring = std::make_unique<SpscRing>();
+        Message message;
+        BOOST_CHECK(!ring->tryPop(message));
+
+        for (uint32_t idx = 0; idx < SpscRing::capacity; ++idx) {
+            message.requestId = idx;
+            BOOST_REQUIRE(ring->tryPush(message));
+        }
+        BOOST_CHECK(!ring->tryPush(message));
+
+        // The indices wrap around
+        for (uint32_t idx = 0; idx < 3 * SpscRing::capacity; ++idx) {
+            BOOST_REQUIRE(ring->tryPop(message));
+            BOOST_CHECK_EQUAL(message.requestId, idx);
+            message.requestId = idx + SpscRing::capacity;
+            BOOST_REQUIRE(ring->tryPush(message));
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(Handle_Requests)
+    {
+        Booking::BookingService service;
+        service.initialize();
+
+        auto channel = std::make_unique<Channel>();
+        Server server { service };
+        BOOST_REQUIRE(server.attach(*channel));
+        Client client { *channel };
+        BOOST_REQUIRE(client.isConnected());
+
+        const std::optional<uint32_t> movieId = client.findMovie("Terminator");
+        const std::optional<uint32_t> theaterId = client.findTheater("4DX");
+        BOOST_REQUIRE(movieId && theaterId);
+        BOOST_CHECK(!client.findMovie("Terminator 3"));
+
+        const std::optional<std::vector<uint32_t>> theaters = client.getTheatersByMovie(movieId.value());
+        BOOST_REQUIRE(theaters);
+        BOOST_CHECK_EQUAL(theaters->size(), service.getTheatersByMovie("Terminator").size());
+        BOOST_CHECK(std::ranges::find(theaters.value(), theaterId.value()) != theaters->end());
+
+        BOOST_CHECK(Status::Ok == client.bookSeats(theaterId.value(), movieId.value(), std::vector<uint16_t> {1, 20}));
+        BOOST_CHECK(Status::Rejected == client.bookSeats(theaterId.value(), movieId.value(), std::vector<uint16_t> {2, 20}));
+        BOOST_CHECK(Status::Rejected == client.bookSeats(theaterId.value(), movieId.value(), std::vector<uint16_t> {21}));
+
+        const std::optional<std::vector<uint16_t>> seats = client.getSeatsAvailable(theaterId.value(), movieId.value());
+        BOOST_REQUIRE(seats);
+        BOOST_CHECK(seats.value() == service.getSeatsAvailable("4DX", "Terminator"));
+        BOOST_CHECK_EQUAL(seats->size(), Booking::Theater::seatsCapacityMax - 2);
+
+        BOOST_CHECK(!client.getSeatsAvailable(0, movieId.value()));
+
+        Message unknown;
+        unknown.opcode = static_cast<Opcode>(0xFF);
+        const std::optional<Message> response = client.call(unknown);
+        BOOST_REQUIRE(response);
+        BOOST_CHECK(Status::Malformed == response->status);
+    }
+
+    BOOST_AUTO_TEST_CASE(Admission_RateLimited)
+    {
+        Booking::BookingService service;
+        service.initialize();
+
+        Admission::Config config;
+        config.regular = Admission::RateLimit { 1, 2 };
+        Admission::AdmissionController admission { config };
+
+        auto channel = std::make_unique<Channel>();
+        Server server { service };
+        server.setAdmission(admission, 100);
+        BOOST_REQUIRE(server.attach(*channel));
+        Client client { *channel };
+        BOOST_REQUIRE(client.isConnected());
+
+        // The burst of 2 requests: the third one is not executed
+        const std::optional<uint32_t> movieId = client.findMovie("Terminator");
+        const std::optional<uint32_t> theaterId = client.findTheater("4DX");
+        BOOST_REQUIRE(movieId && theaterId);
+        const std::optional<Status> status = client.bookSeats(theaterId.value(), movieId.value(), std::vector<uint16_t> {1});
+        BOOST_CHECK(Status::RateLimited == status);
+        BOOST_CHECK_EQUAL(service.getSeatsAvailable("4DX", "Terminator").size(), Booking::Theater::seatsCapacityMax);
+        BOOST_CHECK_EQUAL(admission.getStatistics().rateLimited, 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(TheatersByMovie_Paging)
+    {
+        Booking::BookingService service;
+        service.addMovie("Movie");
+        constexpr size_t theatersCount { 3 * Message::idsMax + 1 };
+        for (size_t idx = 0; idx < theatersCount; ++idx) {
+            service.addTheater("Theater " + std::to_string(idx));
+            service.scheduleMovie("Movie", "Theater " + std::to_string(idx));
+        }
+
+        auto channel = std::make_unique<Channel>();
+        Server server { service };
+        BOOST_REQUIRE(server.attach(*channel));
+        Client client { *channel };
+
+        const std::optional<std::vector<uint32_t>> theaters = client.getTheatersByMovie(client.findMovie("Movie").value());
+        BOOST_REQUIRE(theaters);
+        BOOST_CHECK_EQUAL(theaters->size(), theatersCount);
+        BOOST_CHECK(std::ranges::is_sorted(theaters.value()));
+        BOOST_CHECK(std::ranges::adjacent_find(theaters.value()) == theaters->end());
+    }
+
+    BOOST_AUTO_TEST_CASE(FullResponseRing_OtherClientsServed)
+    {
+        Booking::BookingService service;
+        service.initialize();
+
+        auto stalled = std::make_unique<Channel>();
+        auto channel = std::make_unique<Channel>();
+        Server server { service };
+        BOOST_REQUIRE(server.attach(*stalled));
+        BOOST_REQUIRE(server.attach(*channel));
+
+        // The client sends the requests without reading the responses: one more than the response ring holds
+        const Clock::time_point deadline = Clock::now() + 5s;
+        Message request;
+        request.opcode = Opcode::GetSeatsAvailable;
+        for (uint32_t idx = 1; idx <= SpscRing::capacity + 1; ++idx) {
+            request.requestId = idx;
+            while (!stalled->requests.tryPush(request) && Clock::now() < deadline)
+                std::this_thread::yield();
+        }
+
+        Client client { *channel };
+        BOOST_CHECK(client.findMovie("Terminator"));
+        while (0 == server.getResponsesParked() && Clock::now() < deadline)
+            std::this_thread::sleep_for(1ms);
+        BOOST_CHECK_EQUAL(server.getResponsesParked(), 1);
+
+        // The parked response is delivered in order, once the client reads its responses
+        Message response;
+        for (uint32_t idx = 1; idx <= SpscRing::capacity + 1; ++idx) {
+            while (!stalled->responses.tryPop(response) && Clock::now() < deadline)
+                std::this_thread::yield();
+            BOOST_REQUIRE_EQUAL(response.requestId, idx);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(Ids_OutOfRange)
+    {
+        using TheaterIds = Booking::Theater::Ids;
+        const size_t theaterIdNext = TheaterIds::allocate() + 1;
+        {
+            Booking::BookingService service;
+            service.addMovie("Movie");
+            service.addTheater("Odeon");
+            TheaterIds::resumeFrom(std::numeric_limits<uint32_t>::max());
+            service.addTheater("Rex");
+            BOOST_REQUIRE_GT(service.findTheater("Rex").value()->id, std::numeric_limits<uint32_t>::max());
+
+            auto channel = std::make_unique<Channel>();
+            Server server { service };
+            BOOST_REQUIRE(server.attach(*channel));
+            Client client { *channel };
+
+            // Rejected, not truncated into the ID of the other theater
+            BOOST_CHECK(client.findTheater("Odeon"));
+            BOOST_CHECK(!client.findTheater("Rex"));
+            BOOST_REQUIRE(service.scheduleMovie("Movie", "Odeon"));
+            BOOST_CHECK(client.getTheatersByMovie(client.findMovie("Movie").value()));
+            BOOST_REQUIRE(service.scheduleMovie("Movie", "Rex"));
+            BOOST_CHECK(!client.getTheatersByMovie(client.findMovie("Movie").value()));
+
+            Message request;
+            request.opcode = Opcode::FindTheater;
+            request.count = 3;
+            std::ranges::copy(std::string_view { "Rex" }, request.payload.begin());
+            const std::optional<Message> response = client.call(request);
+            BOOST_REQUIRE(response);
+            BOOST_CHECK(Status::OutOfRange == response->status);
+        }
+        TheaterIds::reset();
+        TheaterIds::resumeFrom(theaterIdNext);
+    }
+
+    BOOST_AUTO_TEST_CASE(SharedMemory_TwoProcesses)
+    {
+        Booking::BookingService service;
+        service.initialize();
+
+        const std::string name = "booking-ipc-test-" + std::to_string(::getpid());
+        Server server { service };
+        BOOST_REQUIRE(server.addClient(name));
+        BOOST_CHECK(!server.addClient(name));
+        BOOST_CHECK(!Client { "booking-ipc-test-missing" }.isConnected());
+
+        const pid_t pid = ::fork();
+        BOOST_REQUIRE(pid >= 0);
+        if (0 == pid) {
+            // The client process: books the seats of the service living in the parent process
+            Client client { name };
+            const std::optional<uint32_t> movieId = client.findMovie("Terminator");
+            const std::optional<uint32_t> theaterId = client.findTheater("4DX");
+            const uint16_t seats[] { 3, 4, 5 };
+            const bool booked = client.isConnected() && movieId && theaterId &&
+                    Status::Ok == client.bookSeats(theaterId.value(), movieId.value(), seats);
+            ::_exit(booked ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+
+        int status = 0;
+        BOOST_REQUIRE_EQUAL(::waitpid(pid, &status, 0), pid);
+        BOOST_CHECK(WIFEXITED(status) && EXIT_SUCCESS == WEXITSTATUS(status));
+
+        const std::vector<uint16_t> available = service.getSeatsAvailable("4DX", "Terminator");
+        BOOST_CHECK_EQUAL(available.size(), Booking::Theater::seatsCapacityMax - 3);
+        BOOST_CHECK(std::ranges::find(available, 4) == available.end());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+/**============================================================================
+Name        : loadgen_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Load generator tests: workload determinism, distributions and replay
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+#include "BookingService.h"
+#include "CLI.h"
+#include "Workload.h"
+#include "Replay.h"
+
+#define CHECK_CONTAINS(str, txt)   BOOST_CHECK_NE(str.find(txt), std::string::npos);
+
+namespace
+{
+    struct WorkloadFixture
+    {
+        LoadGen::WorkloadConfig config;
+        Booking::BookingService service;
+
+        WorkloadFixture()
+        {
+            config.moviesCount = 20;
+            config.theatersCount = 10;
+            config.showsPerTheater = 5;
+            config.operationsCount = 2'000;
+            LoadGen::populateCatalog(service, config);
+        }
+    };
+}
+
+BOOST_FIXTURE_TEST_SUITE(LoadGenTests, WorkloadFixture)
+
+    BOOST_AUTO_TEST_CASE(Catalog_Synthetic)
+    {
+        const LoadGen::Catalog catalog = LoadGen::Catalog::from(service);
+
+        BOOST_CHECK_EQUAL(catalog.movies.size(), config.moviesCount);
+        BOOST_CHECK_EQUAL(catalog.theaters.size(), config.theatersCount);
+        BOOST_CHECK_EQUAL(catalog.premieres.size(), config.theatersCount * config.showsPerTheater);
+        for (const auto& [theaterIdx, movieIdx]: catalog.premieres)
+            BOOST_CHECK(service.getPremiere(catalog.theaters[theaterIdx], catalog.movies[movieIdx]).has_value());
+    }
+
+    BOOST_AUTO_TEST_CASE(GenerateCommands_SameSeed_SameCommands)
+    {
+        const LoadGen::Catalog catalog = LoadGen::Catalog::from(service);
+        const std::vector<std::string> first = LoadGen::generateCommands(catalog, config);
+        const std::vector<std::string> second = LoadGen::generateCommands(catalog, config);
+        BOOST_CHECK(first == second);
+
+        config.seed += 1;
+        BOOST_CHECK(first != LoadGen::generateCommands(catalog, config));
+    }
+
+    BOOST_AUTO_TEST_CASE(GenerateCommands_BrowseRatio)
+    {
+        config.browseRatio = 0;
+        const std::vector<std::string> commands = LoadGen::generateCommands(LoadGen::Catalog::from(service), config);
+        const auto orders = std::count_if(commands.cbegin(), commands.cend(), [](const std::string& command) {
+            return command.starts_with("book_seats ");
+        });
+        BOOST_CHECK_EQUAL(orders, config.operationsCount);
+    }
+
+    BOOST_AUTO_TEST_CASE(Replay_AllOrdersHaveSelection)
+    {
+        const std::vector<std::string> commands = LoadGen::generateCommands(LoadGen::Catalog::from(service), config);
+        std::stringstream output;
+        CLI::SimpleCLI cli { service, output };
+        for (const std::string& command: commands)
+            BOOST_REQUIRE(CLI::SimpleCLI::Status::Continue == cli.processCommand(command));
+
+        BOOST_CHECK_EQUAL(output.str().find("No theater or Movie selected"), std::string::npos);
+        BOOST_CHECK_EQUAL(output.str().find("Invalid command"), std::string::npos);
+        CHECK_CONTAINS(output.str(), "are booked");
+    }
+
+    BOOST_AUTO_TEST_CASE(Replay_CountsLatencies)
+    {
+        const std::vector<std::string> commands { "list_playing_movies", "find_theaters Movie 1", "list_movies" };
+        LoadGen::ReplayResult result = LoadGen::replay(service, commands, 0);
+
+        BOOST_CHECK_EQUAL(result.commandsCount, commands.size());
+        BOOST_CHECK_EQUAL(result.overall.count(), commands.size());
+        BOOST_CHECK_EQUAL(result.byCommand.size(), commands.size());
+        BOOST_CHECK_LE(result.overall.percentile(0.5), result.overall.percentile(1.0));
+    }
+
+    BOOST_AUTO_TEST_CASE(Commands_WriteAndRead)
+    {
+        const std::vector<std::string> commands { "select_theater Theater 1", "book_seats 1,2" };
+        std::stringstream log;
+        log << "# recorded session\n\n";
+        LoadGen::writeCommands(commands, log);
+
+        BOOST_CHECK(commands == LoadGen::readCommands(log));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(DistributionsTests)
+
+    BOOST_AUTO_TEST_CASE(Zipf_TopRanksMostPopular)
+    {
+        const LoadGen::ZipfDistribution zipf { 100, 1.0 };
+        LoadGen::Random random { 1 };
+        std::vector<size_t> hits(100, 0);
+        for (size_t idx = 0; idx < 100'000; ++idx)
+            ++hits[zipf(random)];
+
+        BOOST_CHECK_GT(hits[0], hits[1]);
+        BOOST_CHECK_GT(hits[1], hits[10]);
+        BOOST_CHECK_GT(hits[10], hits[99]);
+        // P(rank 0) = 1 / H(100) ~ 0.193
+        BOOST_CHECK_CLOSE(static_cast<double>(hits[0]) / 100'000, 0.193, 5.0);
+    }
+
+    BOOST_AUTO_TEST_CASE(Percentiles_NearestRank)
+    {
+        LoadGen::LatencyStats stats;
+        for (uint64_t value = 1000; value >= 1; --value)
+            stats.add(value);
+
+        BOOST_CHECK_EQUAL(stats.percentile(0.5), 500);
+        BOOST_CHECK_EQUAL(stats.percentile(0.99), 990);
+        BOOST_CHECK_EQUAL(stats.percentile(0.999), 999);
+        BOOST_CHECK_EQUAL(stats.percentile(1.0), 1000);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
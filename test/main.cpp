@@ -468,4 +468,43 @@ BOOST_AUTO_TEST_SUITE(CLI_Basic_Tests)
         }
     }
 
+    BOOST_FIXTURE_TEST_CASE(SeatsChanges_SinceVersion, BookingCLIFixture)
+    {
+        auto [output, status] = sendCommand("seats_changes");
+        CHECK_CONTAINS(output, "Seats map version: 0");
+        CHECK_CONTAINS(output, "No changes");
+
+        std::tie(output, status) = sendCommand("book_seats 1,2,3");
+        std::tie(output, status) = sendCommand("book_seats 7");
+        std::tie(output, status) = sendCommand("seats_changes 1");
+        CHECK_CONTAINS(output, "Seats map version: 2");
+        CHECK_CONTAINS(output, "Booked: 7");
+
+        std::tie(output, status) = sendCommand("seats_changes 0");
+        CHECK_CONTAINS(output, "Booked: 1 2 3 7");
+    }
+
+    BOOST_FIXTURE_TEST_CASE(Selection_Removed_Reset, BookingCLIFixture)
+    {
+        BOOST_REQUIRE(service.removeMovie("Terminator"));
+        auto [output, status] = sendCommand("book_seats 1");
+        CHECK_CONTAINS(output, "The selected movie is no longer available");
+        CHECK_CONTAINS(output, "No theater or Movie selected");
+
+        std::tie(output, status) = sendCommand("select_movie Fight Club");
+        CHECK_CONTAINS(output, "The Fight Club movie is chosen");
+        BOOST_REQUIRE(service.unscheduleMovie("Fight Club", "4DX"));
+        std::tie(output, status) = sendCommand("book_seats 1");
+        CHECK_CONTAINS(output, "No such premiere");
+    }
+
+    BOOST_FIXTURE_TEST_CASE(SeatsChanges_WrongInput, BookingCLIFixture)
+    {
+        for (auto invalidVersion: {"-1", "one", "1x"})
+        {
+            auto [output, status] = sendCommand(std::format("seats_changes {}", invalidVersion));
+            CHECK_CONTAINS(output, std::format("Incorrect version: '{}'", invalidVersion));
+        }
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,199 @@
+/**============================================================================
+Name        : memory_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Memory resources tests: the booking path shall not touch the global heap
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <cstdlib>
+#include <new>
+#include <ostream>
+
+#include "BookingService.h"
+#include "CLI.h"
+#include "Memory.h"
+
+namespace
+{
+    /** The global heap allocations made by the current thread while the tracking is on. The tracking is turned on
+     *  only by the AllocationsTracker of these tests: the other suites of the binary are never counted **/
+    thread_local bool allocationsTracked { false };
+    thread_local size_t allocationsCount { 0 };
+
+    /**
+     * Counts the global heap allocations of the current thread during its lifetime
+     */
+    struct AllocationsTracker
+    {
+        AllocationsTracker(): trackedBefore { allocationsTracked } {
+            allocationsCount = 0;
+            allocationsTracked = true;
+        }
+
+        AllocationsTracker(const AllocationsTracker&) = delete;
+        AllocationsTracker& operator=(const AllocationsTracker&) = delete;
+
+        ~AllocationsTracker() {
+            allocationsTracked = trackedBefore;
+        }
+
+        [[nodiscard]]
+        size_t allocations() const noexcept {
+            return allocationsCount;
+        }
+
+    private:
+
+        const bool trackedBefore;
+    };
+
+    struct ServiceFixture
+    {
+        Booking::BookingService service;
+
+        ServiceFixture() {
+            service.initialize();
+        }
+    };
+}
+
+// Instrumented global allocator: the rest of the operator new/delete forms fall back to these two.
+// Replaces the allocator of the whole tests binary, so it counts nothing unless the thread tracks its allocations
+void* operator new(std::size_t size)
+{
+    if (allocationsTracked) [[unlikely]]
+        ++allocationsCount;
+    if (void* ptr = std::malloc(0 == size ? 1 : size); ptr)
+        return ptr;
+    throw std::bad_alloc {};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+
+BOOST_FIXTURE_TEST_SUITE(ZeroAllocationTests, ServiceFixture)
+
+    BOOST_AUTO_TEST_CASE(BookSeats_Premiere_NoHeapAllocations)
+    {
+        const Booking::Theater* theater = service.findTheater("4DX").value();
+        const Booking::Movie* movie = service.findMovie("Fight Club").value();
+        const std::array<uint16_t, 3> seats { 1, 2, 3 };
+
+        AllocationsTracker tracker;
+        const std::optional<Booking::BookingService::PremierePtr> premiere = service.getPremiere(theater, movie);
+        BOOST_REQUIRE(premiere.has_value());
+        const bool booked = premiere.value()->bookSeats(seats);
+        const bool rebooked = premiere.value()->bookSeats(seats);
+        const size_t allocations = tracker.allocations();
+
+        BOOST_CHECK_EQUAL(booked, true);
+        BOOST_CHECK_EQUAL(rebooked, false);
+        BOOST_CHECK_EQUAL(allocations, 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(AllocationsTracker_CountsHeapAllocations)
+    {
+        AllocationsTracker tracker;
+        const std::vector<uint16_t> seats = service.getSeatsAvailable("4DX", "Fight Club");
+        BOOST_CHECK_GT(tracker.allocations(), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(BookSeats_CLI_NoHeapAllocations)
+    {
+        std::ostream discard { nullptr };
+        CLI::SimpleCLI cli { service, discard };
+        BOOST_REQUIRE(CLI::SimpleCLI::Status::Continue == cli.processCommand("select_theater 4DX"));
+        BOOST_REQUIRE(CLI::SimpleCLI::Status::Continue == cli.processCommand("select_movie Fight Club"));
+
+        size_t allocations = 0;
+        {
+            AllocationsTracker tracker;
+            [[maybe_unused]] const auto multiple = cli.processCommand("book_seats 1,2,3,4,5");
+            [[maybe_unused]] const auto single = cli.processCommand("book_seats 6");
+            [[maybe_unused]] const auto listed = cli.processCommand("list_available_seats");
+            allocations = tracker.allocations();
+        }
+
+        BOOST_CHECK_EQUAL(allocations, 0);
+        BOOST_CHECK_EQUAL(service.getSeatsAvailable("4DX", "Fight Club").size(),
+                          Booking::Theater::seatsCapacityMax - 6);
+    }
+
+    BOOST_AUTO_TEST_CASE(GetSeatsAvailable_Arena_NoHeapAllocations)
+    {
+        const Booking::Theater* theater = service.findTheater("Odeon").value();
+        const Booking::Movie* movie = service.findMovie("Inception").value();
+
+        Memory::RequestArena<256> arena;
+        AllocationsTracker tracker;
+        const std::pmr::vector<uint16_t> seats = service.getSeatsAvailable(theater, movie, arena.get());
+        const size_t allocations = tracker.allocations();
+
+        BOOST_CHECK_EQUAL(seats.size(), Booking::Theater::seatsCapacityMax);
+        BOOST_CHECK_EQUAL(allocations, 0);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+
+BOOST_AUTO_TEST_SUITE(MemoryResourceTests)
+
+    BOOST_AUTO_TEST_CASE(CountingResource_CountsAllocations)
+    {
+        Memory::CountingResource counting;
+        {
+            std::pmr::vector<int> values { &counting };
+            values.resize(100);
+        }
+
+        BOOST_CHECK_EQUAL(counting.allocations(), 1);
+        BOOST_CHECK_EQUAL(counting.deallocations(), 1);
+        BOOST_CHECK_EQUAL(counting.bytes(), 100 * sizeof(int));
+    }
+
+    BOOST_AUTO_TEST_CASE(RequestArena_Overflow_FallsBackToHeap)
+    {
+        const size_t heapAllocations = Memory::heapResource().allocations();
+        {
+            Memory::RequestArena<64> arena;
+            std::pmr::vector<uint64_t> small { 4, arena.get() };
+            BOOST_CHECK_EQUAL(Memory::heapResource().allocations(), heapAllocations);
+
+            std::pmr::vector<uint64_t> large { 1024, arena.get() };
+            BOOST_CHECK_GT(Memory::heapResource().allocations(), heapAllocations);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(TableEntries_AllocatedFromPool)
+    {
+        struct PooledEntry: DB::TableEntry<PooledEntry> {
+            explicit PooledEntry(std::string name): TableEntry (std::move(name)) {
+            }
+        };
+        constexpr size_t entriesCount { 1'000 };
+
+        DB::Table<PooledEntry> table;
+        const size_t heapAllocations = Memory::heapResource().allocations();
+        for (size_t idx = 0; idx < entriesCount; ++idx)
+            table.addEntry("Entry " + std::to_string(idx));
+
+        // The pool takes the memory from the heap by the large chunks
+        BOOST_CHECK_LT(Memory::heapResource().allocations() - heapAllocations, entriesCount / 10);
+        BOOST_CHECK_EQUAL(table.getAllEntries().size(), entriesCount);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,187 @@
+/**============================================================================
+Name        : movie_info_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Roaring bitmaps and the movies filtered listings tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <set>
+#include <sstream>
+
+#include "RoaringBitmap.h"
+#include "BookingService.h"
+#include "CLI.h"
+
+#define CHECK_CONTAINS(str, txt)   BOOST_CHECK_NE(str.find(txt), std::string::npos);
+
+using namespace Booking;
+
+namespace
+{
+    std::vector<uint32_t> values(const DB::RoaringBitmap& bitmap)
+    {
+        std::vector<uint32_t> ids;
+        bitmap.forEach([&ids](uint32_t id) { ids.push_back(id); });
+        return ids;
+    }
+
+    std::vector<std::string> names(const std::vector<Movie*>& movies)
+    {
+        std::vector<std::string> found;
+        for (const Movie* movie: movies)
+            found.push_back(movie->name);
+        std::sort(found.begin(), found.end());
+        return found;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(RoaringBitmapTests)
+
+    BOOST_AUTO_TEST_CASE(AddRemove_MatchesSet)
+    {
+        // The dense chunk (turned into the bitset and back) and the sparse ones
+        std::mt19937 generator { 3 };
+        DB::RoaringBitmap bitmap;
+        std::set<uint32_t> expected;
+        for (size_t idx = 0; idx < 20'000; ++idx)
+        {
+            const uint32_t value = 0 == idx % 4 ? static_cast<uint32_t>(generator()) : generator() % 10'000;
+            BOOST_CHECK_EQUAL(bitmap.add(value), expected.insert(value).second);
+        }
+        BOOST_CHECK_EQUAL(bitmap.cardinality(), expected.size());
+        BOOST_CHECK((values(bitmap) == std::vector<uint32_t> { expected.begin(), expected.end() }));
+
+        for (size_t idx = 0; idx < 30'000; ++idx)
+        {
+            const uint32_t value = generator() % 10'000;
+            BOOST_CHECK_EQUAL(bitmap.remove(value), 1 == expected.erase(value));
+        }
+        BOOST_CHECK_EQUAL(bitmap.cardinality(), expected.size());
+        BOOST_CHECK((values(bitmap) == std::vector<uint32_t> { expected.begin(), expected.end() }));
+        BOOST_CHECK(bitmap.contains(*expected.rbegin()));
+        BOOST_CHECK(!bitmap.contains(10'000));
+    }
+
+    BOOST_AUTO_TEST_CASE(Intersect_AllContainersKinds)
+    {
+        DB::RoaringBitmap even, threes, sparse;
+        for (uint32_t value = 0; value < 200'000; ++value) {
+            if (0 == value % 2)
+                even.add(value);
+            if (0 == value % 3)
+                threes.add(value);
+            if (0 == value % 1'000)
+                sparse.add(value);
+        }
+
+        const std::array<const DB::RoaringBitmap*, 2> bitsets { &even, &threes };
+        const DB::RoaringBitmap sixes = DB::RoaringBitmap::intersect(bitsets);
+        BOOST_CHECK_EQUAL(sixes.cardinality(), 200'000 / 6 + 1);
+        BOOST_CHECK(sixes.contains(199'998) && !sixes.contains(199'997));
+
+        const std::array<const DB::RoaringBitmap*, 3> all { &even, &sparse, &threes };
+        const std::vector<uint32_t> common = values(DB::RoaringBitmap::intersect(all));
+        BOOST_CHECK_EQUAL(common.size(), 200'000 / 3'000 + 1);
+        BOOST_CHECK_EQUAL(common.back(), 198'000);
+
+        DB::RoaringBitmap none;
+        none.add(1);
+        none &= sparse;
+        BOOST_CHECK(none.empty());
+        BOOST_CHECK(DB::RoaringBitmap::intersect({}).empty());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(MovieFilterTests)
+
+    BOOST_AUTO_TEST_CASE(Parse_Names)
+    {
+        BOOST_CHECK(Genre::SciFi == parseGenre("SciFi"));
+        BOOST_CHECK(Rating::PG13 == parseRating("pg13"));
+        BOOST_CHECK(Format::IMAX == parseFormat("IMAX"));
+        BOOST_CHECK(!parseGenre("western"));
+        BOOST_CHECK_EQUAL(toString(Format::ThreeD), "3d");
+    }
+
+    BOOST_AUTO_TEST_CASE(Filtered_Listings)
+    {
+        BookingService service;
+        service.initialize();
+
+        MovieFilter filter;
+        filter.playingOnly = true;
+        BOOST_CHECK_EQUAL(service.getMovies(filter).size(), service.getPlayingMovies().size());
+
+        filter.genre = Genre::SciFi;
+        BOOST_CHECK((names(service.getMovies(filter)) == std::vector<std::string> { "Inception", "Terminator" }));
+        filter.format = Format::IMAX;
+        filter.language = "EN";
+        BOOST_CHECK((names(service.getMovies(filter)) == std::vector<std::string> { "Inception" }));
+        filter.language = "fr";
+        BOOST_CHECK(service.getMovies(filter).empty());
+
+        MovieFilter fantasy;
+        fantasy.genre = Genre::Fantasy;
+        fantasy.durationMax = 160;
+        BOOST_CHECK_EQUAL(service.getMovies(fantasy).size(), 3);
+        BOOST_CHECK_EQUAL(service.getMovies(MovieFilter {}).size(), service.getMovies().size());
+    }
+
+    BOOST_AUTO_TEST_CASE(Playing_FollowsSchedule)
+    {
+        BookingService service;
+        service.initialize();
+        const Movie* fightClub = service.movies.findEntryName("Fight Club").value();
+        const auto isPlaying = [&] {
+            const std::vector<Movie*> playing = service.getPlayingMovies();
+            return std::find(playing.begin(), playing.end(), fightClub) != playing.end();
+        };
+
+        // Two premieres: still playing after one is unscheduled
+        BOOST_REQUIRE(service.unscheduleMovie("Fight Club", "4DX"));
+        BOOST_CHECK(isPlaying());
+        BOOST_REQUIRE(service.removeTheater("Electric Cinema"));
+        BOOST_CHECK(!isPlaying());
+        BOOST_REQUIRE(service.scheduleMovie("Fight Club", "Odeon"));
+        BOOST_CHECK(isPlaying());
+
+        BOOST_REQUIRE(service.removeMovie("Inception"));
+        MovieFilter filter;
+        filter.genre = Genre::SciFi;
+        BOOST_CHECK_EQUAL(service.getMovies(filter).size(), 2);
+        filter.playingOnly = true;
+        BOOST_CHECK((names(service.getMovies(filter)) == std::vector<std::string> { "Terminator" }));
+    }
+
+    BOOST_AUTO_TEST_CASE(CLI_Filters)
+    {
+        BookingService service;
+        service.initialize();
+        std::stringstream ss;
+        CLI::SimpleCLI cli { service, ss };
+
+        BOOST_CHECK(cli.processCommand("list_playing_movies genre=scifi format=imax") == CLI::SimpleCLI::Status::Continue);
+        BOOST_CHECK_EQUAL(ss.str(), "\tInception\n");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("list_movies genre=fantasy rating=pg duration=150") ==
+                    CLI::SimpleCLI::Status::Continue);
+        BOOST_CHECK_EQUAL(ss.str(), "\tHarry Potter and the Prisoner of Azkaban\n");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("list_movies genre=western") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "Incorrect filter: 'genre=western'");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("list_playing_movies duration") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "Incorrect filter: 'duration'");
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,223 @@
+/**============================================================================
+Name        : pricing_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Dynamic seat pricing tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <numeric>
+#include <sstream>
+#include <thread>
+
+#include "AsyncBookingService.h"
+#include "BookingService.h"
+#include "CLI.h"
+
+#define CHECK_CONTAINS(str, txt)   BOOST_CHECK_NE(str.find(txt), std::string::npos);
+
+using namespace Booking;
+using namespace std::chrono_literals;
+
+namespace
+{
+    std::vector<uint16_t> seatsRange(uint16_t first, uint16_t last)
+    {
+        std::vector<uint16_t> seats(last - first + 1);
+        std::iota(seats.begin(), seats.end(), first);
+        return seats;
+    }
+
+    /** Waits for the condition to become true: the prices are recomputed by the repricing thread **/
+    template<typename Predicate>
+    bool eventually(Predicate&& predicate)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + 5s;
+        while (!predicate()) {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(1ms);
+        }
+        return true;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(PricingTests)
+
+    BOOST_AUTO_TEST_CASE(Quote_Zones)
+    {
+        const PricingEngine engine;
+        BOOST_REQUIRE_EQUAL(engine.getZones().size(), 3);
+
+        const std::vector<uint16_t> seats { 1, 6, 16 };
+        BOOST_CHECK_EQUAL(engine.quote(seats, PricingEngine::factorBase).price, 800 + 1'200 + 1'000);
+        const Quote quote = engine.quote(seats, 1'255);
+        BOOST_CHECK_EQUAL(quote.price, 3'765);
+        BOOST_CHECK_EQUAL(quote.priceFactor, 1'255);
+
+        // The seats out of the hall are not priced, the seats out of the zones are free
+        BOOST_CHECK_EQUAL(engine.quote(std::vector<uint16_t> {0, 33, 5}, PricingEngine::factorBase).price, 800);
+        const PricingEngine custom { { PriceZone { "VIP", 0b11, 2'000 } }, PricingRules {} };
+        BOOST_CHECK_EQUAL(custom.quote(std::vector<uint16_t> {1, 2, 3}, PricingEngine::factorBase).price, 4'000);
+    }
+
+    BOOST_AUTO_TEST_CASE(Reprice_Rules)
+    {
+        BookingService service;
+        service.initialize();
+        const PremiereSchedule& schedule = service.bookingSchedule;
+        Premiere& premiere = *service.getPremiere("4DX", "Terminator").value();
+        const PricingEngine::Clock::time_point now = PricingEngine::Clock::now();
+
+        BOOST_CHECK_EQUAL(service.pricing.reprice(schedule, now), 0);
+        BOOST_CHECK_EQUAL(service.pricing.reprice(schedule, now), 0);
+        const uint64_t version = service.pricing.getVersion();
+        BOOST_CHECK_EQUAL(premiere.priceFactor.load(), PricingEngine::factorBase);
+
+        // Half of the seats booked: +10%, the other premieres are not repriced
+        BOOST_REQUIRE(premiere.bookSeats(seatsRange(1, 10)));
+        BOOST_CHECK_EQUAL(service.pricing.reprice(schedule, now), 1);
+        BOOST_CHECK_EQUAL(service.pricing.getVersion(), version + 1);
+        BOOST_CHECK_EQUAL(premiere.priceFactor.load(), 1'100);
+        BOOST_CHECK_EQUAL(service.getPremiere("Odeon", "Inception").value()->priceFactor.load(), 1'000);
+
+        // 80% booked, the showtime in an hour: all the rules matched
+        BOOST_REQUIRE(premiere.bookSeats(seatsRange(11, 16)));
+        premiere.setShowtime(now + 1h);
+        BOOST_CHECK_EQUAL(service.pricing.reprice(schedule, now), 1);
+        BOOST_CHECK_EQUAL(premiere.priceFactor.load(), 1'815);
+
+        // Nothing changed: no batch, unless forced (the lead time changes with the time only)
+        BOOST_CHECK_EQUAL(service.pricing.reprice(schedule, now - 30h), 0);
+        BOOST_CHECK_EQUAL(service.pricing.getVersion(), version + 2);
+        BOOST_CHECK_EQUAL(service.pricing.reprice(schedule, now - 30h, true), 1);
+        BOOST_CHECK_EQUAL(premiere.priceFactor.load(), 1'375);
+
+        // The product is clamped
+        PricingRules rules;
+        rules.occupancy = { OccupancyRule { 0.5f, 3.0f } };
+        service.pricing.setRules(rules);
+        BOOST_CHECK_GT(service.pricing.reprice(schedule, now), 0);
+        BOOST_CHECK_EQUAL(premiere.priceFactor.load(), 2'000);
+    }
+
+    BOOST_AUTO_TEST_CASE(BookSeatsPriced_Quote)
+    {
+        BookingService service;
+        service.initialize();
+        Premiere& premiere = *service.getPremiere("4DX", "Terminator").value();
+        BOOST_REQUIRE(premiere.bookSeats(seatsRange(1, 10)));
+        service.pricing.reprice(service.bookingSchedule);
+
+        const std::vector<uint16_t> seats { 11, 16 };
+        const Quote quoted = premiere.quoteSeats(seats);
+        const PricedBooking booking = premiere.bookSeatsPriced(seats);
+        BOOST_REQUIRE(booking.booked);
+        BOOST_CHECK_EQUAL(booking.quote.priceFactor, 1'100);
+        BOOST_CHECK_EQUAL(booking.quote.price, (1'200 + 1'000) * 11 / 10);
+        BOOST_CHECK_EQUAL(booking.quote.price, quoted.price);
+
+        // Not booked: not charged
+        const PricedBooking rejected = premiere.bookSeatsPriced(seats);
+        BOOST_CHECK(!rejected.booked);
+        BOOST_CHECK_EQUAL(rejected.quote.price, 0);
+
+        // The vacant slots are not repriced
+        BOOST_REQUIRE(service.unscheduleMovie("Terminator", "4DX"));
+        BOOST_CHECK_EQUAL(service.pricing.reprice(service.bookingSchedule, PricingEngine::Clock::now(), true), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(AllBookingModes_Priced)
+    {
+        BookingService service;
+        service.initialize();
+        Premiere& premiere = *service.getPremiere("4DX", "Terminator").value();
+        premiere.priceFactor.store(1'100);
+        const std::vector<uint16_t> front { 1 }, middle { 6 }, back { 16 }, taken { 1, 2 };
+
+        const PricedBooking combined = premiere.bookSeatsCombinedPriced(front);
+        BOOST_REQUIRE(combined.booked);
+        BOOST_CHECK_EQUAL(combined.quote.price, 880);
+        BOOST_CHECK_EQUAL(combined.quote.priceFactor, 1'100);
+        BOOST_CHECK_EQUAL(premiere.bookSeatsCombinedPriced(taken).quote.price, 0);
+
+        const std::optional<PricedBooking> uncontended = premiere.bookSeatsIfUncontended(middle);
+        BOOST_REQUIRE(uncontended && uncontended->booked);
+        BOOST_CHECK_EQUAL(uncontended->quote.price, 1'320);
+
+        const auto deadline = std::chrono::steady_clock::now() + 1s;
+        const PricedBookingResult deadlineAware = premiere.tryBookSeatsPriced(back, deadline);
+        BOOST_CHECK(BookingResult::Booked == deadlineAware.result);
+        BOOST_CHECK_EQUAL(deadlineAware.quote.price, 1'100);
+        const PricedBookingResult rejected = premiere.tryBookSeatsPriced(taken, deadline);
+        BOOST_CHECK(BookingResult::SeatsTaken == rejected.result);
+        BOOST_CHECK_EQUAL(rejected.quote.price, 0);
+
+        Async::Executor executor;
+        AsyncBookingService asyncService { service, executor };
+        PricedBooking async;
+        executor.spawn(asyncService.bookSeats("4DX", "Terminator", {2, 7}), [&](const PricedBooking& booking) {
+            async = booking;
+        });
+        executor.run();
+        BOOST_REQUIRE(async.booked);
+        BOOST_CHECK_EQUAL(async.quote.price, (800 + 1'200) * 11 / 10);
+    }
+
+    BOOST_AUTO_TEST_CASE(CLI_BookSeats_Price)
+    {
+        BookingService service;
+        service.initialize();
+        std::stringstream ss;
+        CLI::SimpleCLI cli { service, ss };
+
+        BOOST_CHECK(cli.processCommand("select_theater 4DX") == CLI::SimpleCLI::Status::Continue);
+        BOOST_CHECK(cli.processCommand("select_movie Terminator") == CLI::SimpleCLI::Status::Continue);
+        ss.str("");
+        BOOST_CHECK(cli.processCommand("book_seats 1,6") == CLI::SimpleCLI::Status::Continue);
+        BOOST_CHECK_EQUAL(ss.str(), "Seats 1,6 are booked. Price: 20.00\n");
+        ss.str("");
+
+        service.getPremiere("4DX", "Terminator").value()->priceFactor.store(1'105);
+        BOOST_CHECK(cli.processCommand("book_seats 2") == CLI::SimpleCLI::Status::Continue);
+        BOOST_CHECK_EQUAL(ss.str(), "Seats 2 are booked. Price: 8.84\n");
+    }
+
+    BOOST_AUTO_TEST_CASE(Repricing_Thread_BookSeats)
+    {
+        BookingService service;
+        service.initialize();
+        service.startRepricing(1ms, 1min);
+        std::stringstream ss;
+        CLI::SimpleCLI cli { service, ss };
+        const Premiere& premiere = *service.getPremiere("4DX", "Terminator").value();
+
+        BOOST_CHECK(cli.processCommand("select_theater 4DX") == CLI::SimpleCLI::Status::Continue);
+        BOOST_CHECK(cli.processCommand("select_movie Terminator") == CLI::SimpleCLI::Status::Continue);
+        ss.str("");
+        BOOST_CHECK(cli.processCommand("book_seats 1,2,3,4,5,6,7,8,9,10") == CLI::SimpleCLI::Status::Continue);
+        BOOST_CHECK_EQUAL(ss.str(), "Seats 1,2,3,4,5,6,7,8,9,10 are booked. Price: 100.00\n");
+
+        // Half of the seats booked: repriced by the thread, no one calls reprice()
+        BOOST_REQUIRE(eventually([&] { return 1'100 == premiere.priceFactor.load(); }));
+        ss.str("");
+        BOOST_CHECK(cli.processCommand("book_seats 11") == CLI::SimpleCLI::Status::Continue);
+        BOOST_CHECK_EQUAL(ss.str(), "Seats 11 are booked. Price: 13.20\n");
+    }
+
+    BOOST_AUTO_TEST_CASE(Repricing_Thread_ForcedBatch)
+    {
+        BookingService service;
+        service.initialize();
+        Premiere& premiere = *service.getPremiere("4DX", "Terminator").value();
+        premiere.setShowtime(PricingEngine::Clock::now() + 24h + 100ms);
+        service.startRepricing(1ms, 10ms);
+
+        // Nothing changes but the time: the last day before the showtime is priced by the forced batches
+        BOOST_CHECK(eventually([&] { return 1'100 == premiere.priceFactor.load(); }));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
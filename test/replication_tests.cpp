@@ -0,0 +1,244 @@
+/**============================================================================
+Name        : replication_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Primary/follower replication tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <memory>
+#include <thread>
+
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "Replication.h"
+
+using namespace Replication;
+
+namespace
+{
+    constexpr auto syncTimeout { 5s };
+
+    std::pair<int, int> socketPair()
+    {
+        int sockets[2] { -1, -1 };
+        BOOST_REQUIRE_EQUAL(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+        return { sockets[0], sockets[1] };
+    }
+
+    /** Waits for the condition to become true: the follower applies the log asynchronously **/
+    template<typename Predicate>
+    bool eventually(Predicate&& predicate)
+    {
+        const Clock::time_point deadline = Clock::now() + syncTimeout;
+        while (!predicate()) {
+            if (Clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(1ms);
+        }
+        return true;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(ReplicationTests)
+
+    BOOST_AUTO_TEST_CASE(Record_EncodeDecode)
+    {
+        std::string buffer;
+        encode(Record { RecordType::ScheduleMovie, 7, 123, "Fight Club", "4DX", 0, 0, std::nullopt, {} }, buffer);
+        encode(Record { RecordType::SeatsState, 8, 124, {}, {}, 3, 0b101, std::nullopt, {} }, buffer);
+
+        uint32_t size = 0;
+        std::memcpy(&size, buffer.data(), sizeof(size));
+        const std::optional<Record> schedule = decode(std::string_view { buffer }.substr(sizeof(size), size));
+        BOOST_REQUIRE(schedule);
+        BOOST_CHECK(RecordType::ScheduleMovie == schedule->type);
+        BOOST_CHECK_EQUAL(schedule->lsn, 7);
+        BOOST_CHECK_EQUAL(schedule->name, "Fight Club");
+        BOOST_CHECK_EQUAL(schedule->theaterName, "4DX");
+
+        const std::string_view second = std::string_view { buffer }.substr(sizeof(size) + size + sizeof(size));
+        const std::optional<Record> seats = decode(second);
+        BOOST_REQUIRE(seats);
+        BOOST_CHECK_EQUAL(seats->premiereId, 3);
+        BOOST_CHECK_EQUAL(seats->seatsBooked, 0b101u);
+
+        // Truncated frame
+        BOOST_CHECK(!decode(second.substr(0, second.size() - 1)));
+    }
+
+    BOOST_AUTO_TEST_CASE(Record_TheaterLocation)
+    {
+        for (const std::optional<DB::GeoPoint> location: {std::optional { DB::GeoPoint { 52.52, 13.40 } },
+                                                          std::optional<DB::GeoPoint> {}})
+        {
+            std::string buffer;
+            encode(Record { RecordType::AddTheater, 1, 2, "Odeon", {}, 0, 0, location, {} }, buffer);
+            const std::optional<Record> theater = decode(std::string_view { buffer }.substr(sizeof(uint32_t)));
+            BOOST_REQUIRE(theater);
+            BOOST_CHECK_EQUAL(theater->name, "Odeon");
+            BOOST_REQUIRE_EQUAL(theater->location.has_value(), location.has_value());
+            if (location) {
+                BOOST_CHECK_EQUAL(theater->location->latitude, 52.52);
+                BOOST_CHECK_EQUAL(theater->location->longitude, 13.40);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(Record_MovieInfo)
+    {
+        const Booking::MovieInfo info { Booking::Genre::Comedy, Booking::Rating::PG13, "en", Booking::Format::IMAX, 95 };
+        std::string buffer;
+        encode(Record { RecordType::AddMovie, 1, 2, "Movie", {}, 0, 0, std::nullopt, info }, buffer);
+        const std::optional<Record> movie = decode(std::string_view { buffer }.substr(sizeof(uint32_t)));
+        BOOST_REQUIRE(movie);
+        BOOST_CHECK_EQUAL(movie->name, "Movie");
+        BOOST_CHECK(Booking::Genre::Comedy == movie->movieInfo.genre);
+        BOOST_CHECK(Booking::Rating::PG13 == movie->movieInfo.rating);
+        BOOST_CHECK(Booking::Format::IMAX == movie->movieInfo.format);
+        BOOST_CHECK_EQUAL(movie->movieInfo.language, "en");
+        BOOST_CHECK_EQUAL(movie->movieInfo.durationMinutes, 95);
+    }
+
+    BOOST_AUTO_TEST_CASE(Follower_AppliesStateAndChanges)
+    {
+        Booking::BookingService service;
+        service.initialize();
+        BOOST_REQUIRE(service.getPremiere("4DX", "Terminator").value()->bookSeats({1, 2}));
+
+        const auto [primarySocket, followerSocket] = socketPair();
+        Primary primary { service, 1ms };
+        primary.attach(primarySocket);
+        Follower follower { followerSocket, 1s };
+
+        // The state existing before the follower attached
+        BOOST_REQUIRE(follower.waitUntilSynced(Clock::now(), syncTimeout));
+        BOOST_CHECK_EQUAL(follower.getMovies().value().size(), service.getMovies().size());
+        BOOST_CHECK_EQUAL(follower.getTheatersByMovie("Fight Club").value().size(), 2);
+        BOOST_CHECK_EQUAL(follower.getSeatsAvailable("4DX", "Terminator").value().front(), 3);
+
+        // The changes
+        primary.addMovie("Alien");
+        BOOST_REQUIRE(primary.scheduleMovie("Alien", "Odeon"));
+        BOOST_REQUIRE(service.getPremiere("Odeon", "Alien").value()->bookSeats({5}));
+        BOOST_REQUIRE(follower.waitUntilSynced(Clock::now(), syncTimeout));
+
+        BOOST_CHECK_EQUAL(follower.getTheatersByMovie("Alien").value().size(), 1);
+        const std::vector<uint16_t> seats = follower.getSeatsAvailable("Odeon", "Alien").value();
+        BOOST_CHECK_EQUAL(seats.size(), Booking::Theater::seatsCapacityMax - 1);
+        BOOST_CHECK(std::find(seats.cbegin(), seats.cend(), 5) == seats.cend());
+        BOOST_CHECK_GT(follower.getLag().count, 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(Follower_ReadYourWrites)
+    {
+        Booking::BookingService service;
+        service.initialize();
+        const auto [primarySocket, followerSocket] = socketPair();
+        Primary primary { service, 1ms };
+        primary.attach(primarySocket);
+        Follower follower { followerSocket, 1s };
+
+        // Synced to the time after the booking: the booking is applied, however close to the shipping it was made
+        Booking::Premiere& premiere = *service.getPremiere("4DX", "Terminator").value();
+        for (uint16_t seatNum = 1; seatNum <= Booking::Theater::seatsCapacityMax; ++seatNum)
+        {
+            BOOST_REQUIRE(premiere.bookSeats({seatNum}));
+            BOOST_REQUIRE(follower.waitUntilSynced(Clock::now(), syncTimeout));
+            const std::vector<uint16_t> seats = follower.getSeatsAvailable("4DX", "Terminator").value();
+            BOOST_CHECK(std::find(seats.cbegin(), seats.cend(), seatNum) == seats.cend());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(Primary_ConcurrentAttach)
+    {
+        constexpr size_t followersCount { 4 };
+        Booking::BookingService service;
+        service.initialize();
+        Primary primary { service, 1ms };
+
+        std::vector<std::unique_ptr<Follower>> followers(followersCount);
+        {
+            std::vector<std::jthread> attaching;
+            for (std::unique_ptr<Follower>& follower: followers)
+                attaching.emplace_back([&primary, &follower] {
+                    const auto [primarySocket, followerSocket] = socketPair();
+                    primary.attach(primarySocket);
+                    follower = std::make_unique<Follower>(followerSocket, 1s);
+                });
+        }
+
+        BOOST_CHECK_EQUAL(primary.followersCount(), followersCount);
+        for (const std::unique_ptr<Follower>& follower: followers) {
+            BOOST_REQUIRE(follower->waitUntilSynced(Clock::now(), syncTimeout));
+            BOOST_CHECK_EQUAL(follower->getMovies().value().size(), service.getMovies().size());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(Follower_BoundedStaleness)
+    {
+        Booking::BookingService service;
+        service.initialize();
+        const auto [primarySocket, followerSocket] = socketPair();
+        std::optional<Primary> primary;
+        primary.emplace(service, 1ms);
+        primary->attach(primarySocket);
+
+        Follower follower { followerSocket, 50ms };
+        BOOST_REQUIRE(follower.waitUntilSynced(Clock::now(), syncTimeout));
+        BOOST_CHECK(follower.getMovies());
+
+        // No heartbeats from the stopped primary: the follower refuses to serve the stale state
+        primary.reset();
+        BOOST_CHECK(eventually([&] { return !follower.isConnected(); }));
+        BOOST_CHECK(eventually([&] { return !follower.getMovies(); }));
+        BOOST_CHECK(!follower.getSeatsAvailable("4DX", "Terminator"));
+    }
+
+    BOOST_AUTO_TEST_CASE(TwoProcesses)
+    {
+        const auto [primarySocket, followerSocket] = socketPair();
+        const pid_t pid = ::fork();
+        BOOST_REQUIRE_GE(pid, 0);
+        if (0 == pid)
+        {
+            // The primary process: makes the changes and ships them until the follower disconnects
+            ::close(followerSocket);
+            Booking::BookingService service;
+            service.initialize();
+            Primary primary { service, 1ms };
+            primary.attach(primarySocket);
+            primary.addTheater("Rex");
+            primary.scheduleMovie("Terminator", "Rex");
+            const bool booked = service.getPremiere("Rex", "Terminator").value()->bookSeats({1, 2, 3});
+            while (primary.followersCount() > 0)
+                std::this_thread::sleep_for(1ms);
+            ::_exit(booked ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+
+        ::close(primarySocket);
+        {
+            Follower follower { followerSocket, 1s };
+            BOOST_CHECK(eventually([&] {
+                const std::optional<std::vector<uint16_t>> seats = follower.getSeatsAvailable("Rex", "Terminator");
+                return seats && !seats->empty() && 4 == seats->front();
+            }));
+            BOOST_CHECK_EQUAL(follower.getTheatersByMovie("Terminator").value().size(), 2);
+
+            const LagStatistics lag = follower.getLag();
+            BOOST_CHECK_GT(lag.count, 0);
+            BOOST_TEST_MESSAGE("Replication lag: mean " << lag.mean().count() << " ns, max " << lag.max.count() << " ns");
+        }
+
+        int status = 0;
+        BOOST_REQUIRE_EQUAL(::waitpid(pid, &status, 0), pid);
+        BOOST_CHECK(WIFEXITED(status) && EXIT_SUCCESS == WEXITSTATUS(status));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,123 @@
+/**============================================================================
+Name        : response_cache_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Pre-rendered catalog listings cache tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+#include "BookingService.h"
+#include "CLI.h"
+
+#define CHECK_CONTAINS(str, txt)   BOOST_CHECK_NE(str.find(txt), std::string::npos);
+
+using namespace Booking;
+using CLI::ResponseCache;
+using namespace std::string_view_literals;
+
+namespace
+{
+    std::string execute(CLI::SimpleCLI& cli, std::stringstream& ss, std::string_view command)
+    {
+        ss.str("");
+        BOOST_REQUIRE(cli.processCommand(command) == CLI::SimpleCLI::Status::Continue);
+        return ss.str();
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(ResponseCacheTests)
+
+    BOOST_AUTO_TEST_CASE(Versions_Replace_Responses)
+    {
+        ResponseCache cache { 3 };
+        BOOST_CHECK(!cache.find(ResponseCache::Listing::Movies, "", 1));
+
+        const ResponseCache::Response movies = cache.store(ResponseCache::Listing::Movies, "", 1, "\tMovie\n");
+        BOOST_CHECK_EQUAL(cache.find(ResponseCache::Listing::Movies, "", 1).get(), movies.get());
+        BOOST_CHECK(!cache.find(ResponseCache::Listing::PlayingMovies, "", 1));
+        BOOST_CHECK(!cache.find(ResponseCache::Listing::Movies, "genre=drama", 1));
+        BOOST_CHECK(!cache.find(ResponseCache::Listing::Movies, "", 2));
+
+        // Rendered concurrently: the response cached first is served by everyone
+        BOOST_CHECK_EQUAL(cache.store(ResponseCache::Listing::Movies, "", 1, "\tMovie\n").get(), movies.get());
+
+        // No room: served, but not cached
+        cache.store(ResponseCache::Listing::Theaters, "", 1, "\tTheater\n");
+        cache.store(ResponseCache::Listing::TheatersByMovie, "Movie", 1, "\tTheater\n");
+        BOOST_CHECK_EQUAL(*cache.store(ResponseCache::Listing::PlayingMovies, "", 1, "\tMovie\n"), "\tMovie\n");
+        BOOST_CHECK_EQUAL(cache.size(), 3);
+        BOOST_CHECK(!cache.find(ResponseCache::Listing::PlayingMovies, "", 1));
+
+        // The newer catalog version drops the older responses, the outdated responses are never cached
+        cache.store(ResponseCache::Listing::Movies, "", 2, "\tMovie\n\tAnother Movie\n");
+        BOOST_CHECK_EQUAL(cache.size(), 1);
+        BOOST_CHECK(!cache.find(ResponseCache::Listing::Theaters, "", 1));
+        cache.store(ResponseCache::Listing::Theaters, "", 1, "\tTheater\n");
+        BOOST_CHECK(!cache.find(ResponseCache::Listing::Theaters, "", 2));
+        BOOST_CHECK_EQUAL(*cache.find(ResponseCache::Listing::Movies, "", 2), "\tMovie\n\tAnother Movie\n");
+    }
+
+    BOOST_AUTO_TEST_CASE(CLI_Listings_InvalidatedByCatalogChanges)
+    {
+        BookingService service;
+        service.initialize();
+        std::stringstream ss;
+        CLI::SimpleCLI cli { service, ss };
+
+        const std::string movies = execute(cli, ss, "list_movies");
+        CHECK_CONTAINS(movies, "\tFight Club\n");
+        BOOST_CHECK_EQUAL(execute(cli, ss, "list_movies"), movies);
+        const std::string playing = execute(cli, ss, "list_playing_movies");
+        const std::string theaters = execute(cli, ss, "list_theaters");
+        CHECK_CONTAINS(execute(cli, ss, "find_theaters Fight Club"), "\t4DX\n");
+        CHECK_CONTAINS(execute(cli, ss, "list_movies genre=western"), "Incorrect filter: 'genre=western'");
+        CHECK_CONTAINS(execute(cli, ss, "list_movies genre=western"), "Incorrect filter: 'genre=western'");
+
+        const uint64_t version = service.getCatalogVersion();
+        service.addMovie("Dune", MovieInfo { Genre::SciFi, Rating::PG13, "en", Format::IMAX, 155 });
+        BOOST_CHECK_GT(service.getCatalogVersion(), version);
+        const std::string moviesAdded = execute(cli, ss, "list_movies");
+        CHECK_CONTAINS(moviesAdded, "\tDune\n");
+        BOOST_CHECK_EQUAL(moviesAdded.size(), movies.size() + "\tDune\n"sv.size());
+        BOOST_CHECK_EQUAL(execute(cli, ss, "list_playing_movies"), playing);
+
+        service.addTheater("Paris Theater");
+        const std::string theatersAdded = execute(cli, ss, "list_theaters");
+        CHECK_CONTAINS(theatersAdded, "\tParis Theater\n");
+        BOOST_CHECK_EQUAL(theatersAdded.size(), theaters.size() + "\tParis Theater\n"sv.size());
+
+        BOOST_REQUIRE(service.scheduleMovie("Dune", "Paris Theater"));
+        CHECK_CONTAINS(execute(cli, ss, "list_playing_movies"), "\tDune\n");
+        BOOST_CHECK_EQUAL(execute(cli, ss, "list_playing_movies genre=scifi format=imax"), "\tInception\n\tDune\n");
+        BOOST_CHECK_EQUAL(execute(cli, ss, "find_theaters Dune"), "The movie 'Dune' is being shown in:\n"
+                                                                  "\tParis Theater\n");
+
+        BOOST_REQUIRE(service.unscheduleMovie("Dune", "Paris Theater"));
+        BOOST_CHECK_EQUAL(execute(cli, ss, "find_theaters Dune"), "The movie 'Dune' is being shown in:\n");
+        BOOST_REQUIRE(service.removeMovie("Dune"));
+        BOOST_CHECK_EQUAL(execute(cli, ss, "list_movies"), movies);
+    }
+
+    BOOST_AUTO_TEST_CASE(CLI_SharedCache)
+    {
+        BookingService service;
+        service.initialize();
+        ResponseCache cache;
+        std::stringstream first, second;
+        CLI::SimpleCLI firstCli { service, first }, secondCli { service, second };
+        firstCli.setResponseCache(cache);
+        secondCli.setResponseCache(cache);
+
+        BOOST_CHECK_EQUAL(execute(firstCli, first, "list_theaters"), execute(secondCli, second, "list_theaters"));
+        BOOST_CHECK_EQUAL(execute(firstCli, first, "list_movies rating=pg"),
+                          execute(secondCli, second, "list_movies rating=pg"));
+        BOOST_CHECK_EQUAL(cache.size(), 2);
+        CHECK_CONTAINS(second.str(), "\tHarry Potter and the Sorcerer's Stone\n");
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,137 @@
+/**============================================================================
+Name        : search_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Prefix and fuzzy search index tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+
+#include "SearchIndex.h"
+#include "BookingService.h"
+#include "CLI.h"
+
+#define CHECK_CONTAINS(str, txt)   BOOST_CHECK_NE(str.find(txt), std::string::npos);
+
+namespace
+{
+    struct SearchFixture
+    {
+        DB::SearchIndex index;
+
+        SearchFixture()
+        {
+            index.add("The Lord of the Rings: The Fellowship of the Ring", 1);
+            index.add("The Lord of the Rings: The Two Towers", 2);
+            index.add("Terminator", 3);
+            index.add("Terminator 2: Judgment Day", 4);
+            index.add("The Green Mile", 5);
+            index.add("Inception", 6);
+        }
+
+        static std::vector<size_t> ids(const std::vector<DB::SearchIndex::Match>& matches)
+        {
+            std::vector<size_t> result;
+            for (const auto& match: matches)
+                result.push_back(match.id);
+            return result;
+        }
+    };
+}
+
+BOOST_FIXTURE_TEST_SUITE(SearchIndexTests, SearchFixture)
+
+    BOOST_AUTO_TEST_CASE(Normalize)
+    {
+        BOOST_CHECK_EQUAL(DB::SearchIndex::normalize("  Terminator 2:  Judgment Day! "), "terminator 2 judgment day");
+    }
+
+    BOOST_AUTO_TEST_CASE(Prefix_NameStart_ShorterFirst)
+    {
+        BOOST_CHECK((ids(index.searchPrefix("term", 10)) == std::vector<size_t>{3, 4}));
+    }
+
+    BOOST_AUTO_TEST_CASE(Prefix_WordInside_CaseInsensitive)
+    {
+        BOOST_CHECK((ids(index.searchPrefix("TWO tow", 10)) == std::vector<size_t>{2}));
+        BOOST_CHECK((ids(index.searchPrefix("green", 10)) == std::vector<size_t>{5}));
+        BOOST_CHECK(index.searchPrefix("towers two", 10).empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(Prefix_TopK)
+    {
+        BOOST_CHECK_EQUAL(index.searchPrefix("the", 2).size(), 2);
+        BOOST_CHECK_EQUAL(index.searchPrefix("the", 10).size(), 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(Fuzzy_Typos)
+    {
+        BOOST_CHECK_EQUAL(index.searchFuzzy("Incepiton", 1).front().id, 6);
+        BOOST_CHECK_EQUAL(index.searchFuzzy("Terminatr", 1).front().id, 3);
+        BOOST_CHECK(index.searchFuzzy("xyzzy", 10).empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(AddAfterQuery_Indexed)
+    {
+        BOOST_REQUIRE(index.searchPrefix("pulp", 10).empty());
+        index.add("Pulp Fiction", 7);
+        BOOST_CHECK((ids(index.searchPrefix("pulp", 10)) == std::vector<size_t>{7}));
+        BOOST_CHECK((ids(index.searchPrefix("fict", 10)) == std::vector<size_t>{7}));
+    }
+
+    BOOST_AUTO_TEST_CASE(Remove_NotFound_Compacted)
+    {
+        index.remove(3);
+        BOOST_CHECK_EQUAL(index.size(), 5);
+        BOOST_CHECK((ids(index.searchPrefix("term", 10)) == std::vector<size_t>{4}));
+        BOOST_CHECK(index.searchFuzzy("Terminatr", 10).front().id != 3);
+
+        // More than a half removed: the index is rebuilt without them
+        for (size_t id: {1, 2, 4})
+            index.remove(id);
+        BOOST_CHECK_EQUAL(index.size(), 2);
+        BOOST_CHECK(index.searchPrefix("the", 10).size() == 1);
+        BOOST_CHECK((ids(index.searchPrefix("incep", 10)) == std::vector<size_t>{6}));
+        index.add("Terminator", 3);
+        BOOST_CHECK((ids(index.searchPrefix("term", 10)) == std::vector<size_t>{3}));
+    }
+
+    BOOST_AUTO_TEST_CASE(Combined_PrefixThenFuzzy)
+    {
+        const std::vector<size_t> found = ids(index.search("Greeen Mile", 10));
+        BOOST_REQUIRE(!found.empty());
+        BOOST_CHECK_EQUAL(found.front(), 5);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(SearchCLITests)
+
+    BOOST_AUTO_TEST_CASE(SearchMovies_And_Theaters)
+    {
+        Booking::BookingService service;
+        service.addMovie("Fight Club");
+        service.addMovie("Inception");
+        service.addTheater("Electric Cinema");
+        service.addTheater("Odeon");
+
+        std::stringstream ss;
+        CLI::SimpleCLI cli { service, ss };
+
+        BOOST_CHECK(cli.processCommand("search_movies fig") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "Fight Club");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("search_theaters Electrik Cinema") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "Electric Cinema");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("search_movies") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "Search query expected");
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,115 @@
+/**============================================================================
+Name        : seat_map_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Capacity-specialized seat maps tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "SeatMap.h"
+
+using namespace Booking;
+
+static_assert(std::is_same_v<SeatMapFor<20>, SmallSeatMap<20>>);
+static_assert(std::is_same_v<SeatMapFor<64>, SmallSeatMap<64>>);
+static_assert(std::is_same_v<SeatMapFor<65>, FixedSeatMap<65>>);
+static_assert(std::is_same_v<SeatMapFor<mediumCapacityMax>, FixedSeatMap<mediumCapacityMax>>);
+static_assert(std::is_same_v<SeatMapFor<mediumCapacityMax + 1>, DynamicSeatMap>);
+
+namespace
+{
+    /** The seat maps of each class with the last seat in the middle of the word **/
+    struct SmallMap: SmallSeatMap<40> { SmallMap(): SmallSeatMap { 40 } {} };
+    struct MediumMap: FixedSeatMap<130> { MediumMap(): FixedSeatMap { 130 } {} };
+    struct LargeMap: DynamicSeatMap { LargeMap(): DynamicSeatMap { 2000 } {} };
+
+    using SeatMapTypes = boost::mpl::list<SmallMap, MediumMap, LargeMap>;
+
+    template<typename SeatMap>
+    std::vector<uint16_t> available(const SeatMap& seatMap)
+    {
+        std::vector<uint16_t> seats;
+        seatMap.forEachAvailable([&seats](uint16_t seat) { seats.push_back(seat); });
+        return seats;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(SeatMapTests)
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(Book_AllOrNothing, SeatMap, SeatMapTypes)
+    {
+        SeatMap seatMap;
+        const uint16_t last = static_cast<uint16_t>(seatMap.capacity());
+        const uint16_t beforeLast = last - 1;
+
+        BOOST_CHECK(seatMap.book(std::vector<uint16_t> {1, 2, last}));
+        BOOST_CHECK(seatMap.isBooked(1) && seatMap.isBooked(last) && !seatMap.isBooked(3));
+
+        // Booked already, repeated, out of the range: none of the seats is booked
+        BOOST_CHECK(!seatMap.book(std::vector<uint16_t> {3, 2}));
+        BOOST_CHECK(!seatMap.book(std::vector<uint16_t> {4, 4}));
+        BOOST_CHECK(!seatMap.book(std::vector<uint16_t> {5, static_cast<uint16_t>(last + 1)}));
+        BOOST_CHECK(!seatMap.book(std::vector<uint16_t> {0}));
+        BOOST_CHECK(!seatMap.bookExclusive(std::vector<uint16_t> {6, 1}));
+        BOOST_CHECK_EQUAL(seatMap.bookedCount(), 3);
+        BOOST_CHECK(seatMap.bookExclusive(std::vector<uint16_t> {beforeLast}));
+        seatMap.release(beforeLast);
+
+        const std::vector<uint16_t> seats = available(seatMap);
+        BOOST_CHECK_EQUAL(seats.size(), seatMap.capacity() - 3);
+        BOOST_CHECK_EQUAL(seats.front(), 3);
+        BOOST_CHECK_EQUAL(seats.back(), beforeLast);
+
+        seatMap.release(2);
+        BOOST_CHECK(!seatMap.isBooked(2));
+        seatMap.reset();
+        BOOST_CHECK_EQUAL(seatMap.bookedCount(), 0);
+        BOOST_CHECK_EQUAL(available(seatMap).size(), seatMap.capacity());
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(Words_Bitmap, SeatMap, SeatMapTypes)
+    {
+        SeatMap seatMap;
+        BOOST_REQUIRE(seatMap.book(std::vector<uint16_t> {1, 3}));
+        BOOST_CHECK_EQUAL(seatMap.word(0), 0b101);
+
+        seatMap.setWord(0, 0b110);
+        BOOST_CHECK((available(seatMap).front() == 1 && seatMap.isBooked(2) && seatMap.isBooked(3)));
+    }
+
+    BOOST_AUTO_TEST_CASE(Small_FullWord)
+    {
+        SmallSeatMap<64> seatMap;
+        BOOST_CHECK(seatMap.book(std::vector<uint16_t> {64}));
+        BOOST_CHECK_EQUAL(available(seatMap).size(), 63);
+        seatMap.setWord(0, ~uint64_t { 0 });
+        BOOST_CHECK_EQUAL(seatMap.bookedCount(), 64);
+        BOOST_CHECK(available(seatMap).empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(Small_Concurrent_NoOverbooking)
+    {
+        SmallSeatMap<64> seatMap;
+        std::atomic<size_t> booked { 0 };
+        {
+            std::vector<std::jthread> threads;
+            for (size_t threadIdx = 0; threadIdx < 4; ++threadIdx)
+                threads.emplace_back([&] {
+                    // Overlapping pairs: each seat is booked by a single request only
+                    for (uint16_t seat = 1; seat < 64; ++seat)
+                        if (seatMap.book(std::vector<uint16_t> {seat, static_cast<uint16_t>(seat + 1)}))
+                            booked.fetch_add(2);
+                });
+        }
+        BOOST_CHECK_EQUAL(booked.load(), seatMap.bookedCount());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,129 @@
+/**============================================================================
+Name        : sharded_service_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : ShardedBookingService tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <thread>
+#include <atomic>
+
+#include "ShardedBookingService.h"
+
+using namespace Booking;
+
+namespace
+{
+    struct ShardedFixture
+    {
+        BookingService service;
+
+        ShardedFixture()
+        {
+            for (const char* movie: {"Fight Club", "Terminator", "Inception"})
+                service.addMovie(movie);
+            for (const char* theater: {"4DX", "Electric Cinema", "Sun Pictures"})
+                service.addTheater(theater);
+
+            service.scheduleMovie("Fight Club", "4DX");
+            service.scheduleMovie("Fight Club", "Electric Cinema");
+            service.scheduleMovie("Terminator", "Sun Pictures");
+            service.scheduleMovie("Terminator", "4DX");
+            service.scheduleMovie("Inception", "Electric Cinema");
+        }
+    };
+}
+
+BOOST_FIXTURE_TEST_SUITE(ShardedServiceTests, ShardedFixture)
+
+    BOOST_AUTO_TEST_CASE(SeatsAvailable_AllPremieres)
+    {
+        ShardedBookingService sharded { service, 2 };
+        BOOST_CHECK_EQUAL(sharded.getShardsCount(), 2);
+
+        for (const auto& [theater, movie]: std::vector<std::pair<std::string, std::string>>{
+                {"4DX", "Fight Club"}, {"Electric Cinema", "Fight Club"}, {"Sun Pictures", "Terminator"},
+                {"4DX", "Terminator"}, {"Electric Cinema", "Inception"}})
+        {
+            BOOST_CHECK_EQUAL(sharded.getSeatsAvailable(theater, movie).get().size(), Theater::seatsCapacityMax);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(NotScheduled_Premiere)
+    {
+        ShardedBookingService sharded { service, 2 };
+        BOOST_CHECK_EQUAL(sharded.getSeatsAvailable("4DX", "Inception").get().empty(), true);
+        BOOST_CHECK_EQUAL(sharded.bookSeats("4DX", "Inception", {1}).get(), false);
+        BOOST_CHECK_EQUAL(sharded.bookSeats("No Such Theater", "Inception", {1}).get(), false);
+    }
+
+    BOOST_AUTO_TEST_CASE(CatalogReplica_WideIds_Distinct)
+    {
+        constexpr size_t wide { size_t { 1 } << 32 };
+        CatalogReplica catalog { service };
+        catalog.premiereIndex.clear();
+        catalog.premiereIndex.emplace(CatalogReplica::PremiereKey { 5, 7 }, 0);
+        catalog.premiereIndex.emplace(CatalogReplica::PremiereKey { 5, 7 + wide }, 1);
+        catalog.premiereIndex.emplace(CatalogReplica::PremiereKey { 5 + wide, 7 }, 2);
+
+        BOOST_CHECK_EQUAL(catalog.findPremiere(5, 7).value(), 0);
+        BOOST_CHECK_EQUAL(catalog.findPremiere(5, 7 + wide).value(), 1);
+        BOOST_CHECK_EQUAL(catalog.findPremiere(5 + wide, 7).value(), 2);
+        BOOST_CHECK(!catalog.findPremiere(5 + wide, 7 + wide));
+    }
+
+    BOOST_AUTO_TEST_CASE(BookSeats_StateCopiedFromService)
+    {
+        BOOST_REQUIRE(service.getPremiere("4DX", "Terminator").value()->bookSeats({1, 2}));
+
+        ShardedBookingService sharded { service, 3 };
+        BOOST_CHECK_EQUAL(sharded.bookSeats("4DX", "Terminator", {2, 3}).get(), false);
+        BOOST_CHECK_EQUAL(sharded.bookSeats("4DX", "Terminator", {3, 4}).get(), true);
+        BOOST_CHECK_EQUAL(sharded.getSeatsAvailable("4DX", "Terminator").get().size(),
+                          Theater::seatsCapacityMax - 4);
+    }
+
+    BOOST_AUTO_TEST_CASE(BookSeats_PublishedToShardedStream)
+    {
+        std::optional<ChangeStream::Consumer> sourceConsumer = service.changeStream.subscribe();
+        ShardedBookingService sharded { service, 2 };
+        std::optional<ChangeStream::Consumer> shardedConsumer = sharded.getChangeStream().subscribe();
+        BOOST_REQUIRE(sourceConsumer && shardedConsumer);
+
+        BOOST_REQUIRE(sharded.bookSeats("4DX", "Terminator", {1, 3}).get());
+
+        // The shards copies are not the source premieres: nothing is published to the source service
+        std::array<SeatChange, 4> events {};
+        BOOST_CHECK_EQUAL(sourceConsumer->poll(events).count, 0);
+        BOOST_REQUIRE_EQUAL(shardedConsumer->poll(events).count, 1);
+        BOOST_CHECK_EQUAL(events[0].premiereId, service.getPremiere("4DX", "Terminator").value()->id);
+        BOOST_CHECK_EQUAL(events[0].seatsDelta, 0b101u);
+
+        const size_t movieId = service.findMovie("Terminator").value()->id;
+        BOOST_CHECK_EQUAL(sharded.getTrending().estimate(TrendingTracker::Kind::Movie, movieId), 1);
+        BOOST_CHECK_EQUAL(service.trending.estimate(TrendingTracker::Kind::Movie, movieId), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE(BookSeats_Concurrent_NoOverbooking)
+    {
+        ShardedBookingService sharded { service, 2 };
+        std::atomic<size_t> seatsBooked { 0 };
+        {
+            std::vector<std::jthread> clients;
+            for (size_t i = 0; i < 4; ++i) {
+                clients.emplace_back([&] {
+                    for (uint16_t seat = 1; seat <= Theater::seatsCapacityMax; ++seat)
+                        if (sharded.bookSeats("Electric Cinema", "Inception", {seat}).get())
+                            seatsBooked.fetch_add(1);
+                });
+            }
+        }
+        BOOST_CHECK_EQUAL(seatsBooked.load(), Theater::seatsCapacityMax);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
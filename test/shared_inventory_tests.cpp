@@ -0,0 +1,248 @@
+/**============================================================================
+Name        : shared_inventory_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Shared-memory seat inventory tests (multi-process booking)
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <bit>
+#include <random>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "SharedInventory.h"
+
+using namespace Ipc;
+
+namespace
+{
+    std::string segmentName(std::string_view test) {
+        return "booking-inventory-" + std::string { test } + "-" + std::to_string(::getpid());
+    }
+
+    bool exitedSuccessfully(pid_t pid)
+    {
+        int status = 0;
+        return pid == ::waitpid(pid, &status, 0) && WIFEXITED(status) && EXIT_SUCCESS == WEXITSTATUS(status);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(SharedInventoryTests)
+
+    BOOST_AUTO_TEST_CASE(Load_Find_Book)
+    {
+        Booking::BookingService service;
+        service.initialize();
+        BOOST_REQUIRE(service.getPremiere("4DX", "Terminator").value()->bookSeats({1, 2}));
+
+        const std::string name = segmentName("load");
+        SharedInventory inventory { name, InventoryLayout {} };
+        BOOST_REQUIRE(inventory.isAttached());
+        BOOST_CHECK(!SharedInventory(name, InventoryLayout {}).isAttached());
+        BOOST_CHECK(!SharedInventory { segmentName("missing") }.isAttached());
+        BOOST_REQUIRE(inventory.load(service));
+
+        // Mapped at another address: the catalog is reached by the offsets
+        SharedInventory frontEnd { name };
+        BOOST_REQUIRE(frontEnd.isAttached());
+        const std::optional<uint32_t> movieId = frontEnd.findMovie("Terminator");
+        const std::optional<uint32_t> theaterId = frontEnd.findTheater("4DX");
+        BOOST_REQUIRE(movieId && theaterId);
+        BOOST_CHECK_EQUAL(movieId.value(), service.findMovie("Terminator").value()->id);
+        BOOST_CHECK(!frontEnd.findMovie("Terminator 3"));
+
+        const uint32_t theater = theaterId.value(), movie = movieId.value();
+        BOOST_CHECK(frontEnd.getSeatsAvailable(theater, movie).value() == service.getSeatsAvailable("4DX", "Terminator"));
+        BOOST_CHECK(Status::Rejected == frontEnd.bookSeats(theater, movie, std::vector<uint16_t> {2, 3}));
+        BOOST_CHECK(Status::Rejected == frontEnd.bookSeats(theater, movie, std::vector<uint16_t> {3, 3}));
+        BOOST_CHECK(Status::Rejected == frontEnd.bookSeats(theater, movie, std::vector<uint16_t> {21}));
+        BOOST_CHECK(Status::Ok == frontEnd.bookSeats(theater, movie, std::vector<uint16_t> {3, 20}));
+        BOOST_CHECK(Status::NotFound == frontEnd.bookSeats(0, movie, std::vector<uint16_t> {4}));
+
+        const std::optional<std::vector<uint16_t>> seats = inventory.getSeatsAvailable(theater, movie);
+        BOOST_REQUIRE(seats);
+        BOOST_CHECK_EQUAL(seats->size(), Booking::Theater::seatsCapacityMax - 4);
+        BOOST_CHECK_EQUAL(seats->front(), 4);
+
+        BOOST_CHECK(!inventory.addPremiere(theater, movie));
+        BOOST_CHECK(!inventory.addMovie(1'000, std::string(64, 'x')));
+    }
+
+    BOOST_AUTO_TEST_CASE(Share_ServicesBookThroughInventory)
+    {
+        Booking::BookingService service;
+        service.initialize();
+        BOOST_REQUIRE(service.getPremiere("4DX", "Terminator").value()->bookSeats({1}));
+
+        const std::string name = segmentName("share");
+        SharedInventory inventory { name, InventoryLayout {} };
+        BOOST_REQUIRE(inventory.isAttached() && inventory.load(service));
+        BOOST_CHECK_EQUAL(inventory.share(service), service.bookingSchedule.size());
+
+        Booking::Premiere* premiere = service.getPremiere("4DX", "Terminator").value();
+        SharedInventory frontEnd { name };
+        const uint32_t theater = frontEnd.findTheater("4DX").value(), movie = frontEnd.findMovie("Terminator").value();
+
+        // The seats booked by the front end are taken for the service and vice versa
+        BOOST_REQUIRE(Status::Ok == frontEnd.bookSeats(theater, movie, std::vector<uint16_t> {3, 4}));
+        BOOST_CHECK_EQUAL(premiere->getSeatsAvailable().size(), Booking::Theater::seatsCapacityMax - 3);
+        BOOST_CHECK(!premiere->bookSeats({4, 5}));
+        BOOST_CHECK(premiere->bookSeats({5, 6}));
+        BOOST_CHECK(Status::Rejected == frontEnd.bookSeats(theater, movie, std::vector<uint16_t> {6}));
+
+        // Another process books through its own copy of the service
+        const pid_t pid = ::fork();
+        BOOST_REQUIRE(pid >= 0);
+        if (0 == pid)
+            ::_exit(premiere->bookSeats({7, 8}) && !premiere->bookSeats({3}) ? EXIT_SUCCESS : EXIT_FAILURE);
+        BOOST_REQUIRE(exitedSuccessfully(pid));
+
+        BOOST_CHECK(!premiere->bookSeats({8}));
+        BOOST_CHECK_EQUAL(frontEnd.findPremiere(theater, movie)->seatsBooked.load(), 0b1111'1101u);
+        BOOST_CHECK_EQUAL(premiere->seatsBooked.load(), 0b1111'1101u);
+    }
+
+    BOOST_AUTO_TEST_CASE(Processes_NoOverbooking)
+    {
+        constexpr size_t processesCount { 4 };
+        constexpr size_t bookingsCount { 20'000 };
+
+        Booking::BookingService service;
+        service.initialize();
+        const std::string name = segmentName("stress");
+        SharedInventory inventory { name, InventoryLayout {} };
+        BOOST_REQUIRE(inventory.isAttached() && inventory.load(service));
+
+        std::vector<std::pair<uint32_t, uint32_t>> premieres;
+        for (size_t slot = 0; slot < service.bookingSchedule.size(); ++slot)
+            premieres.emplace_back(service.bookingSchedule.getTheaterIds()[slot],
+                                   service.bookingSchedule.getMovieIds()[slot]);
+
+        // The seats won by the each process for the each premiere: in the anonymous memory shared with the children
+        const size_t wonSize = processesCount * premieres.size() * sizeof(std::atomic<uint32_t>);
+        void* wonMemory = ::mmap(nullptr, wonSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        BOOST_REQUIRE(MAP_FAILED != wonMemory);
+        auto* won = new (wonMemory) std::atomic<uint32_t>[processesCount * premieres.size()] {};
+
+        std::vector<pid_t> processes;
+        for (size_t processIdx = 0; processIdx < processesCount; ++processIdx)
+        {
+            const pid_t pid = ::fork();
+            BOOST_REQUIRE(pid >= 0);
+            if (0 == pid) {
+                // The front-end process: maps the inventory on its own and books the random seats
+                SharedInventory frontEnd { name };
+                std::mt19937 generator { static_cast<uint32_t>(processIdx) };
+                for (size_t idx = 0; idx < bookingsCount && frontEnd.isAttached(); ++idx)
+                {
+                    const size_t premiereIdx = generator() % premieres.size();
+                    const auto [theaterId, movieId] = premieres[premiereIdx];
+                    const uint16_t first = static_cast<uint16_t>(1 + generator() % Booking::Theater::seatsCapacityMax);
+                    std::vector<uint16_t> seats;
+                    for (uint16_t seat = first; seat < first + 3 && seat <= Booking::Theater::seatsCapacityMax; ++seat)
+                        seats.push_back(seat);
+                    if (Status::Ok == frontEnd.bookSeats(theaterId, movieId, seats))
+                        for (const uint16_t seat: seats)
+                            won[processIdx * premieres.size() + premiereIdx].fetch_or(1u << (seat - 1));
+                }
+                ::_exit(frontEnd.isAttached() ? EXIT_SUCCESS : EXIT_FAILURE);
+            }
+            processes.push_back(pid);
+        }
+        for (const pid_t pid: processes)
+            BOOST_CHECK(exitedSuccessfully(pid));
+
+        size_t seatsBooked = 0;
+        for (size_t premiereIdx = 0; premiereIdx < premieres.size(); ++premiereIdx)
+        {
+            // Every seat is won by a single process only and every seat booked is won by someone
+            uint32_t wonSeats = 0;
+            for (size_t processIdx = 0; processIdx < processesCount; ++processIdx) {
+                const uint32_t seats = won[processIdx * premieres.size() + premiereIdx].load();
+                BOOST_CHECK_EQUAL(wonSeats & seats, 0u);
+                wonSeats |= seats;
+            }
+            const auto [theaterId, movieId] = premieres[premiereIdx];
+            const SharedPremiere* premiere = inventory.findPremiere(theaterId, movieId);
+            BOOST_REQUIRE(premiere);
+            BOOST_CHECK_EQUAL(premiere->seatsBooked.load(), wonSeats);
+            seatsBooked += std::popcount(wonSeats);
+        }
+        BOOST_CHECK_GT(seatsBooked, 0);
+        ::munmap(wonMemory, wonSize);
+    }
+
+    BOOST_AUTO_TEST_CASE(CatalogLock_OwnerDied_Recovered)
+    {
+        const std::string name = segmentName("robust");
+        SharedInventory inventory { name, InventoryLayout {} };
+        BOOST_REQUIRE(inventory.isAttached());
+        BOOST_REQUIRE(inventory.addMovie(1, "Movie") && inventory.addTheater(1, "Theater"));
+        BOOST_REQUIRE(inventory.addPremiere(1, 1));
+
+        const pid_t pid = ::fork();
+        BOOST_REQUIRE(pid >= 0);
+        if (0 == pid) {
+            // Dies in the middle of the catalog change, holding the lock
+            SharedInventory frontEnd { name };
+            const SharedInventory::CatalogLock lock { frontEnd };
+            ::_exit(EXIT_SUCCESS);
+        }
+        BOOST_REQUIRE(exitedSuccessfully(pid));
+
+        BOOST_CHECK_EQUAL(inventory.getRecoveries(), 0);
+        BOOST_CHECK(inventory.addMovie(2, "Another Movie"));
+        BOOST_CHECK_EQUAL(inventory.getRecoveries(), 1);
+        BOOST_CHECK(inventory.addPremiere(1, 2));
+        BOOST_CHECK_EQUAL(inventory.findMovie("Another Movie").value(), 2);
+        BOOST_CHECK(Status::Ok == inventory.bookSeats(1, 1, std::vector<uint16_t> {5}));
+        BOOST_CHECK(Status::Ok == inventory.bookSeats(1, 2, std::vector<uint16_t> {5}));
+    }
+
+    BOOST_AUTO_TEST_CASE(CatalogLock_NotRecoverable_ChangesFail)
+    {
+        const std::string name = segmentName("unrecoverable");
+        SharedInventory inventory { name, InventoryLayout {} };
+        BOOST_REQUIRE(inventory.isAttached());
+        BOOST_REQUIRE(inventory.addMovie(1, "Movie") && inventory.addTheater(1, "Theater"));
+        BOOST_REQUIRE(inventory.addPremiere(1, 1));
+
+        const pid_t pid = ::fork();
+        BOOST_REQUIRE(pid >= 0);
+        if (0 == pid) {
+            // Dies holding the lock
+            SharedInventory frontEnd { name };
+            const SharedInventory::CatalogLock lock { frontEnd };
+            ::_exit(EXIT_SUCCESS);
+        }
+        BOOST_REQUIRE(exitedSuccessfully(pid));
+
+        // The next taker of the lock releases it without making it consistent: the mutex is not usable anymore
+        const int fd = ::shm_open(('/' + name).c_str(), O_RDWR, 0);
+        BOOST_REQUIRE(fd >= 0);
+        void* address = ::mmap(nullptr, sizeof(InventoryHeader), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        BOOST_REQUIRE(MAP_FAILED != address);
+        pthread_mutex_t& mutex = static_cast<InventoryHeader*>(address)->mtxCatalog;
+        BOOST_REQUIRE_EQUAL(::pthread_mutex_lock(&mutex), EOWNERDEAD);
+        ::pthread_mutex_unlock(&mutex);
+        ::munmap(address, sizeof(InventoryHeader));
+
+        // The catalog changes fail instead of running without the lock; the bookings do not need it
+        BOOST_CHECK(!inventory.addMovie(2, "Another Movie"));
+        BOOST_CHECK(!inventory.addTheater(2, "Another Theater"));
+        BOOST_CHECK(!inventory.addPremiere(1, 2));
+        BOOST_CHECK(!inventory.findMovie("Another Movie"));
+        BOOST_CHECK_EQUAL(inventory.getRecoveries(), 0);
+        BOOST_CHECK(Status::Ok == inventory.bookSeats(1, 1, std::vector<uint16_t> {5}));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
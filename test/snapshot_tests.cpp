@@ -0,0 +1,151 @@
+/**============================================================================
+Name        : snapshot_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Catalog snapshots and epoch-based reclamation tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+#include <future>
+
+#include "BookingService.h"
+
+using namespace Booking;
+
+namespace
+{
+    struct Tracked
+    {
+        std::atomic<size_t>& destroyed;
+
+        explicit Tracked(std::atomic<size_t>& counter): destroyed { counter } {
+        }
+
+        ~Tracked() {
+            destroyed.fetch_add(1);
+        }
+    };
+
+    struct SnapshotFixture
+    {
+        BookingService service;
+
+        SnapshotFixture()
+        {
+            service.addMovie("Fight Club");
+            service.addMovie("Inception");
+            service.addTheater("4DX");
+            service.scheduleMovie("Fight Club", "4DX");
+        }
+    };
+}
+
+BOOST_AUTO_TEST_SUITE(EpochDomainTests)
+
+    BOOST_AUTO_TEST_CASE(Retired_NotDeleted_WhileReaderActive)
+    {
+        using Concurrency::EpochDomain;
+        std::atomic<size_t> destroyed { 0 };
+
+        std::promise<void> entered, retired;
+        std::jthread reader([&] {
+            EpochDomain::Guard guard;
+            entered.set_value();
+            retired.get_future().wait();
+        });
+
+        entered.get_future().wait();
+        EpochDomain::instance().retire(new Tracked { destroyed });
+        EpochDomain::instance().reclaim();
+        BOOST_CHECK_EQUAL(destroyed.load(), 0);
+
+        retired.set_value();
+        reader.join();
+        EpochDomain::instance().reclaim();
+        BOOST_CHECK_EQUAL(destroyed.load(), 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(Retired_Deleted_AfterNestedGuardsLeft)
+    {
+        using Concurrency::EpochDomain;
+        std::atomic<size_t> destroyed { 0 };
+        {
+            EpochDomain::Guard outer;
+            {
+                EpochDomain::Guard inner;
+                EpochDomain::instance().retire(new Tracked { destroyed });
+            }
+            EpochDomain::instance().reclaim();
+            BOOST_CHECK_EQUAL(destroyed.load(), 0);
+        }
+        EpochDomain::instance().reclaim();
+        BOOST_CHECK_EQUAL(destroyed.load(), 1);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_FIXTURE_TEST_SUITE(CatalogSnapshotTests, SnapshotFixture)
+
+    BOOST_AUTO_TEST_CASE(Views_MatchCatalog)
+    {
+        BOOST_CHECK_EQUAL(service.getMoviesView().size(), 2);
+        BOOST_CHECK_EQUAL(service.getTheatersView().size(), 1);
+
+        const auto playing = service.getPlayingMoviesView();
+        BOOST_REQUIRE_EQUAL(playing.size(), 1);
+        BOOST_CHECK_EQUAL(playing.entries().front()->name, "Fight Club");
+    }
+
+    BOOST_AUTO_TEST_CASE(View_SameVersion_UntilCatalogChanges)
+    {
+        const uint64_t version = service.getMoviesView().version();
+        BOOST_CHECK_EQUAL(service.getMoviesView().version(), version);
+
+        service.addMovie("Terminator");
+        BOOST_CHECK_EQUAL(service.getMoviesView().version(), version + 1);
+        BOOST_CHECK_EQUAL(service.getMoviesView().size(), 3);
+    }
+
+    BOOST_AUTO_TEST_CASE(OldView_StaysValid_AfterUpdate)
+    {
+        const SnapshotView<Movie> oldView = service.getPlayingMoviesView();
+
+        service.scheduleMovie("Inception", "4DX");
+        const SnapshotView<Movie> newView = service.getPlayingMoviesView();
+
+        BOOST_CHECK_EQUAL(oldView.size(), 1);
+        BOOST_CHECK_EQUAL(newView.size(), 2);
+        BOOST_CHECK_LT(oldView.version(), newView.version());
+    }
+
+    BOOST_AUTO_TEST_CASE(ConcurrentReaders_WithUpdates)
+    {
+        std::atomic<bool> stop { false };
+        std::atomic<bool> consistent { true };
+        std::vector<std::jthread> readers;
+        for (size_t i = 0; i < 4; ++i) {
+            readers.emplace_back([&] {
+                while (!stop.load()) {
+                    const SnapshotView<Movie> view = service.getMoviesView();
+                    for (const Movie* movie: view)
+                        if (nullptr == movie || movie->name.empty())
+                            consistent.store(false);
+                }
+            });
+        }
+
+        for (size_t idx = 0; idx < 100; ++idx)
+            service.addMovie("Movie " + std::to_string(idx));
+        stop.store(true);
+        readers.clear();
+
+        BOOST_CHECK_EQUAL(consistent.load(), true);
+        BOOST_CHECK_EQUAL(service.getMoviesView().size(), 102);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,182 @@
+/**============================================================================
+Name        : tracing_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Tracing spans and Chrome trace export tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <unistd.h>
+
+#include "Tracing.h"
+#include "BookingService.h"
+#include "CLI.h"
+
+#define CHECK_CONTAINS(str, txt)   BOOST_CHECK_NE(str.find(txt), std::string::npos);
+
+using namespace Tracing;
+
+namespace
+{
+    /** The tracer is process-wide: each test starts with the tracing disabled and no events **/
+    struct TracerFixture
+    {
+        Tracer& tracer { Tracer::instance() };
+
+        TracerFixture() {
+            Tracer::setSampling(0);
+            tracer.clear();
+        }
+
+        ~TracerFixture() {
+            Tracer::setSampling(0);
+            tracer.clear();
+        }
+
+        std::pair<size_t, std::string> dump()
+        {
+            std::ostringstream output;
+            const size_t written = tracer.writeChromeTrace(output);
+            return std::make_pair(written, output.str());
+        }
+    };
+}
+
+BOOST_FIXTURE_TEST_SUITE(TracingTests, TracerFixture)
+
+    BOOST_AUTO_TEST_CASE(Disabled_NoEvents)
+    {
+        {
+            const Span span { "root" };
+            const Span nested { "nested" };
+        }
+        const auto [written, json] = dump();
+        BOOST_CHECK_EQUAL(written, 0);
+        BOOST_CHECK_EQUAL(json, "{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}\n");
+    }
+
+    BOOST_AUTO_TEST_CASE(Nested_Spans_ChromeTrace)
+    {
+        Tracer::setSampling(1);
+        {
+            const Span span { "root" };
+            const Span nested { "nested" };
+        }
+        const auto [written, json] = dump();
+        BOOST_CHECK_EQUAL(written, 2);
+        CHECK_CONTAINS(json, "{\"name\":\"root\",\"cat\":\"booking\",\"ph\":\"X\"");
+        CHECK_CONTAINS(json, "{\"name\":\"nested\",\"cat\":\"booking\",\"ph\":\"X\"");
+        CHECK_CONTAINS(json, "\"ph\":\"M\"");
+        // The nested span completes first
+        BOOST_CHECK_LT(json.find("\"nested\""), json.find("\"root\""));
+    }
+
+    BOOST_AUTO_TEST_CASE(Sampling_EveryNth_WholeRequest)
+    {
+        Tracer::setSampling(4);
+        for (size_t request = 0; request < 8; ++request) {
+            const Span span { "request" };
+            const Span nested { "nested" };
+        }
+        BOOST_CHECK_EQUAL(dump().first, 4);
+
+        // Switched off in the middle of the request: the request is still traced completely
+        tracer.clear();
+        Tracer::setSampling(1);
+        {
+            const Span span { "request" };
+            Tracer::setSampling(0);
+            const Span nested { "nested" };
+        }
+        BOOST_CHECK_EQUAL(dump().first, 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(Threads_OwnBuffers)
+    {
+        Tracer::setSampling(1);
+        {
+            const Span span { "main" };
+            std::jthread { [] { const Span span { "worker" }; } }.join();
+            std::jthread { [] { const Span span { "worker" }; } }.join();
+        }
+
+        // The buffers outlive the threads: the exited thread buffer is reused by the next one
+        const auto [written, json] = dump();
+        BOOST_CHECK_EQUAL(written, 3);
+        BOOST_CHECK_NE(json.find("\"name\":\"worker\""), json.rfind("\"name\":\"worker\""));
+        BOOST_CHECK_EQUAL(std::ranges::count(json, 'M'), 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(Ring_KeepsLatest)
+    {
+        Tracer::setSampling(1);
+        for (size_t idx = 0; idx < ThreadBuffer::capacity + 10; ++idx)
+            const Span span { "span" };
+        BOOST_CHECK_EQUAL(dump().first, ThreadBuffer::capacity);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_FIXTURE_TEST_SUITE(TracingCLITests, TracerFixture)
+
+    BOOST_AUTO_TEST_CASE(TraceSampling_And_Dump)
+    {
+        Booking::BookingService service;
+        service.initialize();
+        std::stringstream ss;
+        CLI::SimpleCLI cli { service, ss };
+
+        BOOST_CHECK(cli.processCommand("trace_sampling") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "Tracing is disabled");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("trace_sampling one") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "Incorrect sampling: 'one'");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("trace_sampling 1") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "Tracing every 1 request(s)");
+        BOOST_CHECK_EQUAL(Tracer::getSampling(), 1);
+
+        BOOST_CHECK(cli.processCommand("select_theater 4DX") == CLI::SimpleCLI::Status::Continue);
+        BOOST_CHECK(cli.processCommand("select_movie Terminator") == CLI::SimpleCLI::Status::Continue);
+        BOOST_CHECK(cli.processCommand("book_seats 1,2") == CLI::SimpleCLI::Status::Continue);
+        ss.str("");
+
+        const std::string fileName = "booking-trace-" + std::to_string(::getpid()) + ".json";
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / fileName;
+        cli.setTraceDirectory(std::filesystem::temp_directory_path());
+        BOOST_CHECK(cli.processCommand("trace_dump " + fileName) == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "trace events written to " + path.string());
+
+        std::ifstream file { path };
+        const std::string json { std::istreambuf_iterator<char> { file }, std::istreambuf_iterator<char> {} };
+        std::filesystem::remove(path);
+        for (const char* name: {"SimpleCLI::processCommand", "SimpleCLI::parseSeats", "BookingService::getPremiere",
+                                "Premiere::bookSeats", "Premiere::mtxBooking wait"})
+            CHECK_CONTAINS(json, std::string { "\"name\":\"" } + name + "\"");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("trace_dump") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "File name expected");
+
+        // The session input can not write outside the trace directory
+        for (const std::string& input: {path.string(), "../" + fileName, "traces/" + fileName, std::string { ".." }})
+        {
+            ss.str("");
+            BOOST_CHECK(cli.processCommand("trace_dump " + input) == CLI::SimpleCLI::Status::Continue);
+            CHECK_CONTAINS(ss.str(), "Incorrect file name: '" + input + "'");
+        }
+        BOOST_CHECK(!std::filesystem::exists(path));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,263 @@
+/**============================================================================
+Name        : trending_tests.cpp
+Created on  : 18.10.2026
+Author      : Andrei Tokmakov
+Version     : 1.0
+Copyright   : Your copyright notice
+Description : Count-min sketch, space-saving and trending movies tests
+============================================================================ **/
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+#include "BookingService.h"
+#include "CLI.h"
+
+#define CHECK_CONTAINS(str, txt)   BOOST_CHECK_NE(str.find(txt), std::string::npos);
+
+using namespace Booking;
+using namespace std::chrono_literals;
+
+namespace
+{
+    /** The skewed stream: the key K is drawn with the probability proportional to 1 / K **/
+    std::vector<uint64_t> zipfStream(size_t keysCount, size_t length)
+    {
+        std::vector<double> weights;
+        for (size_t key = 1; key <= keysCount; ++key)
+            weights.push_back(1.0 / static_cast<double>(key));
+        std::discrete_distribution<size_t> distribution { weights.begin(), weights.end() };
+        std::mt19937 generator { 7 };
+
+        std::vector<uint64_t> stream;
+        for (size_t idx = 0; idx < length; ++idx)
+            stream.push_back(distribution(generator) + 1);
+        return stream;
+    }
+
+    std::unordered_map<uint64_t, uint64_t> countExactly(const std::vector<uint64_t>& stream)
+    {
+        std::unordered_map<uint64_t, uint64_t> counts;
+        for (const uint64_t key: stream)
+            ++counts[key];
+        return counts;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(StreamingSummariesTests)
+
+    BOOST_AUTO_TEST_CASE(CountMinSketch_ErrorBound)
+    {
+        constexpr size_t width { 1'024 }, depth { 4 };
+        const std::vector<uint64_t> stream = zipfStream(20'000, 200'000);
+        const std::unordered_map<uint64_t, uint64_t> counts = countExactly(stream);
+
+        CountMinSketch sketch { width, depth };
+        for (const uint64_t key: stream)
+            sketch.add(key);
+
+        // Never underestimates; exceeds e / width * N with the probability of e^(-depth) at most
+        const double bound = std::exp(1.0) / width * static_cast<double>(stream.size());
+        size_t exceeded = 0;
+        for (const auto& [key, count]: counts) {
+            const uint64_t estimate = sketch.estimate(key);
+            BOOST_REQUIRE_GE(estimate, count);
+            if (static_cast<double>(estimate - count) > bound)
+                ++exceeded;
+        }
+        BOOST_CHECK_LE(static_cast<double>(exceeded), std::exp(-static_cast<double>(depth)) * counts.size());
+
+        // The sum of the sketches is the sketch of the whole stream
+        CountMinSketch first { width, depth }, second { width, depth };
+        for (size_t idx = 0; idx < stream.size(); ++idx)
+            (idx % 2 ? first : second).add(stream[idx]);
+        const std::array<const CountMinSketch*, 2> halves { &first, &second };
+        for (const uint64_t key: {1, 2, 100, 5'000})
+            BOOST_CHECK_EQUAL(CountMinSketch::estimate(halves, key), sketch.estimate(key));
+    }
+
+    BOOST_AUTO_TEST_CASE(SpaceSaving_HeavyHitters)
+    {
+        constexpr size_t capacity { 50 };
+        const std::vector<uint64_t> stream = zipfStream(20'000, 200'000);
+        const std::unordered_map<uint64_t, uint64_t> counts = countExactly(stream);
+
+        SpaceSaving summary { capacity };
+        for (const uint64_t key: stream)
+            summary.add(key);
+        BOOST_CHECK_EQUAL(summary.size(), capacity);
+
+        // Every key counted more than N / capacity times is monitored, the counts are within the errors
+        const uint64_t threshold = stream.size() / capacity;
+        const std::vector<SpaceSaving::Counter> counters = summary.getCounters();
+        for (const auto& [key, count]: counts)
+        {
+            const auto counter = std::find_if(counters.begin(), counters.end(), [key](const auto& counter) {
+                return counter.key == key;
+            });
+            if (count > threshold)
+                BOOST_REQUIRE(counters.end() != counter);
+            if (counters.end() != counter) {
+                BOOST_CHECK_GE(counter->count, count);
+                BOOST_CHECK_LE(counter->count - counter->error, count);
+                BOOST_CHECK_LE(counter->error, threshold);
+            }
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(TrendingTests)
+
+    BOOST_AUTO_TEST_CASE(SlidingWindow_Expires)
+    {
+        TrendingTracker tracker;
+        const TrendingTracker::Clock::time_point start { 1h };
+        for (size_t idx = 0; idx < 100; ++idx)
+            tracker.recordBooking(1, 10, start);
+        for (size_t idx = 0; idx < 50; ++idx)
+            tracker.recordBooking(2, 20, start + 4min);
+        tracker.recordBooking(3, 10, start + 4min);
+
+        const std::vector<TrendingEntry> movies = tracker.top(TrendingTracker::Kind::Movie, 2, start + 4min);
+        BOOST_REQUIRE_EQUAL(movies.size(), 2);
+        BOOST_CHECK(1 == movies[0].id && 100 == movies[0].bookings);
+        BOOST_CHECK(2 == movies[1].id && 50 == movies[1].bookings);
+        BOOST_CHECK_EQUAL(tracker.estimate(TrendingTracker::Kind::Theater, 10, start + 4min), 101);
+        BOOST_CHECK_EQUAL(tracker.getWindowTotal(start + 4min), 151);
+
+        // The bookings of the first minute are out of the window
+        const std::vector<TrendingEntry> theaters = tracker.top(TrendingTracker::Kind::Theater, 10, start + 6min);
+        BOOST_REQUIRE_EQUAL(theaters.size(), 2);
+        BOOST_CHECK(20 == theaters[0].id && 50 == theaters[0].bookings);
+        BOOST_CHECK(10 == theaters[1].id && 1 == theaters[1].bookings);
+        BOOST_CHECK(tracker.top(TrendingTracker::Kind::Movie, 10, start + 10min).empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(Estimate_ErrorBound)
+    {
+        TrendingTracker::Config config;
+        config.sketchWidth = 256;
+        TrendingTracker tracker { config };
+        const TrendingTracker::Clock::time_point now { 1h };
+        const std::vector<uint64_t> movies = zipfStream(5'000, 50'000);
+        const std::unordered_map<uint64_t, uint64_t> counts = countExactly(movies);
+        for (size_t idx = 0; idx < movies.size(); ++idx)
+            tracker.recordBooking(movies[idx], idx % 5'000 + 1, now);
+
+        // The theater keys of the bookings do not count against the bound of the movies: N is the window total
+        const uint64_t total = tracker.getWindowTotal(now);
+        BOOST_REQUIRE_EQUAL(total, movies.size());
+        const double bound = std::exp(1.0) / static_cast<double>(config.sketchWidth) * static_cast<double>(total);
+        size_t exceeded = 0;
+        for (const auto& [movieId, count]: counts) {
+            const uint64_t estimate = tracker.estimate(TrendingTracker::Kind::Movie, movieId, now);
+            BOOST_REQUIRE_GE(estimate, count);
+            if (static_cast<double>(estimate - count) > bound)
+                ++exceeded;
+        }
+        BOOST_CHECK_LE(static_cast<double>(exceeded),
+                       std::exp(-static_cast<double>(config.sketchDepth)) * static_cast<double>(counts.size()));
+    }
+
+    BOOST_AUTO_TEST_CASE(Estimate_NeverExceedsWindowTotal)
+    {
+        // The keys of the kind collide in the narrowest sketch, but never with the keys of the other kind
+        TrendingTracker::Config config;
+        config.sketchWidth = 2;
+        config.sketchDepth = 1;
+        TrendingTracker tracker { config };
+        const TrendingTracker::Clock::time_point now { 1h };
+        for (size_t idx = 0; idx < 100; ++idx)
+            tracker.recordBooking(idx % 3 + 1, idx % 7 + 1, now);
+
+        const uint64_t total = tracker.getWindowTotal(now);
+        for (size_t id = 1; id <= 7; ++id) {
+            BOOST_CHECK_LE(tracker.estimate(TrendingTracker::Kind::Movie, id, now), total);
+            BOOST_CHECK_LE(tracker.estimate(TrendingTracker::Kind::Theater, id, now), total);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(ConcurrentRecording_Counted)
+    {
+        constexpr size_t threadsCount { 8 };
+        constexpr size_t bookingsCount { 20'000 };
+        TrendingTracker::Config config;
+        config.stripeCapacity = 64;
+        TrendingTracker tracker { config };
+        const TrendingTracker::Clock::time_point now = TrendingTracker::Clock::now();
+        {
+            std::vector<std::jthread> threads;
+            for (size_t threadIdx = 0; threadIdx < threadsCount; ++threadIdx)
+                threads.emplace_back([&, threadIdx] {
+                    for (size_t idx = 0; idx < bookingsCount; ++idx)
+                        tracker.recordBooking(0 == idx % 2 ? 1 : 2 + (idx + threadIdx) % 100, 1, now);
+                });
+        }
+
+        BOOST_CHECK_EQUAL(tracker.getWindowTotal(now) + tracker.getDropped(), threadsCount * bookingsCount);
+        const std::vector<TrendingEntry> movies = tracker.top(TrendingTracker::Kind::Movie, 1, now);
+        BOOST_REQUIRE_EQUAL(movies.size(), 1);
+        BOOST_CHECK_EQUAL(movies.front().id, 1);
+        BOOST_CHECK_GE(movies.front().bookings + tracker.getDropped(), threadsCount * bookingsCount / 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(AllBookingModes_Counted)
+    {
+        BookingService service;
+        service.initialize();
+        Premiere& premiere = *service.getPremiere("4DX", "Terminator").value();
+        const auto deadline = std::chrono::steady_clock::now() + 1s;
+
+        // Counted once the booking lock is released: the failed bookings are not counted
+        BOOST_REQUIRE(premiere.bookSeats({1}));
+        BOOST_REQUIRE(premiere.bookSeatsCombined({2}));
+        BOOST_REQUIRE(premiere.bookSeatsIfUncontended(std::vector<uint16_t> {3}).value().booked);
+        BOOST_REQUIRE(BookingResult::Booked == premiere.tryBookSeats(std::vector<uint16_t> {4}, deadline));
+        BOOST_REQUIRE(BookingResult::SeatsTaken == premiere.tryBookSeats(std::vector<uint16_t> {4}, deadline));
+        BOOST_REQUIRE(!premiere.bookSeatsCombined({1}));
+
+        BOOST_CHECK_EQUAL(service.trending.estimate(TrendingTracker::Kind::Movie, premiere.movieId), 4);
+        BOOST_CHECK_EQUAL(service.trending.getWindowTotal(), 4);
+    }
+
+    BOOST_AUTO_TEST_CASE(CLI_Trending)
+    {
+        BookingService service;
+        service.initialize();
+        std::stringstream ss;
+        CLI::SimpleCLI cli { service, ss };
+
+        BOOST_CHECK(cli.processCommand("trending") == CLI::SimpleCLI::Status::Continue);
+        BOOST_CHECK_EQUAL(ss.str(), "No bookings in the last 5 minutes\n");
+        ss.str("");
+
+        for (const uint16_t seat: {1, 2, 3})
+            BOOST_REQUIRE(service.getPremiere("4DX", "Terminator").value()->bookSeats({seat}));
+        BOOST_REQUIRE(service.getPremiere("Odeon", "Inception").value()->bookSeats({1, 2}));
+        BOOST_REQUIRE(!service.getPremiere("Odeon", "Inception").value()->bookSeats({2}));
+
+        BOOST_CHECK(cli.processCommand("trending") == CLI::SimpleCLI::Status::Continue);
+        BOOST_CHECK_EQUAL(ss.str(), "Trending movies (last 5 minutes):\n\tTerminator: 3 booking(s)\n"
+                                    "\tInception: 1 booking(s)\n");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("trending theaters 1") == CLI::SimpleCLI::Status::Continue);
+        BOOST_CHECK_EQUAL(ss.str(), "Trending theaters (last 5 minutes):\n\t4DX: 3 booking(s)\n");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("trending shows") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "Incorrect kind: 'shows'");
+        ss.str("");
+
+        BOOST_CHECK(cli.processCommand("trending movies 0") == CLI::SimpleCLI::Status::Continue);
+        CHECK_CONTAINS(ss.str(), "Incorrect number: '0'");
+    }
+
+BOOST_AUTO_TEST_SUITE_END()